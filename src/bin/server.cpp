@@ -1,19 +1,23 @@
 #include <boost/asio/io_service.hpp>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <thread>
 
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "server/server.hpp"
+#include "storage/chunk_encoding_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
 
 int main(int argc, char* argv[]) {
   try {
     uint16_t port = 5432;
+    size_t io_thread_count = std::max(std::thread::hardware_concurrency(), 1u);
 
     if (argc >= 2) {
       char* endptr{nullptr};
@@ -23,20 +27,33 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(port_long);
     }
 
+    if (argc >= 3) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto io_thread_count_long = std::strtol(argv[2], &endptr, 10);
+      Assert(errno == 0 && io_thread_count_long > 0 && *endptr == 0, "invalid number of io threads");
+      io_thread_count = static_cast<size_t>(io_thread_count_long);
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
+    // Encode the chunks that INSERTs filled in the background
+    opossum::ChunkEncodingManager::get().resume();
+
     boost::asio::io_service io_service;
 
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
-    // constructor and then runs forever.
+    // constructor and then runs forever. The sessions are processed by io_thread_count threads.
     opossum::Server server{io_service, port};
 
-    io_service.run();
+    server.run(io_thread_count);
   } catch (std::exception& e) {
     std::cerr << "Exception: " << e.what() << "\n";
   }
 
+  opossum::ChunkEncodingManager::get().pause();
+
   return 0;
 }
@@ -0,0 +1,187 @@
+#include <boost/algorithm/string.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <arpa/inet.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cxxopts.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * This benchmark measures how the throughput of the server (see hyriseServer) scales with the number of concurrent
+ * connections. For every number of clients, that many connections are opened and each of them sends the same query
+ * over and over again using the simple query protocol. Every client waits for the ReadyForQuery message before sending
+ * the next query, so the number of clients equals the number of queries in flight.
+ *
+ * As the client threads only parse the message headers, the measured queries per second mostly depend on the server:
+ * its io threads (protocol handling, serialization of the results) and its scheduler (query execution).
+ */
+
+namespace {
+
+using boost::asio::ip::tcp;
+
+// A minimal PostgreSQL frontend that supports the startup and the simple query protocol
+class BenchmarkClient {
+ public:
+  BenchmarkClient(boost::asio::io_service& io_service, const tcp::endpoint& endpoint) : _socket(io_service) {
+    _socket.connect(endpoint);
+    _socket.set_option(tcp::no_delay{true});
+
+    // Startup message: length, protocol version 3.0, and the parameters, terminated by an additional \0
+    const auto parameters = std::string{"user"} + '\0' + "hyrise" + '\0' + '\0';
+    auto message = std::vector<char>{};
+    _append_int32(message, static_cast<uint32_t>(2 * sizeof(uint32_t) + parameters.size()));
+    _append_int32(message, 196608u);
+    message.insert(message.end(), parameters.begin(), parameters.end());
+    boost::asio::write(_socket, boost::asio::buffer(message));
+
+    _read_until_ready_for_query();
+  }
+
+  // Returns false if the server responded with an error
+  bool query(const std::string& sql) {
+    auto message = std::vector<char>{'Q'};
+    _append_int32(message, static_cast<uint32_t>(sizeof(uint32_t) + sql.size() + 1));
+    message.insert(message.end(), sql.begin(), sql.end());
+    message.push_back('\0');
+    boost::asio::write(_socket, boost::asio::buffer(message));
+
+    return _read_until_ready_for_query();
+  }
+
+  ~BenchmarkClient() {
+    auto message = std::vector<char>{'X'};
+    _append_int32(message, sizeof(uint32_t));
+    boost::system::error_code error_code;
+    boost::asio::write(_socket, boost::asio::buffer(message), error_code);
+  }
+
+ protected:
+  static void _append_int32(std::vector<char>& message, const uint32_t value) {
+    const auto network_value = htonl(value);
+    const auto* bytes = reinterpret_cast<const char*>(&network_value);
+    message.insert(message.end(), bytes, bytes + sizeof(network_value));
+  }
+
+  // Skips all messages up to and including the next ReadyForQuery message
+  bool _read_until_ready_for_query() {
+    auto success = true;
+
+    while (true) {
+      char header[1 + sizeof(uint32_t)];
+      boost::asio::read(_socket, boost::asio::buffer(header));
+
+      uint32_t length;
+      std::memcpy(&length, header + 1, sizeof(length));
+      _body.resize(ntohl(length) - sizeof(uint32_t));
+      boost::asio::read(_socket, boost::asio::buffer(_body));
+
+      if (header[0] == 'E') success = false;
+      if (header[0] == 'Z') return success;
+    }
+  }
+
+  tcp::socket _socket;
+  std::vector<char> _body;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  cxxopts::Options cli_options{"Hyrise Server Benchmark"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print this help message")
+    ("host", "Host of the server", cxxopts::value<std::string>()->default_value("127.0.0.1"))
+    ("p,port", "Port of the server", cxxopts::value<std::string>()->default_value("5432"))
+    ("c,clients", "Comma-separated numbers of concurrent clients to measure", cxxopts::value<std::string>()->default_value("1,2,4,8,16,32,64,128")) // NOLINT
+    ("t,time", "Seconds to measure for each number of clients", cxxopts::value<size_t>()->default_value("10"))
+    ("q,query", "Query sent by all clients", cxxopts::value<std::string>()->default_value("SELECT 1;"))
+    ("s,setup", "Query sent once before the benchmark, e.g., to load a table", cxxopts::value<std::string>()->default_value("")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto query = cli_parse_result["query"].as<std::string>();
+  const auto setup_query = cli_parse_result["setup"].as<std::string>();
+  const auto duration = std::chrono::seconds{cli_parse_result["time"].as<size_t>()};
+
+  auto client_counts_string = cli_parse_result["clients"].as<std::string>();
+  auto client_count_strings = std::vector<std::string>{};
+  boost::trim_if(client_counts_string, boost::is_any_of(","));
+  boost::split(client_count_strings, client_counts_string, boost::is_any_of(","), boost::token_compress_on);
+
+  boost::asio::io_service io_service;
+  auto resolver = tcp::resolver{io_service};
+  const auto endpoint = *resolver.resolve(
+      tcp::resolver::query{cli_parse_result["host"].as<std::string>(), cli_parse_result["port"].as<std::string>()});
+
+  if (!setup_query.empty()) {
+    auto client = BenchmarkClient{io_service, endpoint};
+    Assert(client.query(setup_query), "Setup query failed");
+  }
+
+  std::cout << "clients,queries,errors,seconds,queries_per_second" << std::endl;
+
+  for (const auto& client_count_string : client_count_strings) {
+    const auto client_count = std::stoul(client_count_string);
+
+    std::atomic_bool running{true};
+    std::atomic_uint64_t query_count{0};
+    std::atomic_uint64_t error_count{0};
+    std::atomic_size_t connected_client_count{0};
+
+    // Every client has its own connection and thread, the measurement starts once all of them are connected
+    auto client_threads = std::vector<std::thread>{};
+    client_threads.reserve(client_count);
+    for (auto client_index = size_t{0}; client_index < client_count; ++client_index) {
+      client_threads.emplace_back([&]() {
+        auto client = BenchmarkClient{io_service, endpoint};
+        ++connected_client_count;
+        while (connected_client_count < client_count) std::this_thread::yield();
+
+        auto client_query_count = uint64_t{0};
+        auto client_error_count = uint64_t{0};
+        while (running) {
+          if (!client.query(query)) ++client_error_count;
+          ++client_query_count;
+        }
+
+        query_count += client_query_count;
+        error_count += client_error_count;
+      });
+    }
+
+    while (connected_client_count < client_count) std::this_thread::yield();
+    const auto begin = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(duration);
+    running = false;
+
+    for (auto& client_thread : client_threads) {
+      client_thread.join();
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << client_count << "," << query_count << "," << error_count << "," << seconds << ","
+              << static_cast<double>(query_count) / seconds << std::endl;
+  }
+
+  return 0;
+}
@@ -44,6 +44,8 @@ const boost::bimap<PredicateCondition, std::string> predicate_condition_to_strin
 const std::unordered_map<OrderByMode, std::string> order_by_mode_to_string = {
     {OrderByMode::Ascending, "Ascending"},
     {OrderByMode::Descending, "Descending"},
+    {OrderByMode::AscendingNullsLast, "AscendingNullsLast"},
+    {OrderByMode::DescendingNullsLast, "DescendingNullsLast"},
 };
 
 const std::unordered_map<hsql::OrderType, OrderByMode> order_type_to_order_by_mode = {
@@ -82,6 +84,7 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::RunLength, "RunLength"},
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
+    {EncodingType::FSST, "FSST"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
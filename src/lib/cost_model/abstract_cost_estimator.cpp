@@ -4,6 +4,7 @@
 #include <unordered_set>
 
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 
 namespace opossum {
 
@@ -34,4 +35,9 @@ Cost AbstractCostEstimator::estimate_plan_cost(const std::shared_ptr<AbstractLQP
   return cost;
 }
 
+Cost AbstractCostEstimator::estimate_join_cost(const std::shared_ptr<JoinNode>& join_node,
+                                               const OperatorType join_operator_type) const {
+  return _estimate_node_cost(join_node);
+}
+
 }  // namespace opossum
@@ -7,6 +7,8 @@
 namespace opossum {
 
 class AbstractLQPNode;
+class JoinNode;
+enum class OperatorType;
 
 /**
  * Interface of an algorithm that predicts Cost for operators.
@@ -17,6 +19,15 @@ class AbstractCostEstimator {
 
   Cost estimate_plan_cost(const std::shared_ptr<AbstractLQPNode>& lqp) const;
 
+  /**
+   * Predicts the Cost of executing the JoinNode (without its inputs) with a specific join operator, e.g.,
+   * OperatorType::JoinHash. The LQPTranslator uses this to choose among the join operators that support a join. The
+   * caller has to make sure that the operator is able to execute the join.
+   * By default, all join operators are assumed to cost the same as the JoinNode.
+   */
+  virtual Cost estimate_join_cost(const std::shared_ptr<JoinNode>& join_node,
+                                  const OperatorType join_operator_type) const;
+
  protected:
   virtual Cost _estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const = 0;
 };
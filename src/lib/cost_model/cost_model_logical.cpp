@@ -1,12 +1,21 @@
 #include "cost_model_logical.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/operator_join_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -47,6 +56,76 @@ Cost CostModelLogical::_estimate_node_cost(const std::shared_ptr<AbstractLQPNode
   }
 }
 
+Cost CostModelLogical::estimate_join_cost(const std::shared_ptr<JoinNode>& join_node,
+                                          const OperatorType join_operator_type) const {
+  const auto output_row_count = join_node->get_statistics()->row_count();
+  const auto left_input_row_count = join_node->left_input()->get_statistics()->row_count();
+  const auto right_input_row_count = join_node->right_input()->get_statistics()->row_count();
+
+  const auto sort_cost = [](const float row_count) { return row_count * std::log2(std::max(2.0f, row_count)); };
+
+  switch (join_operator_type) {
+    case OperatorType::JoinHash:
+      // Both inputs are materialized and radix partitioned, the left input is inserted into the hash tables and the
+      // right input probes them
+      return 3.0f * left_input_row_count + 3.0f * right_input_row_count + output_row_count;
+
+    case OperatorType::JoinSortMerge:
+    case OperatorType::JoinMPSM:
+      return sort_cost(left_input_row_count) + sort_cost(right_input_row_count) + left_input_row_count +
+             right_input_row_count + output_row_count;
+
+    case OperatorType::JoinNestedLoop:
+      return left_input_row_count * right_input_row_count + output_row_count;
+
+    case OperatorType::JoinIndex:
+      return _estimate_index_join_cost(*join_node, left_input_row_count, right_input_row_count) + output_row_count;
+
+    default:
+      Fail("Not a join operator");
+  }
+}
+
+Cost CostModelLogical::_estimate_index_join_cost(const JoinNode& join_node, const float left_input_row_count,
+                                                 const float right_input_row_count) {
+  // JoinIndex uses the indexes of the chunks of the stored table that its right input is or references (e.g., after a
+  // Validate). Only a stored table has indexes.
+  const auto stored_table_node = lqp_find_referenced_stored_table_node(join_node.right_input());
+  if (!stored_table_node || !join_node.join_predicate) return left_input_row_count * right_input_row_count;
+
+  const auto operator_join_predicate = OperatorJoinPredicate::from_expression(
+      *join_node.join_predicate, *join_node.left_input(), *join_node.right_input());
+  if (!operator_join_predicate) return left_input_row_count * right_input_row_count;
+
+  // The ColumnID of the join column in the stored table may differ from the one in the right input
+  const auto& right_column_expression =
+      *join_node.right_input()->column_expressions().at(operator_join_predicate->column_ids.second);
+  const auto stored_column_id = stored_table_node->find_column_id(right_column_expression);
+  if (!stored_column_id) return left_input_row_count * right_input_row_count;
+
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  const auto& excluded_chunk_ids = stored_table_node->excluded_chunk_ids();
+  const auto right_column_ids = std::vector<ColumnID>{*stored_column_id};
+
+  auto cost = Cost{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (std::find(excluded_chunk_ids.begin(), excluded_chunk_ids.end(), chunk_id) != excluded_chunk_ids.end()) {
+      continue;
+    }
+
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = static_cast<float>(chunk->size());
+
+    if (chunk->get_indices(right_column_ids).empty()) {
+      cost += left_input_row_count * chunk_size;
+    } else {
+      cost += left_input_row_count * std::log2(std::max(2.0f, chunk_size));
+    }
+  }
+
+  return cost;
+}
+
 float CostModelLogical::_get_expression_cost_multiplier(const std::shared_ptr<AbstractExpression>& expression) {
   // Number of operations +  number of different columns accessed to factor in expression complexity
 
@@ -10,11 +10,19 @@ class AbstractExpression;
  * Cost model for logical complexity, i.e., approximate number of tuple accesses
  */
 class CostModelLogical : public AbstractCostEstimator {
+ public:
+  Cost estimate_join_cost(const std::shared_ptr<JoinNode>& join_node,
+                          const OperatorType join_operator_type) const override;
+
  protected:
   Cost _estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
  private:
   static float _get_expression_cost_multiplier(const std::shared_ptr<AbstractExpression>& expression);
+
+  // Index lookups for the chunks of the right input that have an index on the join column, nested loops for the others
+  static Cost _estimate_index_join_cost(const JoinNode& join_node, const float left_input_row_count,
+                                        const float right_input_row_count);
 };
 
 }  // namespace opossum
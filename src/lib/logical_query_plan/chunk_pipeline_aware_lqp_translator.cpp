@@ -0,0 +1,109 @@
+#include "chunk_pipeline_aware_lqp_translator.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "operators/aggregate.hpp"
+#include "operators/chunk_pipeline.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+
+namespace opossum {
+
+ChunkPipelineAwareLQPTranslator::ChunkPipelineAwareLQPTranslator(
+    const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
+    : LQPTranslator(cost_estimator) {}
+
+std::shared_ptr<AbstractOperator> ChunkPipelineAwareLQPTranslator::translate_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto operator_iter = _operator_by_lqp_node.find(node);
+  if (operator_iter != _operator_by_lqp_node.end()) {
+    return operator_iter->second;
+  }
+
+  auto op = LQPTranslator::translate_node(node);
+  if (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Aggregate) {
+    if (const auto chunk_pipeline = _try_translate_to_chunk_pipeline(node, op)) op = chunk_pipeline;
+  }
+
+  _operator_by_lqp_node.emplace(node, op);
+  return op;
+}
+
+std::shared_ptr<ChunkPipeline> ChunkPipelineAwareLQPTranslator::_try_translate_to_chunk_pipeline(
+    const std::shared_ptr<AbstractLQPNode>& node, const std::shared_ptr<AbstractOperator>& op) const {
+  auto predicates = std::vector<OperatorScanPredicate>{};
+  auto pipeline_input = std::shared_ptr<const AbstractOperator>{};
+
+  if (op->type() == OperatorType::Projection) {
+    // A Projection without TableScans is not worth a pipeline
+    const auto& projection = static_cast<const Projection&>(*op);
+    if (!_collect_table_scan_predicates(node->left_input(), op->input_left(), predicates, pipeline_input) ||
+        predicates.empty()) {
+      return nullptr;
+    }
+
+    return std::make_shared<ChunkPipeline>(pipeline_input, predicates, projection.expressions);
+  }
+
+  if (op->type() != OperatorType::Aggregate) return nullptr;
+  const auto& aggregate = static_cast<const Aggregate&>(*op);
+  const auto& input_node = node->left_input();
+  const auto& input_operator = op->input_left();
+
+  if (input_node->type == LQPNodeType::Projection) {
+    if (input_node->output_count() != 1) return nullptr;
+
+    if (input_operator->type() == OperatorType::ChunkPipeline) {
+      const auto& input_pipeline = static_cast<const ChunkPipeline&>(*input_operator);
+      return std::make_shared<ChunkPipeline>(input_pipeline.input_left(), input_pipeline.predicates(),
+                                             input_pipeline.expressions(), aggregate.aggregates(),
+                                             aggregate.groupby_column_ids());
+    }
+
+    if (input_operator->type() != OperatorType::Projection ||
+        !_collect_table_scan_predicates(input_node->left_input(), input_operator->input_left(), predicates,
+                                        pipeline_input)) {
+      return nullptr;
+    }
+
+    const auto& projection = static_cast<const Projection&>(*input_operator);
+    return std::make_shared<ChunkPipeline>(pipeline_input, predicates, projection.expressions, aggregate.aggregates(),
+                                           aggregate.groupby_column_ids());
+  }
+
+  if (!_collect_table_scan_predicates(input_node, input_operator, predicates, pipeline_input) || predicates.empty()) {
+    return nullptr;
+  }
+
+  return std::make_shared<ChunkPipeline>(pipeline_input, predicates, std::vector<std::shared_ptr<AbstractExpression>>{},
+                                         aggregate.aggregates(), aggregate.groupby_column_ids());
+}
+
+bool ChunkPipelineAwareLQPTranslator::_collect_table_scan_predicates(
+    const std::shared_ptr<AbstractLQPNode>& input_node, const std::shared_ptr<const AbstractOperator>& input_operator,
+    std::vector<OperatorScanPredicate>& predicates, std::shared_ptr<const AbstractOperator>& pipeline_input) const {
+  auto node = input_node;
+  while (node->type == LQPNodeType::Predicate) {
+    if (node->output_count() != 1) return false;
+    node = node->left_input();
+  }
+
+  // Already translated, so this only looks up the cache
+  pipeline_input = translate_node(node);
+
+  // A PredicateNode might have been translated to an IndexScan or a join instead
+  for (auto op = input_operator; op != pipeline_input; op = op->input_left()) {
+    if (!op || op->type() != OperatorType::TableScan) return false;
+
+    const auto& table_scan = static_cast<const TableScan&>(*op);
+    if (!table_scan.excluded_chunk_ids().empty()) return false;
+
+    predicates.insert(predicates.begin(), table_scan.predicate());
+  }
+
+  return true;
+}
+
+}  // namespace opossum
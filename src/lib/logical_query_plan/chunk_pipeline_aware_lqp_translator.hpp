@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "lqp_translator.hpp"
+
+namespace opossum {
+
+class ChunkPipeline;
+
+/**
+ * Can be used as a drop-in replacement for the LQPTranslator. Fuses the operators that the LQPTranslator creates for
+ *
+ *     Projection <- TableScan(s),  Aggregate <- Projection <- TableScan(s),  and  Aggregate <- TableScan(s)
+ *
+ * into a single ChunkPipeline, which pushes each chunk through all of them instead of materializing the intermediate
+ * tables. The TableScans of the PredicateNodes directly below are fused, as long as no other node consumes them.
+ * Everything else is translated by the LQPTranslator.
+ */
+class ChunkPipelineAwareLQPTranslator final : public LQPTranslator {
+ public:
+  explicit ChunkPipelineAwareLQPTranslator(const std::shared_ptr<AbstractCostEstimator>& cost_estimator = nullptr);
+
+  std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
+
+ private:
+  std::shared_ptr<ChunkPipeline> _try_translate_to_chunk_pipeline(const std::shared_ptr<AbstractLQPNode>& node,
+                                                                   const std::shared_ptr<AbstractOperator>& op) const;
+
+  // Collects the predicates of the TableScans that input_operator and its inputs translate the PredicateNodes starting
+  // at input_node to. Returns false if they cannot be fused, e.g., because other nodes consume them as well.
+  bool _collect_table_scan_predicates(const std::shared_ptr<AbstractLQPNode>& input_node,
+                                      const std::shared_ptr<const AbstractOperator>& input_operator,
+                                      std::vector<OperatorScanPredicate>& predicates,
+                                      std::shared_ptr<const AbstractOperator>& pipeline_input) const;
+
+  // The LQPTranslator caches the unfused operators, so the ChunkPipelines need to be cached separately
+  mutable std::unordered_map<std::shared_ptr<AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
+      _operator_by_lqp_node;
+};
+
+}  // namespace opossum
@@ -15,16 +15,21 @@ LimitNode::LimitNode(const std::shared_ptr<AbstractExpression>& num_rows_express
 std::string LimitNode::description() const {
   std::stringstream stream;
   stream << "[Limit] " << num_rows_expression->as_column_name();
+  if (limit_type == LimitType::TopK) stream << " (TopK)";
   return stream.str();
 }
 
 std::shared_ptr<AbstractLQPNode> LimitNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression, node_mapping));
+  const auto limit_node =
+      LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression, node_mapping));
+  limit_node->limit_type = limit_type;
+  return limit_node;
 }
 
 bool LimitNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& limit_node = static_cast<const LimitNode&>(rhs);
-  return expression_equal_to_expression_in_different_lqp(*num_rows_expression, *limit_node.num_rows_expression,
+  return limit_type == limit_node.limit_type &&
+         expression_equal_to_expression_in_different_lqp(*num_rows_expression, *limit_node.num_rows_expression,
                                                          node_mapping);
 }
 
@@ -6,6 +6,9 @@
 
 namespace opossum {
 
+// TopK: Sort the input of the LimitNode (which has to be a SortNode) and limit it in one step (see TopKRule)
+enum class LimitType : uint8_t { Limit, TopK };
+
 /**
  * This node type represents limiting a result to a certain number of rows (LIMIT operator).
  */
@@ -17,6 +20,8 @@ class LimitNode : public EnableMakeForLQPNode<LimitNode>, public AbstractLQPNode
 
   const std::shared_ptr<AbstractExpression> num_rows_expression;
 
+  LimitType limit_type{LimitType::Limit};
+
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
@@ -1,13 +1,16 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
+#include "cost_model/cost_model_logical.hpp"
 #include "create_view_node.hpp"
 #include "delete_node.hpp"
 #include "drop_view_node.hpp"
@@ -27,6 +30,7 @@
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
@@ -34,6 +38,8 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_view.hpp"
@@ -47,6 +53,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
@@ -64,6 +71,39 @@ using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+namespace {
+
+// Statistics, and thus Costs, cannot be derived for all kinds of nodes (e.g., UnionNodes)
+bool statistics_available(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto available = true;
+
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Aggregate:
+      case LQPNodeType::Alias:
+      case LQPNodeType::Join:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+      case LQPNodeType::StoredTable:
+      case LQPNodeType::Validate:
+        return LQPVisitation::VisitInputs;
+
+      default:
+        available = false;
+        return LQPVisitation::DoNotVisitInputs;
+    }
+  });
+
+  return available;
+}
+
+}  // namespace
+
+LQPTranslator::LQPTranslator(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
+    : _cost_estimator(cost_estimator ? cost_estimator : std::make_shared<CostModelLogical>()) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -133,6 +173,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (const auto join_operator = _translate_predicate_nodes_into_join(node)) return join_operator;
+
   const auto input_node = node->left_input();
   const auto input_operator = translate_node(input_node);
   const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
@@ -273,43 +315,40 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
 
+  return std::make_shared<Sort>(input_operator, _translate_sort_definitions(sort_node));
+}
+
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_definitions(
+    const std::shared_ptr<SortNode>& sort_node) const {
   /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
+   * Translate all order descriptions into SortColumnDefinitions, so that a single operator sorts by all of them at
+   * once. The first expression is the most significant one.
    */
+  const auto& pqp_expressions = _translate_expressions(sort_node->expressions, sort_node->left_input());
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
-
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
+  std::vector<SortColumnDefinition> sort_definitions;
+  sort_definitions.reserve(pqp_expressions.size());
 
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
+  auto order_by_mode_iter = sort_node->order_by_modes.begin();
+  for (const auto& pqp_expression : pqp_expressions) {
     const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
     Assert(pqp_column_expression,
            "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
 
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
+    sort_definitions.emplace_back(pqp_column_expression->column_id, *order_by_mode_iter);
+    ++order_by_mode_iter;
   }
 
-  return current_pqp;
+  return sort_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_left_operator = translate_node(node->left_input());
-  const auto input_right_operator = translate_node(node->right_input());
-
   auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
 
   if (join_node->join_mode == JoinMode::Cross) {
     PerformanceWarning("CROSS join used");
-    return std::make_shared<Product>(input_left_operator, input_right_operator);
+    return std::make_shared<Product>(translate_node(node->left_input()), translate_node(node->right_input()));
   }
 
   Assert(join_node->join_predicate, "Need predicate for non Cross Join");
@@ -322,15 +361,149 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
       OperatorJoinPredicate::from_expression(*join_node->join_predicate, *node->left_input(), *node->right_input());
   Assert(operator_join_predicate, "Couldn't translate join predicate: "s + join_node->join_predicate->as_column_name());
 
-  const auto predicate_condition = operator_join_predicate->predicate_condition;
+  return _translate_join(join_node, *operator_join_predicate, {});
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_nodes_into_join(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  /**
+   * PredicateNodes that directly follow an inner JoinNode and compare a column of its left input with a column of its
+   * right input (e.g., `a.y = b.y` in `a.x = b.x AND a.y = b.y`) are evaluated by the join operator instead of a
+   * TableScan on the join result. Thus, the join only emits rows that satisfy all predicates.
+   * This is only done if neither the JoinNode nor the PredicateNodes below `node` are used anywhere else in the LQP,
+   * as their operators are skipped.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+
+  auto current_node = node;
+  while (current_node->type == LQPNodeType::Predicate) {
+    if (current_node != node && current_node->output_count() != 1) return nullptr;
+
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(current_node);
+    if (predicate_node->scan_type != ScanType::TableScan) return nullptr;
 
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      operator_join_predicate->column_ids, predicate_condition);
+    predicate_nodes.emplace_back(predicate_node);
+    current_node = current_node->left_input();
   }
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
-                                         operator_join_predicate->column_ids, predicate_condition);
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(current_node);
+  if (!join_node || join_node->join_mode != JoinMode::Inner || join_node->output_count() != 1) return nullptr;
+
+  const auto& left_input = *join_node->left_input();
+  const auto& right_input = *join_node->right_input();
+
+  auto primary_predicate =
+      OperatorJoinPredicate::from_expression(*join_node->join_predicate, left_input, right_input);
+  Assert(primary_predicate, "Couldn't translate join predicate: "s + join_node->join_predicate->as_column_name());
+
+  auto secondary_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto secondary_predicate =
+        OperatorJoinPredicate::from_expression(*predicate_node->predicate, left_input, right_input);
+    if (!secondary_predicate) return nullptr;
+
+    // Strings and numbers cannot be compared by the join operators
+    const auto& column_ids = secondary_predicate->column_ids;
+    const auto left_is_string = left_input.column_expressions().at(column_ids.first)->data_type() == DataType::String;
+    const auto right_is_string =
+        right_input.column_expressions().at(column_ids.second)->data_type() == DataType::String;
+    if (left_is_string != right_is_string) return nullptr;
+
+    secondary_predicates.emplace_back(*secondary_predicate);
+  }
+
+  // The join operators perform best if the primary predicate is an equality, so swap it with a secondary one if needed
+  if (primary_predicate->predicate_condition != PredicateCondition::Equals) {
+    const auto equals_predicate_iter =
+        std::find_if(secondary_predicates.begin(), secondary_predicates.end(), [](const auto& secondary_predicate) {
+          return secondary_predicate.predicate_condition == PredicateCondition::Equals;
+        });
+    if (equals_predicate_iter != secondary_predicates.end()) std::swap(*primary_predicate, *equals_predicate_iter);
+  }
+
+  return _translate_join(join_node, *primary_predicate, secondary_predicates);
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join(
+    const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& primary_predicate,
+    const std::vector<OperatorJoinPredicate>& secondary_predicates) const {
+  const auto input_left_operator = translate_node(join_node->left_input());
+  const auto input_right_operator = translate_node(join_node->right_input());
+
+  const auto& column_ids = primary_predicate.column_ids;
+  const auto predicate_condition = primary_predicate.predicate_condition;
+
+  switch (_choose_join_operator_type(join_node, primary_predicate, !secondary_predicates.empty())) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                        predicate_condition, secondary_predicates);
+    case OperatorType::JoinIndex:
+      return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                         predicate_condition);
+    case OperatorType::JoinNestedLoop:
+      return std::make_shared<JoinNestedLoop>(input_left_operator, input_right_operator, join_node->join_mode,
+                                              column_ids, predicate_condition);
+    default:
+      return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
+                                             column_ids, predicate_condition, secondary_predicates);
+  }
+}
+
+OperatorType LQPTranslator::_choose_join_operator_type(const std::shared_ptr<JoinNode>& join_node,
+                                                       const OperatorJoinPredicate& operator_join_predicate,
+                                                       const bool has_secondary_predicates) const {
+  const auto join_mode = join_node->join_mode;
+  const auto predicate_condition = operator_join_predicate.predicate_condition;
+
+  /**
+   * Collect the join operators that support the join. Without statistics, the JoinHash is used for equi joins and
+   * the JoinSortMerge for all others.
+   * JoinMPSM is not considered, as it only pays off on NUMA systems.
+   */
+  auto candidates = std::vector<OperatorType>{};
+
+  if (predicate_condition == PredicateCondition::Equals && join_mode != JoinMode::Outer) {
+    candidates.emplace_back(OperatorType::JoinHash);
+  }
+
+  // Only the JoinHash casts between different data types of the join columns. The other join operators require equal
+  // data types or do not find matches between, e.g., strings and numbers.
+  const auto& column_ids = operator_join_predicate.column_ids;
+  const auto same_data_types = join_node->left_input()->column_expressions().at(column_ids.first)->data_type() ==
+                               join_node->right_input()->column_expressions().at(column_ids.second)->data_type();
+
+  if (same_data_types && join_mode != JoinMode::Semi && join_mode != JoinMode::Anti) {
+    if (predicate_condition != PredicateCondition::NotEquals || join_mode == JoinMode::Inner) {
+      candidates.emplace_back(OperatorType::JoinSortMerge);
+    }
+
+    // Only the JoinHash and the JoinSortMerge evaluate secondary predicates
+    if (!has_secondary_predicates) {
+      candidates.emplace_back(OperatorType::JoinNestedLoop);
+
+      // JoinIndex uses the indexes of the stored table that its right input is or references
+      if (predicate_condition != PredicateCondition::NotEquals &&
+          lqp_find_referenced_stored_table_node(join_node->right_input())) {
+        candidates.emplace_back(OperatorType::JoinIndex);
+      }
+    }
+  }
+
+  if (candidates.empty()) return OperatorType::JoinSortMerge;
+  if (candidates.size() == 1 || !statistics_available(join_node)) return candidates.front();
+
+  auto best_operator_type = candidates.front();
+  auto best_cost = _cost_estimator->estimate_join_cost(join_node, best_operator_type);
+
+  for (auto candidate_idx = size_t{1}; candidate_idx < candidates.size(); ++candidate_idx) {
+    const auto cost = _cost_estimator->estimate_join_cost(join_node, candidates[candidate_idx]);
+    if (cost < best_cost) {
+      best_operator_type = candidates[candidate_idx];
+      best_cost = cost;
+    }
+  }
+
+  return best_operator_type;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
@@ -381,10 +554,20 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(input_operator,
-                                 _translate_expressions({limit_node->num_rows_expression}, node->left_input()).front());
+  const auto num_rows_expression =
+      _translate_expressions({limit_node->num_rows_expression}, node->left_input()).front();
+
+  if (limit_node->limit_type == LimitType::TopK) {
+    const auto sort_node = std::dynamic_pointer_cast<SortNode>(node->left_input());
+    Assert(sort_node, "LimitType::TopK requires a SortNode as input");
+
+    const auto input_operator = translate_node(sort_node->left_input());
+    return std::make_shared<TopK>(input_operator, _translate_sort_definitions(sort_node), num_rows_expression);
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  return std::make_shared<Limit>(input_operator, num_rows_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -9,19 +10,30 @@
 
 namespace opossum {
 
+class AbstractCostEstimator;
 class AbstractOperator;
+class JoinNode;
 class TransactionContext;
 class AbstractExpression;
 class PredicateNode;
+class SortNode;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
+struct SortColumnDefinition;
 
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * Among the join operators that are able to execute a JoinNode, the one with the lowest Cost according to the
+ * cost estimator is chosen. Join predicates in PredicateNodes directly above an inner JoinNode are evaluated by the
+ * join operator as secondary predicates.
  */
 class LQPTranslator {
  public:
+  // Uses a CostModelLogical if no cost estimator is given
+  explicit LQPTranslator(const std::shared_ptr<AbstractCostEstimator>& cost_estimator = nullptr);
+
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -40,7 +52,16 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::vector<SortColumnDefinition> _translate_sort_definitions(const std::shared_ptr<SortNode>& sort_node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_nodes_into_join(
+      const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_join(
+      const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& primary_predicate,
+      const std::vector<OperatorJoinPredicate>& secondary_predicates) const;
+  OperatorType _choose_join_operator_type(const std::shared_ptr<JoinNode>& join_node,
+                                          const OperatorJoinPredicate& operator_join_predicate,
+                                          const bool has_secondary_predicates) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -74,6 +95,8 @@ class LQPTranslator {
   static AllParameterVariant _translate_to_all_parameter_variant(const AbstractLQPNode& input_node,
                                                                  const AbstractExpression& expression);
 
+  const std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
@@ -1,10 +1,13 @@
 #include "lqp_utils.hpp"
 
+#include <algorithm>
 #include <set>
 
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "utils/assert.hpp"
 
@@ -152,6 +155,38 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp) {
   return lqp_is_validated(lqp->left_input()) && lqp_is_validated(lqp->right_input());
 }
 
+std::shared_ptr<StoredTableNode> lqp_find_referenced_stored_table_node(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  // Whether a ProjectionNode was passed that is not yet known to project the output of a ValidateNode
+  auto requires_validate = false;
+
+  for (auto node = lqp; node; node = node->left_input()) {
+    switch (node->type) {
+      case LQPNodeType::StoredTable:
+        return requires_validate ? nullptr : std::static_pointer_cast<StoredTableNode>(node);
+
+      case LQPNodeType::Validate:
+        requires_validate = false;
+        break;
+
+      case LQPNodeType::Projection: {
+        const auto& expressions = std::static_pointer_cast<ProjectionNode>(node)->expressions;
+        const auto only_projects_columns =
+            std::all_of(expressions.begin(), expressions.end(),
+                        [](const auto& expression) { return expression->type == ExpressionType::LQPColumn; });
+        if (!only_projects_columns) return nullptr;
+
+        requires_validate = true;
+        break;
+      }
+
+      default:
+        return nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
 std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression(const std::shared_ptr<AbstractLQPNode>& lqp) {
   static const auto whitelist = std::set<LQPNodeType>{LQPNodeType::Projection, LQPNodeType::Sort};
 
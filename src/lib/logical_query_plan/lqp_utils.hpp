@@ -10,6 +10,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class AbstractExpression;
+class StoredTableNode;
 enum class LQPInputSide;
 
 using LQPNodeMapping = std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractLQPNode>>;
@@ -42,6 +43,14 @@ void lqp_insert_node(const std::shared_ptr<AbstractLQPNode>& parent_node, const
  */
 bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return the StoredTableNode whose table the output of the @param lqp references, looking through ValidateNodes and
+ *         ProjectionNodes that only select columns, or nullptr. The Projection operator forwards the segments of a
+ *         data table into new chunks, which have no indexes. Thus, ProjectionNodes are only looked through if they
+ *         project the output of a ValidateNode, i.e., reference segments.
+ */
+std::shared_ptr<StoredTableNode> lqp_find_referenced_stored_table_node(const std::shared_ptr<AbstractLQPNode>& lqp);
+
 /**
  * Create a boolean expression from an LQP by considering PredicateNodes and UnionNodes
  * @return      the expression, or nullptr if no expression could be created
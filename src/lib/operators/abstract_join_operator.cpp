@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "constant_mappings.hpp"
 
@@ -11,11 +12,13 @@ namespace opossum {
 AbstractJoinOperator::AbstractJoinOperator(const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
                                            const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                                            const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+                                           const std::vector<OperatorJoinPredicate>& secondary_predicates,
                                            std::unique_ptr<OperatorPerformanceData> performance_data)
     : AbstractReadOnlyOperator(type, left, right, std::move(performance_data)),
       _mode(mode),
       _column_ids(column_ids),
-      _predicate_condition(predicate_condition) {
+      _predicate_condition(predicate_condition),
+      _secondary_predicates(secondary_predicates) {
   DebugAssert(mode != JoinMode::Cross,
               "Specified JoinMode not supported by an AbstractJoin, use Product etc. instead.");
 }
@@ -26,17 +29,31 @@ const ColumnIDPair& AbstractJoinOperator::column_ids() const { return _column_id
 
 PredicateCondition AbstractJoinOperator::predicate_condition() const { return _predicate_condition; }
 
+const std::vector<OperatorJoinPredicate>& AbstractJoinOperator::secondary_predicates() const {
+  return _secondary_predicates;
+}
+
 const std::string AbstractJoinOperator::description(DescriptionMode description_mode) const {
-  std::string column_name_left = std::string("Column #") + std::to_string(_column_ids.first);
-  std::string column_name_right = std::string("Column #") + std::to_string(_column_ids.second);
+  const auto predicate_description = [&](const ColumnIDPair& column_ids, const PredicateCondition predicate_condition) {
+    std::string column_name_left = std::string("Column #") + std::to_string(column_ids.first);
+    std::string column_name_right = std::string("Column #") + std::to_string(column_ids.second);
+
+    if (input_table_left()) column_name_left = input_table_left()->column_name(column_ids.first);
+    if (input_table_right()) column_name_right = input_table_right()->column_name(column_ids.second);
 
-  if (input_table_left()) column_name_left = input_table_left()->column_name(_column_ids.first);
-  if (input_table_right()) column_name_right = input_table_right()->column_name(_column_ids.second);
+    return column_name_left + " " + predicate_condition_to_string.left.at(predicate_condition) + " " +
+           column_name_right;
+  };
 
   const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
 
-  return name() + separator + "(" + join_mode_to_string.at(_mode) + " Join where " + column_name_left + " " +
-         predicate_condition_to_string.left.at(_predicate_condition) + " " + column_name_right + ")";
+  auto description = name() + separator + "(" + join_mode_to_string.at(_mode) + " Join where " +
+                     predicate_description(_column_ids, _predicate_condition);
+  for (const auto& secondary_predicate : _secondary_predicates) {
+    description +=
+        " AND " + predicate_description(secondary_predicate.column_ids, secondary_predicate.predicate_condition);
+  }
+  return description + ")";
 }
 
 void AbstractJoinOperator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -6,13 +6,15 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "operator_join_predicate.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 // operator to join two tables using one column of each table
 // output is a table with ReferenceSegments
-// to filter by multiple criteria, you can chain the operator
+// to filter by multiple criteria, operators that support it take secondary predicates, which all joined rows have to
+// satisfy in addition to the primary predicate. Otherwise, you can chain the operator.
 
 // As with most operators, we do not guarantee a stable operation with regards
 // to positions - i.e., your sorting order might be disturbed
@@ -28,17 +30,20 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
       const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
       const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode, const ColumnIDPair& column_ids,
       const PredicateCondition predicate_condition,
+      const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
       std::unique_ptr<OperatorPerformanceData> performance_data = std::make_unique<OperatorPerformanceData>());
 
   JoinMode mode() const;
   const ColumnIDPair& column_ids() const;
   PredicateCondition predicate_condition() const;
+  const std::vector<OperatorJoinPredicate>& secondary_predicates() const;
   const std::string description(DescriptionMode description_mode) const override;
 
  protected:
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
+  const std::vector<OperatorJoinPredicate> _secondary_predicates;
 
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
@@ -19,6 +19,7 @@ class TransactionContext;
 enum class OperatorType {
   Aggregate,
   Alias,
+  ChunkPipeline,
   Delete,
   Difference,
   ExportBinary,
@@ -41,6 +42,7 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
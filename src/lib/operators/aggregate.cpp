@@ -6,10 +6,12 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "aggregate/aggregate_hash_table.hpp"
 #include "aggregate/aggregate_traits.hpp"
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -121,8 +123,12 @@ struct AggregateContext : SegmentVisitorContext {
   }
 
   std::shared_ptr<GroupByContext<AggregateKey>> groupby_context;
-  std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-      results;
+
+  // Results of the pre-aggregation, one entry per job, indexed by the group index in the job's AggregateHashTable
+  std::vector<AggregateResults<AggregateType, ColumnType>> results_per_job;
+
+  // Merged results, indexed by the output row
+  std::shared_ptr<AggregateResults<AggregateType, ColumnType>> results;
 };
 
 /*
@@ -200,9 +206,83 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Co
   }
 };
 
+/*
+Merges the result of a group from the pre-aggregation of one job into the final result of the group.
+*/
+template <AggregateFunction function, typename AggregateType, typename ColumnType>
+void merge_aggregate_results(AggregateResult<AggregateType, ColumnType>& result,
+                             AggregateResult<AggregateType, ColumnType>& partial_result) {
+  if (partial_result.current_aggregate) {
+    if (!result.current_aggregate) {
+      result.current_aggregate = std::move(partial_result.current_aggregate);
+    } else if constexpr (function == AggregateFunction::Min) {
+      if (value_smaller(*partial_result.current_aggregate, *result.current_aggregate)) {
+        result.current_aggregate = std::move(partial_result.current_aggregate);
+      }
+    } else if constexpr (function == AggregateFunction::Max) {
+      if (value_greater(*partial_result.current_aggregate, *result.current_aggregate)) {
+        result.current_aggregate = std::move(partial_result.current_aggregate);
+      }
+    } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+      *result.current_aggregate += *partial_result.current_aggregate;
+    }
+  }
+
+  result.aggregate_count += partial_result.aggregate_count;
+
+  if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
+    result.distinct_values.merge(partial_result.distinct_values);
+  }
+}
+
+/*
+Calls the functor with the AggregateContext of an aggregate and its AggregateFunction as an std::integral_constant, so
+that the functor can be specialized for both.
+*/
+template <typename AggregateKey, typename Functor>
+void resolve_aggregate_context(const AggregateColumnDefinition& aggregate, const DataType data_type,
+                               SegmentVisitorContext& base_context, const Functor& functor) {
+  if (!aggregate.column) {
+    // COUNT(*)
+    functor(static_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>&>(base_context),
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto call_functor = [&](auto function) {
+      using AggregateType = typename AggregateTraits<ColumnDataType, decltype(function)::value>::AggregateType;
+      functor(static_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(base_context), function);
+    };
+
+    switch (aggregate.function) {
+      case AggregateFunction::Min:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+        break;
+      case AggregateFunction::Max:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+        break;
+      case AggregateFunction::Sum:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+        break;
+      case AggregateFunction::Avg:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+        break;
+      case AggregateFunction::Count:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+        break;
+      case AggregateFunction::CountDistinct:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+        break;
+    }
+  });
+}
+
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                   const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+void Aggregate::_aggregate_segment(ColumnID column_index, const BaseSegment& base_segment,
+                                   const std::vector<uint32_t>& group_indices, size_t job_id, size_t group_count) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
@@ -210,21 +290,20 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
   auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
       _contexts_per_column[column_index]);
 
-  auto& results = *context.results;
-  const auto& hash_keys = keys_per_chunk[chunk_id];
+  auto& results = context.results_per_job[job_id];
+  results.resize(group_count);
 
   // clang-format off
   resolve_segment_type<ColumnDataType>(
       // clang-format on
-      base_segment, [&results, &hash_keys, chunk_id, aggregator](const auto& typed_segment) {
+      base_segment, [&results, &group_indices, aggregator](const auto& typed_segment) {
         auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
 
         ChunkOffset chunk_offset{0};
 
         // Now that all relevant types have been resolved, we can iterate over the segment and build the aggregations.
-        iterable.for_each([&, chunk_id, aggregator](const auto& value) {
-          auto& hash_entry = results[hash_keys[chunk_offset]];
-          hash_entry.row_id = RowID(chunk_id, chunk_offset);
+        iterable.for_each([&, aggregator](const auto& value) {
+          auto& hash_entry = results[group_indices[chunk_offset]];
 
           /**
           * If the value is NULL, the current aggregate value does not change.
@@ -395,151 +474,268 @@ void Aggregate::_aggregate() {
 
   /*
   AGGREGATION PHASE
-  */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  The aggregation runs in two steps, both of which are parallelized:
 
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
+  1. Pre-aggregation: The chunks are split into ranges of about ROWS_PER_PRE_AGGREGATION_JOB rows, each of which is
+     aggregated by a separate job. A job maps the AggregateKeys of its rows to job-local group indices using its own
+     AggregateHashTable and keeps the results of its groups in vectors indexed by these group indices.
+  2. Merge: The groups of all jobs are radix partitioned by the upper bits of the hash of their AggregateKey. As a
+     group falls into the same partition for all jobs, each partition is merged by a separate job without any
+     synchronization. The groups of a partition make up a consecutive range of the output.
 
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    context->results =
-        std::make_shared<std::unordered_map<AggregateKey, AggregateResult<DistinctAggregateType, DistinctColumnType>,
-                                            std::hash<AggregateKey>>>();
+  Grouping without aggregates is used for DISTINCT (e.g., "SELECT DISTINCT * FROM A;", where the optimizer passes all
+  columns as group-by columns). In that case, only the group-by columns of one row per group are written.
+  */
 
-    _contexts_per_column.push_back(context);
+  // Split the chunks into ranges for the pre-aggregation jobs
+  auto chunk_ranges = std::vector<std::pair<ChunkID, ChunkID>>{};
+  auto row_count_per_job = std::vector<size_t>{};
+  {
+    auto range_begin = ChunkID{0};
+    auto range_row_count = size_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      range_row_count += input_table->get_chunk(chunk_id)->size();
+      if (range_row_count >= ROWS_PER_PRE_AGGREGATION_JOB || chunk_id + 1u == input_table->chunk_count()) {
+        chunk_ranges.emplace_back(range_begin, ChunkID{chunk_id + 1});
+        row_count_per_job.emplace_back(range_row_count);
+        range_begin = ChunkID{chunk_id + 1};
+        range_row_count = 0;
+      }
+    }
   }
+  const auto job_count = chunk_ranges.size();
+
+  auto partition_bits = size_t{0};
+  while ((size_t{1} << partition_bits) < job_count && partition_bits < MAX_PARTITION_BITS) ++partition_bits;
+  const auto partition_count = size_t{1} << partition_bits;
+  const auto partition_of_hash = [partition_bits](const uint64_t hash) {
+    return partition_bits == 0 ? size_t{0} : static_cast<size_t>(hash >> (64 - partition_bits));
+  };
 
   /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
+   * Create an AggregateContext for each aggregate. We do this here, and not in the jobs below, because there might be
+   * no Chunks in the input and _write_aggregate_output() needs these contexts anyway.
    */
+  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
   for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
     const auto& aggregate = _aggregates[column_id];
     if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
       auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      context->results =
-          std::make_shared<std::unordered_map<AggregateKey, AggregateResult<CountAggregateType, CountColumnType>,
-                                              std::hash<AggregateKey>>>();
+      context->results_per_job.resize(job_count);
       _contexts_per_column[column_id] = context;
       continue;
     }
     auto data_type = input_table->column_data_type(*aggregate.column);
-    _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
-  }
-
-  // Process Chunks and perform aggregations
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    auto chunk_in = input_table->get_chunk(chunk_id);
-
-    const auto& hash_keys = keys_per_chunk[chunk_id];
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
-      auto& results = *context->results;
-
-      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_in->size(); chunk_offset++) {
-        results[hash_keys[chunk_offset]].row_id = RowID(chunk_id, chunk_offset);
-      }
-    } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[column_index]);
-
-          auto& results = *context->results;
-
-          // count occurrences for each group key
-          for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_in->size(); chunk_offset++) {
-            auto& hash_entry = results[hash_keys[chunk_offset]];
-            hash_entry.row_id = RowID(chunk_id, chunk_offset);
-            ++hash_entry.aggregate_count;
+    _contexts_per_column[column_id] =
+        _create_aggregate_context<AggregateKey>(data_type, aggregate.function, job_count);
+  }
+
+  const auto aggregate_data_type = [&](const AggregateColumnDefinition& aggregate) {
+    // COUNT(*) is resolved without a data type
+    return aggregate.column ? input_table->column_data_type(*aggregate.column) : DataType::Int;
+  };
+
+  struct PreAggregation {
+    explicit PreAggregation(const size_t row_count) : hash_table(row_count) {}
+
+    AggregateHashTable<AggregateKey> hash_table;
+
+    // The first row of each group, used to write the group-by columns
+    PosList row_ids;
+
+    // The group indices in each radix partition
+    std::vector<std::vector<uint32_t>> group_indices_by_partition;
+
+    // The output row of each group, determined by the merge
+    std::vector<uint32_t> output_row_indices;
+  };
+
+  auto pre_aggregations = std::vector<std::optional<PreAggregation>>(job_count);
+
+  jobs.clear();
+  jobs.reserve(job_count);
+
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      auto& pre_aggregation = pre_aggregations[job_id].emplace(row_count_per_job[job_id]);
+      auto group_indices = std::vector<uint32_t>{};
+
+      for (auto chunk_id = chunk_ranges[job_id].first; chunk_id < chunk_ranges[job_id].second; ++chunk_id) {
+        const auto chunk_in = input_table->get_chunk(chunk_id);
+        const auto& hash_keys = keys_per_chunk[chunk_id];
+
+        group_indices.resize(hash_keys.size());
+        for (ChunkOffset chunk_offset{0}; chunk_offset < hash_keys.size(); ++chunk_offset) {
+          const auto& hash_key = hash_keys[chunk_offset];
+          const auto [group_index, inserted] =
+              pre_aggregation.hash_table.find_or_insert(hash_key, hash_aggregate_key(hash_key));
+          if (inserted) pre_aggregation.row_ids.emplace_back(chunk_id, chunk_offset);
+          group_indices[chunk_offset] = group_index;
+        }
+
+        const auto group_count = pre_aggregation.hash_table.size();
+
+        ColumnID column_index{0};
+        for (const auto& aggregate : _aggregates) {
+          /**
+           * Special COUNT(*) implementation.
+           * Because COUNT(*) does not have a specific target column, we count the occurrences of each group index.
+           * The results are saved in the regular aggregate_count variable so that we don't need a specific output
+           * logic for COUNT(*).
+           */
+          if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+            auto& results =
+                std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+                    _contexts_per_column[column_index])
+                    ->results_per_job[job_id];
+            results.resize(group_count);
+
+            for (const auto group_index : group_indices) {
+              ++results[group_index].aggregate_count;
+            }
+
+            ++column_index;
+            continue;
           }
 
+          auto base_segment = chunk_in->get_segment(*aggregate.column);
+
+          /*
+          Invoke correct aggregator for each segment
+          */
+
+          resolve_data_type(aggregate_data_type(aggregate), [&, aggregate](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+
+            switch (aggregate.function) {
+              case AggregateFunction::Min:
+                _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                    column_index, *base_segment, group_indices, job_id, group_count);
+                break;
+              case AggregateFunction::Max:
+                _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                    column_index, *base_segment, group_indices, job_id, group_count);
+                break;
+              case AggregateFunction::Sum:
+                _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                    column_index, *base_segment, group_indices, job_id, group_count);
+                break;
+              case AggregateFunction::Avg:
+                _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                    column_index, *base_segment, group_indices, job_id, group_count);
+                break;
+              case AggregateFunction::Count:
+                _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                    column_index, *base_segment, group_indices, job_id, group_count);
+                break;
+              case AggregateFunction::CountDistinct:
+                _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
+                    column_index, *base_segment, group_indices, job_id, group_count);
+                break;
+            }
+          });
+
           ++column_index;
-          continue;
         }
+      }
 
-        auto base_segment = chunk_in->get_segment(*aggregate.column);
-        auto data_type = input_table->column_data_type(*aggregate.column);
+      pre_aggregation.group_indices_by_partition.resize(partition_count);
+      for (auto group_index = uint32_t{0}; group_index < pre_aggregation.hash_table.size(); ++group_index) {
+        const auto partition_id = partition_of_hash(pre_aggregation.hash_table.hash(group_index));
+        pre_aggregation.group_indices_by_partition[partition_id].emplace_back(group_index);
+      }
+      pre_aggregation.output_row_indices.resize(pre_aggregation.hash_table.size());
+    }));
+  }
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  jobs.clear();
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate.function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, column_index,
-                                                                                         *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, column_index, *base_segment, keys_per_chunk);
-              break;
-          }
-        });
+  // Merge the groups of each partition. Within a partition, the groups are numbered in the order of their first
+  // occurrence.
+  auto row_ids_per_partition = std::vector<PosList>(partition_count);
 
-        ++column_index;
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto max_group_count = size_t{0};
+      for (const auto& pre_aggregation : pre_aggregations) {
+        max_group_count += pre_aggregation->group_indices_by_partition[partition_id].size();
       }
-    }
+
+      auto hash_table = AggregateHashTable<AggregateKey>{max_group_count};
+      auto& row_ids = row_ids_per_partition[partition_id];
+
+      for (auto& pre_aggregation : pre_aggregations) {
+        for (const auto group_index : pre_aggregation->group_indices_by_partition[partition_id]) {
+          const auto [partition_group_index, inserted] = hash_table.find_or_insert(
+              pre_aggregation->hash_table.key(group_index), pre_aggregation->hash_table.hash(group_index));
+          if (inserted) row_ids.emplace_back(pre_aggregation->row_ids[group_index]);
+          pre_aggregation->output_row_indices[group_index] = partition_group_index;
+        }
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  jobs.clear();
+
+  // The partitions are written to the output one after another
+  auto partition_offsets = std::vector<size_t>(partition_count);
+  auto group_count = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    partition_offsets[partition_id] = group_count;
+    group_count += row_ids_per_partition[partition_id].size();
   }
 
+  for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+    const auto& aggregate = _aggregates[column_index];
+    resolve_aggregate_context<AggregateKey>(aggregate, aggregate_data_type(aggregate),
+                                            *_contexts_per_column[column_index], [&](auto& context, auto) {
+                                              using Results = typename std::decay_t<decltype(*context.results)>;
+                                              context.results = std::make_shared<Results>(group_count);
+                                            });
+  }
+
+  auto row_ids = PosList(group_count);
+
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto partition_offset = partition_offsets[partition_id];
+
+      std::copy(row_ids_per_partition[partition_id].begin(), row_ids_per_partition[partition_id].end(),
+                row_ids.begin() + partition_offset);
+
+      for (auto& pre_aggregation : pre_aggregations) {
+        for (const auto group_index : pre_aggregation->group_indices_by_partition[partition_id]) {
+          pre_aggregation->output_row_indices[group_index] += partition_offset;
+        }
+      }
+
+      for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+        const auto& aggregate = _aggregates[column_index];
+        resolve_aggregate_context<AggregateKey>(
+            aggregate, aggregate_data_type(aggregate), *_contexts_per_column[column_index],
+            [&](auto& context, auto function) {
+              auto& results = *context.results;
+
+              for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+                const auto& pre_aggregation = *pre_aggregations[job_id];
+                auto& job_results = context.results_per_job[job_id];
+
+                for (const auto group_index : pre_aggregation.group_indices_by_partition[partition_id]) {
+                  merge_aggregate_results<decltype(function)::value>(
+                      results[pre_aggregation.output_row_indices[group_index]], job_results[group_index]);
+                }
+              }
+            });
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  jobs.clear();
+
   // add group by columns
   for (const auto column_id : _groupby_column_ids) {
     _output_column_definitions.emplace_back(input_table->column_name(column_id),
@@ -550,24 +746,8 @@ void Aggregate::_aggregate() {
     _groupby_segments.push_back(groupby_segment);
     _output_segments.push_back(groupby_segment);
   }
-  /**
-   * Write group-by columns.
-   *
-   * 'results_per_column' always contains at least one element, since there are either GroupBy or Aggregate columns.
-   * However, we need to look only at the first element, because the keys for all columns are the same.
-   *
-   * The following loop is used for both, actual GroupBy columns and DISTINCT columns.
-   **/
-  if (_aggregates.empty()) {
-    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-        _contexts_per_column[0]);
-    auto pos_list = PosList();
-    pos_list.reserve(context->results->size());
-    for (auto& map : *context->results) {
-      pos_list.push_back(map.second.row_id);
-    }
-    _write_groupby_output(pos_list);
-  }
+
+  _write_groupby_output(row_ids);
 
   /*
   Write the aggregated columns to the output
@@ -623,9 +803,7 @@ template <typename ColumnType, typename AggregateType, AggregateFunction func, t
 std::enable_if_t<func == AggregateFunction::Min || func == AggregateFunction::Max || func == AggregateFunction::Sum,
                  void>
 write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>> segment,
-                       std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>,
-                                                          std::hash<AggregateKey>>>
-                           results) {
+                       std::shared_ptr<AggregateResults<AggregateType, ColumnType>> results) {
   DebugAssert(segment->is_nullable(), "Aggregate: Output segment needs to be nullable");
 
   auto& values = segment->values();
@@ -635,11 +813,11 @@ write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>> segment,
   null_values.resize(results->size());
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+  for (auto& result : *results) {
+    null_values[i] = !result.current_aggregate;
 
-    if (kv.second.current_aggregate) {
-      values[i] = *kv.second.current_aggregate;
+    if (result.current_aggregate) {
+      values[i] = *result.current_aggregate;
     }
     ++i;
   }
@@ -649,17 +827,15 @@ write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>> segment,
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 std::enable_if_t<func == AggregateFunction::Count, void> write_aggregate_values(
     std::shared_ptr<ValueSegment<AggregateType>> segment,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-        results) {
+    std::shared_ptr<AggregateResults<AggregateType, ColumnType>> results) {
   DebugAssert(!segment->is_nullable(), "Aggregate: Output segment for COUNT shouldn't be nullable");
 
   auto& values = segment->values();
   values.resize(results->size());
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    values[i] = kv.second.aggregate_count;
+  for (auto& result : *results) {
+    values[i] = result.aggregate_count;
     ++i;
   }
 }
@@ -668,17 +844,15 @@ std::enable_if_t<func == AggregateFunction::Count, void> write_aggregate_values(
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 std::enable_if_t<func == AggregateFunction::CountDistinct, void> write_aggregate_values(
     std::shared_ptr<ValueSegment<AggregateType>> segment,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-        results) {
+    std::shared_ptr<AggregateResults<AggregateType, ColumnType>> results) {
   DebugAssert(!segment->is_nullable(), "Aggregate: Output segment for COUNT shouldn't be nullable");
 
   auto& values = segment->values();
   values.resize(results->size());
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    values[i] = kv.second.distinct_values.size();
+  for (auto& result : *results) {
+    values[i] = result.distinct_values.size();
     ++i;
   }
 }
@@ -687,9 +861,7 @@ std::enable_if_t<func == AggregateFunction::CountDistinct, void> write_aggregate
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<AggregateType>, void> write_aggregate_values(
     std::shared_ptr<ValueSegment<AggregateType>> segment,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-        results) {
+    std::shared_ptr<AggregateResults<AggregateType, ColumnType>> results) {
   DebugAssert(segment->is_nullable(), "Aggregate: Output segment needs to be nullable");
 
   auto& values = segment->values();
@@ -699,11 +871,11 @@ std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<Aggregat
   null_values.resize(results->size());
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+  for (auto& result : *results) {
+    null_values[i] = !result.current_aggregate;
 
-    if (kv.second.current_aggregate) {
-      values[i] = *kv.second.current_aggregate / static_cast<AggregateType>(kv.second.aggregate_count);
+    if (result.current_aggregate) {
+      values[i] = *result.current_aggregate / static_cast<AggregateType>(result.aggregate_count);
     }
     ++i;
   }
@@ -712,9 +884,7 @@ std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<Aggregat
 // AVG is not defined for non-arithmetic types. Avoiding compiler errors.
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 std::enable_if_t<func == AggregateFunction::Avg && !std::is_arithmetic_v<AggregateType>, void> write_aggregate_values(
-    std::shared_ptr<ValueSegment<AggregateType>>,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>) {
+    std::shared_ptr<ValueSegment<AggregateType>>, std::shared_ptr<AggregateResults<AggregateType, ColumnType>>) {
   Fail("Invalid aggregate");
 }
 
@@ -794,16 +964,6 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   auto context = std::static_pointer_cast<AggregateContext<ColumnType, decltype(aggregate_type), AggregateKey>>(
       _contexts_per_column[column_index]);
 
-  // write all group keys into the respective columns
-  if (column_index == 0) {
-    auto pos_list = PosList();
-    pos_list.reserve(context->results->size());
-    for (auto& map : *context->results) {
-      pos_list.push_back(map.second.row_id);
-    }
-    _write_groupby_output(pos_list);
-  }
-
   // write aggregated values into the segment
   if (!context->results->empty()) {
     write_aggregate_values<ColumnType, decltype(aggregate_type), function, AggregateKey>(output_segment,
@@ -821,28 +981,30 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
 
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(const DataType data_type,
-                                                                            const AggregateFunction function) const {
+                                                                            const AggregateFunction function,
+                                                                            const size_t job_count) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
     switch (function) {
       case AggregateFunction::Min:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Min, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Min, AggregateKey>(job_count);
         break;
       case AggregateFunction::Max:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Max, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Max, AggregateKey>(job_count);
         break;
       case AggregateFunction::Sum:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Sum, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Sum, AggregateKey>(job_count);
         break;
       case AggregateFunction::Avg:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Avg, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Avg, AggregateKey>(job_count);
         break;
       case AggregateFunction::Count:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Count, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Count, AggregateKey>(job_count);
         break;
       case AggregateFunction::CountDistinct:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>();
+        context =
+            _create_aggregate_context_impl<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(job_count);
         break;
     }
   });
@@ -850,10 +1012,10 @@ std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(cons
 }
 
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context_impl() const {
+std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context_impl(const size_t job_count) const {
   const auto context = std::make_shared<AggregateContext<
       ColumnDataType, typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType, AggregateKey>>();
-  context->results = std::make_shared<typename decltype(context->results)::element_type>();
+  context->results_per_job.resize(job_count);
   return context;
 }
 
@@ -57,9 +57,14 @@ struct AggregateResult {
   std::optional<AggregateType> current_aggregate;
   size_t aggregate_count = 0;
   std::set<ColumnDataType> distinct_values;
-  RowID row_id;
 };
 
+/*
+The results of all groups, indexed by the group index (see AggregateHashTable).
+*/
+template <typename AggregateType, typename ColumnDataType>
+using AggregateResults = std::vector<AggregateResult<AggregateType, ColumnDataType>>;
+
 /*
 The key type that is used for the aggregation map.
 */
@@ -72,12 +77,10 @@ template <typename AggregateKey>
 using KeysPerChunk = pmr_vector<AggregateKeys<AggregateKey>>;
 
 /**
- * Types that are used for the special COUNT(*) and DISTINCT implementations
+ * Types that are used for the special COUNT(*) implementation
  */
 using CountColumnType = int32_t;
 using CountAggregateType = int64_t;
-using DistinctColumnType = int8_t;
-using DistinctAggregateType = int8_t;
 
 /**
  * Note: Aggregate does not support null values at the moment
@@ -97,6 +100,12 @@ class Aggregate : public AbstractReadOnlyOperator {
   template <typename ColumnType, AggregateFunction function, typename AggregateKey>
   void write_aggregate_output(ColumnID column_index);
 
+  // Number of rows that are pre-aggregated by a single job before the groups of all jobs are merged
+  static constexpr size_t ROWS_PER_PRE_AGGREGATION_JOB = 65'536;
+
+  // The groups are merged in up to 2^MAX_PARTITION_BITS radix partitions in parallel
+  static constexpr size_t MAX_PARTITION_BITS = 8;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -118,15 +127,16 @@ class Aggregate : public AbstractReadOnlyOperator {
   void _write_groupby_output(PosList& pos_list);
 
   template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+  void _aggregate_segment(ColumnID column_index, const BaseSegment& base_segment,
+                          const std::vector<uint32_t>& group_indices, size_t job_id, size_t group_count);
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction function) const;
+                                                                   const AggregateFunction function,
+                                                                   const size_t job_count) const;
 
   template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-  std::shared_ptr<SegmentVisitorContext> _create_aggregate_context_impl() const;
+  std::shared_ptr<SegmentVisitorContext> _create_aggregate_context_impl(const size_t job_count) const;
 
   const std::vector<AggregateColumnDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
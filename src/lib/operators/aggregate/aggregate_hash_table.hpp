@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Hash of an AggregateKey as used by the AggregateHashTable. std::hash is the identity for integers, which is what
+ * most AggregateKeys are. Fibonacci hashing spreads them over all 64 bits, so that the upper bits can be used for the
+ * radix partitioning of the groups and the lower bits for the slot index.
+ */
+template <typename AggregateKey>
+uint64_t hash_aggregate_key(const AggregateKey& key) {
+  return static_cast<uint64_t>(std::hash<AggregateKey>{}(key)) * 11400714819323198485ull;
+}
+
+/**
+ * Maps the AggregateKeys of the groups to group indices. Group indices are assigned consecutively (0, 1, 2, ...) in the
+ * order in which the groups are inserted, so that the aggregate results of the groups can be kept in plain vectors.
+ *
+ * The slots are a power-of-two sized array that is probed linearly. Each slot holds the lower bits of the hash and the
+ * group index, so that most mismatches are detected without comparing the keys. The maximum number of groups has to be
+ * known upfront, the table is sized for twice as many slots and never grows.
+ */
+template <typename AggregateKey>
+class AggregateHashTable {
+ public:
+  explicit AggregateHashTable(const size_t max_group_count) {
+    auto slot_count = size_t{2};
+    while (slot_count < 2 * max_group_count) slot_count *= 2;
+
+    _slots.resize(slot_count, Slot{0, INVALID_GROUP_INDEX});
+    _slot_index_mask = slot_count - 1;
+    _max_group_count = max_group_count;
+  }
+
+  /**
+   * Returns the group index of the key and whether the group was newly inserted. The hash has to be computed by
+   * hash_aggregate_key().
+   */
+  std::pair<uint32_t, bool> find_or_insert(const AggregateKey& key, const uint64_t hash) {
+    const auto hash_fragment = static_cast<uint32_t>(hash);
+
+    for (auto slot_index = _slot_index(hash);; slot_index = (slot_index + 1) & _slot_index_mask) {
+      auto& slot = _slots[slot_index];
+
+      if (slot.group_index == INVALID_GROUP_INDEX) {
+        DebugAssert(_keys.size() < _max_group_count, "Inserted more groups than the hash table was sized for");
+
+        slot = Slot{hash_fragment, static_cast<uint32_t>(_keys.size())};
+        _keys.emplace_back(key);
+        _hashes.emplace_back(hash);
+        return {slot.group_index, true};
+      }
+
+      if (slot.hash_fragment == hash_fragment && _keys[slot.group_index] == key) return {slot.group_index, false};
+    }
+  }
+
+  size_t size() const { return _keys.size(); }
+
+  const AggregateKey& key(const uint32_t group_index) const { return _keys[group_index]; }
+
+  uint64_t hash(const uint32_t group_index) const { return _hashes[group_index]; }
+
+ private:
+  static constexpr auto INVALID_GROUP_INDEX = std::numeric_limits<uint32_t>::max();
+
+  struct Slot {
+    uint32_t hash_fragment;
+    uint32_t group_index;
+  };
+
+  // The upper bits of the hash are shared by all groups of a radix partition, so they are folded into the lower bits
+  size_t _slot_index(const uint64_t hash) const { return static_cast<size_t>(hash ^ (hash >> 32)) & _slot_index_mask; }
+
+  std::vector<Slot> _slots;
+  size_t _slot_index_mask;
+  size_t _max_group_count;
+
+  // One entry per group
+  std::vector<AggregateKey> _keys;
+  std::vector<uint64_t> _hashes;
+};
+
+}  // namespace opossum
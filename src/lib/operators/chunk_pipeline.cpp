@@ -0,0 +1,698 @@
+#include "chunk_pipeline.hpp"
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "aggregate/aggregate_hash_table.hpp"
+#include "aggregate/aggregate_traits.hpp"
+#include "constant_mappings.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/pqp_select_expression.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "table_scan.hpp"
+#include "table_scan/base_table_scan_impl.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+namespace {
+
+/**
+ * The aggregate results of the groups of one AggregateColumnDefinition, indexed by the group index. Each chunk
+ * aggregates into its own results, which are merged afterwards.
+ */
+class BaseAggregateResults {
+ public:
+  virtual ~BaseAggregateResults() = default;
+
+  virtual void resize(const size_t group_count) = 0;
+
+  // Aggregates the values of the segment, the n-th row of which belongs to the group group_indices[n]. Without a
+  // segment (i.e., for COUNT(*)), the rows are counted.
+  virtual void aggregate(const std::shared_ptr<const BaseSegment>& segment,
+                         const std::vector<uint32_t>& group_indices) = 0;
+
+  // Merges the results into merged_results, where the n-th group has the index merged_group_indices[n]
+  virtual void merge_into(BaseAggregateResults& merged_results,
+                          const std::vector<uint32_t>& merged_group_indices) const = 0;
+
+  virtual DataType data_type() const = 0;
+
+  virtual std::shared_ptr<BaseSegment> create_output_segment() const = 0;
+};
+
+template <typename ColumnDataType, AggregateFunction function>
+class AggregateResultsImpl : public BaseAggregateResults {
+ public:
+  using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
+
+  static constexpr bool NEEDS_NULL =
+      function != AggregateFunction::Count && function != AggregateFunction::CountDistinct;
+
+  void resize(const size_t group_count) final { _results.resize(group_count); }
+
+  void aggregate(const std::shared_ptr<const BaseSegment>& segment, const std::vector<uint32_t>& group_indices) final {
+    if (!segment) {
+      for (const auto group_index : group_indices) {
+        ++_results[group_index].aggregate_count;
+      }
+      return;
+    }
+
+    resolve_segment_type<ColumnDataType>(*segment, [&](const auto& typed_segment) {
+      auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
+
+      auto row_index = size_t{0};
+      iterable.for_each([&](const auto& value) {
+        auto& result = _results[group_indices[row_index]];
+        ++row_index;
+
+        if (value.is_null()) return;
+
+        if constexpr (function == AggregateFunction::Min) {
+          if (!result.current_aggregate || value_smaller(value.value(), *result.current_aggregate)) {
+            result.current_aggregate = value.value();
+          }
+        } else if constexpr (function == AggregateFunction::Max) {
+          if (!result.current_aggregate || value_greater(value.value(), *result.current_aggregate)) {
+            result.current_aggregate = value.value();
+          }
+        } else if constexpr ((function == AggregateFunction::Sum || function == AggregateFunction::Avg) &&
+                             std::is_arithmetic_v<ColumnDataType>) {
+          if (result.current_aggregate) {
+            *result.current_aggregate += value.value();
+          } else {
+            result.current_aggregate = value.value();
+          }
+        } else if constexpr (function == AggregateFunction::CountDistinct) {
+          result.distinct_values.insert(value.value());
+        }
+
+        ++result.aggregate_count;
+      });
+    });
+  }
+
+  void merge_into(BaseAggregateResults& merged_results,
+                  const std::vector<uint32_t>& merged_group_indices) const final {
+    auto& results = static_cast<AggregateResultsImpl&>(merged_results)._results;
+
+    for (auto group_index = size_t{0}; group_index < _results.size(); ++group_index) {
+      const auto& partial_result = _results[group_index];
+      auto& result = results[merged_group_indices[group_index]];
+
+      if (partial_result.current_aggregate) {
+        if (!result.current_aggregate) {
+          result.current_aggregate = partial_result.current_aggregate;
+        } else if constexpr (function == AggregateFunction::Min) {
+          if (value_smaller(*partial_result.current_aggregate, *result.current_aggregate)) {
+            result.current_aggregate = partial_result.current_aggregate;
+          }
+        } else if constexpr (function == AggregateFunction::Max) {
+          if (value_greater(*partial_result.current_aggregate, *result.current_aggregate)) {
+            result.current_aggregate = partial_result.current_aggregate;
+          }
+        } else if constexpr ((function == AggregateFunction::Sum || function == AggregateFunction::Avg) &&
+                             std::is_arithmetic_v<ColumnDataType>) {
+          *result.current_aggregate += *partial_result.current_aggregate;
+        }
+      }
+
+      result.aggregate_count += partial_result.aggregate_count;
+
+      if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
+        result.distinct_values.insert(partial_result.distinct_values.begin(), partial_result.distinct_values.end());
+      }
+    }
+  }
+
+  DataType data_type() const final { return AggregateTraits<ColumnDataType, function>::AGGREGATE_DATA_TYPE; }
+
+  std::shared_ptr<BaseSegment> create_output_segment() const final {
+    auto segment = std::make_shared<ValueSegment<AggregateType>>(NEEDS_NULL);
+    auto& values = segment->values();
+
+    for (const auto& result : _results) {
+      if constexpr (function == AggregateFunction::Count) {
+        values.push_back(result.aggregate_count);
+      } else if constexpr (function == AggregateFunction::CountDistinct) {
+        values.push_back(result.distinct_values.size());
+      } else {
+        segment->null_values().push_back(!result.current_aggregate);
+
+        if (!result.current_aggregate) {
+          values.push_back(AggregateType{});
+        } else if constexpr (function == AggregateFunction::Avg && std::is_arithmetic_v<AggregateType>) {
+          values.push_back(*result.current_aggregate / static_cast<AggregateType>(result.aggregate_count));
+        } else {
+          values.push_back(*result.current_aggregate);
+        }
+      }
+    }
+
+    return segment;
+  }
+
+ private:
+  AggregateResults<AggregateType, ColumnDataType> _results;
+};
+
+std::unique_ptr<BaseAggregateResults> create_aggregate_results(const DataType data_type,
+                                                               const AggregateFunction function) {
+  auto results = std::unique_ptr<BaseAggregateResults>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (function) {
+      case AggregateFunction::Min:
+        results = std::make_unique<AggregateResultsImpl<ColumnDataType, AggregateFunction::Min>>();
+        break;
+      case AggregateFunction::Max:
+        results = std::make_unique<AggregateResultsImpl<ColumnDataType, AggregateFunction::Max>>();
+        break;
+      case AggregateFunction::Sum:
+        results = std::make_unique<AggregateResultsImpl<ColumnDataType, AggregateFunction::Sum>>();
+        break;
+      case AggregateFunction::Avg:
+        results = std::make_unique<AggregateResultsImpl<ColumnDataType, AggregateFunction::Avg>>();
+        break;
+      case AggregateFunction::Count:
+        results = std::make_unique<AggregateResultsImpl<ColumnDataType, AggregateFunction::Count>>();
+        break;
+      case AggregateFunction::CountDistinct:
+        results = std::make_unique<AggregateResultsImpl<ColumnDataType, AggregateFunction::CountDistinct>>();
+        break;
+    }
+  });
+
+  return results;
+}
+
+/**
+ * The distinct values of a group-by column. As in the Aggregate operator, the AggregateKeys of the groups consist of
+ * one value ID per group-by column, with 0 standing for NULL. Thus, all NULLs of a column form a single group. Each
+ * chunk assigns its own value IDs, which are translated into those of the merged values when the chunks are merged.
+ */
+class BaseGroupByValues {
+ public:
+  virtual ~BaseGroupByValues() = default;
+
+  // Writes the value ID of the n-th row of the segment to value_ids[n]
+  virtual void assign_value_ids(const BaseSegment& segment, std::vector<AggregateKeyEntry>& value_ids) = 0;
+
+  // Adds the values to merged_values and returns the value IDs they have there, indexed by their value ID here
+  virtual std::vector<AggregateKeyEntry> merge_into(BaseGroupByValues& merged_values) const = 0;
+
+  // Creates a segment with the value of each of the value IDs
+  virtual std::shared_ptr<BaseSegment> create_output_segment(const std::vector<AggregateKeyEntry>& value_ids) const = 0;
+};
+
+template <typename ColumnDataType>
+class GroupByValuesImpl : public BaseGroupByValues {
+ public:
+  void assign_value_ids(const BaseSegment& segment, std::vector<AggregateKeyEntry>& value_ids) final {
+    resolve_segment_type<ColumnDataType>(segment, [&](const auto& typed_segment) {
+      auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
+
+      auto row_index = size_t{0};
+      iterable.for_each([&](const auto& value) {
+        value_ids[row_index] = value.is_null() ? AggregateKeyEntry{0} : _value_id(value.value());
+        ++row_index;
+      });
+    });
+  }
+
+  std::vector<AggregateKeyEntry> merge_into(BaseGroupByValues& merged_values) const final {
+    auto& merged = static_cast<GroupByValuesImpl&>(merged_values);
+
+    auto merged_value_ids = std::vector<AggregateKeyEntry>{};
+    merged_value_ids.reserve(_values.size() + 1);
+    merged_value_ids.emplace_back(AggregateKeyEntry{0});
+    for (const auto& value : _values) {
+      merged_value_ids.emplace_back(merged._value_id(value));
+    }
+    return merged_value_ids;
+  }
+
+  std::shared_ptr<BaseSegment> create_output_segment(const std::vector<AggregateKeyEntry>& value_ids) const final {
+    auto segment = std::make_shared<ValueSegment<ColumnDataType>>(true);
+    auto& values = segment->values();
+    auto& null_values = segment->null_values();
+    values.reserve(value_ids.size());
+    null_values.reserve(value_ids.size());
+
+    for (const auto value_id : value_ids) {
+      null_values.push_back(value_id == 0);
+      values.push_back(value_id == 0 ? ColumnDataType{} : _values[value_id - 1]);
+    }
+
+    return segment;
+  }
+
+ private:
+  AggregateKeyEntry _value_id(const ColumnDataType& value) {
+    const auto [iter, inserted] = _value_ids.try_emplace(value, static_cast<AggregateKeyEntry>(_values.size() + 1));
+    if (inserted) _values.emplace_back(value);
+    return iter->second;
+  }
+
+  std::unordered_map<ColumnDataType, AggregateKeyEntry> _value_ids;
+
+  // The value with the ID n is stored at _values[n - 1]
+  std::vector<ColumnDataType> _values;
+};
+
+std::unique_ptr<BaseGroupByValues> create_groupby_values(const DataType data_type) {
+  auto groupby_values = std::unique_ptr<BaseGroupByValues>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    groupby_values = std::make_unique<GroupByValuesImpl<ColumnDataType>>();
+  });
+
+  return groupby_values;
+}
+
+// Creates an AggregateKey for the given number of group-by columns, with all value IDs being 0
+template <typename AggregateKey>
+AggregateKey create_aggregate_key(const size_t groupby_column_count) {
+  if constexpr (std::is_same_v<AggregateKey, pmr_vector<AggregateKeyEntry>>) {
+    return AggregateKey(groupby_column_count);
+  } else {
+    return AggregateKey{};
+  }
+}
+
+// The value ID of the group-by column groupby_column_idx in the key. AggregateKey may be const.
+template <typename AggregateKey>
+auto& aggregate_key_entry(AggregateKey& key, const size_t groupby_column_idx) {
+  if constexpr (std::is_same_v<std::remove_const_t<AggregateKey>, AggregateKeyEntry>) {
+    return key;
+  } else {
+    return key[groupby_column_idx];
+  }
+}
+
+// What remains of a chunk after it was pushed through the pipeline
+template <typename AggregateKey>
+struct ChunkPipelineResult {
+  // Without an Aggregate: the projected segments
+  Segments segments;
+
+  // With an Aggregate: the groups of the chunk, the values of the group-by columns that the keys of the groups refer
+  // to, and the pre-aggregated results of the groups
+  std::vector<AggregateKey> group_keys;
+  std::vector<std::unique_ptr<BaseGroupByValues>> groupby_values;
+  std::vector<std::unique_ptr<BaseAggregateResults>> aggregate_results;
+};
+
+}  // namespace
+
+ChunkPipeline::ChunkPipeline(const std::shared_ptr<const AbstractOperator>& in,
+                             const std::vector<OperatorScanPredicate>& predicates,
+                             const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                             const std::vector<AggregateColumnDefinition>& aggregates,
+                             const std::vector<ColumnID>& groupby_column_ids)
+    : AbstractReadOnlyOperator(OperatorType::ChunkPipeline, in),
+      _predicates(predicates),
+      _expressions(expressions),
+      _aggregates(aggregates),
+      _groupby_column_ids(groupby_column_ids) {
+  Assert(!_expressions.empty() || has_aggregate(), "A ChunkPipeline has to end with a Projection or an Aggregate");
+}
+
+const std::string ChunkPipeline::name() const { return "ChunkPipeline"; }
+
+const std::string ChunkPipeline::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream desc;
+  desc << "[ChunkPipeline]";
+
+  if (!_predicates.empty()) {
+    desc << separator << "Predicates: ";
+    for (auto predicate_idx = size_t{0}; predicate_idx < _predicates.size(); ++predicate_idx) {
+      desc << _predicates[predicate_idx].to_string(input_table_left());
+      if (predicate_idx + 1 < _predicates.size()) desc << ", ";
+    }
+  }
+
+  if (!_expressions.empty()) {
+    desc << separator << "Expressions: " << expression_column_names(_expressions);
+  }
+
+  if (has_aggregate()) {
+    desc << separator << "GroupBy ColumnIDs: ";
+    for (auto groupby_column_idx = size_t{0}; groupby_column_idx < _groupby_column_ids.size(); ++groupby_column_idx) {
+      desc << _groupby_column_ids[groupby_column_idx];
+      if (groupby_column_idx + 1 < _groupby_column_ids.size()) desc << ", ";
+    }
+
+    desc << " Aggregates: ";
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+      const auto& aggregate = _aggregates[aggregate_idx];
+      desc << aggregate_function_to_string.left.at(aggregate.function);
+
+      if (aggregate.column) {
+        desc << "(Column #" << *aggregate.column << ")";
+      } else {
+        desc << "(*)";
+      }
+
+      if (aggregate_idx + 1 < _aggregates.size()) desc << ", ";
+    }
+  }
+
+  return desc.str();
+}
+
+const std::vector<OperatorScanPredicate>& ChunkPipeline::predicates() const { return _predicates; }
+
+const std::vector<std::shared_ptr<AbstractExpression>>& ChunkPipeline::expressions() const { return _expressions; }
+
+const std::vector<AggregateColumnDefinition>& ChunkPipeline::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& ChunkPipeline::groupby_column_ids() const { return _groupby_column_ids; }
+
+bool ChunkPipeline::has_aggregate() const { return !_aggregates.empty() || !_groupby_column_ids.empty(); }
+
+std::shared_ptr<AbstractOperator> ChunkPipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<ChunkPipeline>(copied_input_left, _predicates, expressions_deep_copy(_expressions),
+                                         _aggregates, _groupby_column_ids);
+}
+
+void ChunkPipeline::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  for (auto& predicate : _predicates) {
+    if (!is_parameter_id(predicate.value)) continue;
+
+    const auto value_iter = parameters.find(boost::get<ParameterID>(predicate.value));
+    if (value_iter == parameters.end()) continue;
+
+    predicate.value = value_iter->second;
+  }
+
+  expressions_set_parameters(_expressions, parameters);
+}
+
+void ChunkPipeline::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expressions_set_transaction_context(_expressions, transaction_context);
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_on_execute() {
+  // As in the Aggregate operator, the group-by values of a row are combined into an AggregateKey of fixed size where
+  // possible, see Aggregate::_on_execute()
+  switch (has_aggregate() ? _groupby_column_ids.size() : 0) {
+    case 0:
+    case 1:
+      return _execute<AggregateKeyEntry>();
+    case 2:
+      return _execute<std::array<AggregateKeyEntry, 2>>();
+    default:
+      PerformanceWarning("No std::array implementation initialized - falling back to vector");
+      return _execute<pmr_vector<AggregateKeyEntry>>();
+  }
+}
+
+template <typename AggregateKey>
+std::shared_ptr<const Table> ChunkPipeline::_execute() {
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  // The columns that the Projection produces and that the Aggregate reads
+  auto projected_column_definitions = TableColumnDefinitions{};
+  if (_expressions.empty()) {
+    projected_column_definitions = input_table->column_definitions();
+  } else {
+    for (const auto& expression : _expressions) {
+      projected_column_definitions.emplace_back(expression->as_column_name(), expression->data_type(),
+                                                expression->is_nullable());
+    }
+  }
+
+  for (const auto& aggregate : _aggregates) {
+    if (aggregate.function != AggregateFunction::Sum && aggregate.function != AggregateFunction::Avg) continue;
+    Assert(projected_column_definitions[*aggregate.column].data_type != DataType::String,
+           "SUM and AVG are not defined for strings");
+  }
+
+  // As in the Projection, uncorrelated subselects are executed once instead of once per chunk
+  auto uncorrelated_select_results = std::make_shared<ExpressionEvaluator::UncorrelatedSelectResults>();
+  {
+    auto evaluator = ExpressionEvaluator{};
+    for (const auto& expression : _expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        const auto pqp_select_expression = std::dynamic_pointer_cast<PQPSelectExpression>(sub_expression);
+        if (pqp_select_expression && !pqp_select_expression->is_correlated()) {
+          auto result = evaluator.evaluate_uncorrelated_select_expression(*pqp_select_expression);
+          uncorrelated_select_results->emplace(pqp_select_expression->pqp, std::move(result));
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+  }
+
+  // The first scan reads the input table and is shared by all chunks. The following scans read the matches of the
+  // previous scan in the chunk, so their impls are created per chunk.
+  const auto first_scan_impl =
+      _predicates.empty() ? nullptr : TableScan::create_impl(input_table, _predicates.front());
+
+  auto results_by_chunk = std::vector<ChunkPipelineResult<AggregateKey>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (input_table->get_chunk(chunk_id)->size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& chunk_result = results_by_chunk[chunk_id];
+
+      /**
+       * TableScans: The matches of each scan are wrapped in a table with a single chunk, which the next stage reads
+       */
+      auto table = input_table;
+      auto table_chunk_id = chunk_id;
+
+      for (auto predicate_idx = size_t{0}; predicate_idx < _predicates.size(); ++predicate_idx) {
+        const auto matches = predicate_idx == 0
+                                 ? first_scan_impl->scan_chunk(chunk_id)
+                                 : TableScan::create_impl(table, _predicates[predicate_idx])->scan_chunk(ChunkID{0});
+        if (matches->empty()) return;
+
+        auto matches_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+        matches_table->append_chunk(TableScan::create_output_segments(table, table_chunk_id, matches));
+        table = matches_table;
+        table_chunk_id = ChunkID{0};
+      }
+
+      /**
+       * Projection: Columns that are only read by the Aggregate do not need to be materialized
+       */
+      const auto chunk = table->get_chunk(table_chunk_id);
+      const auto row_count = chunk->size();
+
+      auto segments = Segments{};
+      if (_expressions.empty()) {
+        for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+          segments.emplace_back(chunk->get_segment(column_id));
+        }
+      } else {
+        auto evaluator = ExpressionEvaluator{table, table_chunk_id, uncorrelated_select_results};
+        for (const auto& expression : _expressions) {
+          if (expression->type == ExpressionType::PQPColumn && has_aggregate()) {
+            const auto& pqp_column_expression = static_cast<const PQPColumnExpression&>(*expression);
+            segments.emplace_back(chunk->get_segment(pqp_column_expression.column_id));
+          } else {
+            segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
+          }
+        }
+      }
+
+      if (!has_aggregate()) {
+        chunk_result.segments = std::move(segments);
+        return;
+      }
+
+      /**
+       * Aggregate: The rows of the chunk are pre-aggregated into the groups of the chunk
+       */
+      const auto groupby_column_count = _groupby_column_ids.size();
+      auto keys = std::vector<AggregateKey>(row_count, create_aggregate_key<AggregateKey>(groupby_column_count));
+      auto value_ids = std::vector<AggregateKeyEntry>{};
+
+      for (auto groupby_column_idx = size_t{0}; groupby_column_idx < groupby_column_count; ++groupby_column_idx) {
+        const auto column_id = _groupby_column_ids[groupby_column_idx];
+        auto groupby_values = create_groupby_values(projected_column_definitions[column_id].data_type);
+
+        if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+          // With a single group-by column, the value IDs are the keys
+          groupby_values->assign_value_ids(*segments[column_id], keys);
+        } else {
+          value_ids.resize(row_count);
+          groupby_values->assign_value_ids(*segments[column_id], value_ids);
+          for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+            keys[row_index][groupby_column_idx] = value_ids[row_index];
+          }
+        }
+
+        chunk_result.groupby_values.emplace_back(std::move(groupby_values));
+      }
+
+      auto groups = AggregateHashTable<AggregateKey>{row_count};
+      auto group_indices = std::vector<uint32_t>(row_count);
+      for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+        const auto& key = keys[row_index];
+        group_indices[row_index] = groups.find_or_insert(key, hash_aggregate_key(key)).first;
+      }
+
+      chunk_result.group_keys.reserve(groups.size());
+      for (auto group_index = uint32_t{0}; group_index < groups.size(); ++group_index) {
+        chunk_result.group_keys.emplace_back(groups.key(group_index));
+      }
+
+      for (const auto& aggregate : _aggregates) {
+        // COUNT(*) is specialized for the CountColumnType
+        const auto data_type =
+            aggregate.column ? projected_column_definitions[*aggregate.column].data_type : DataType::Int;
+
+        auto aggregate_results = create_aggregate_results(data_type, aggregate.function);
+        aggregate_results->resize(groups.size());
+        aggregate_results->aggregate(aggregate.column ? segments[*aggregate.column] : nullptr, group_indices);
+        chunk_result.aggregate_results.emplace_back(std::move(aggregate_results));
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  if (!has_aggregate()) {
+    auto output_table =
+        std::make_shared<Table>(projected_column_definitions, TableType::Data, input_table->max_chunk_size());
+    for (const auto& chunk_result : results_by_chunk) {
+      if (!chunk_result.segments.empty()) output_table->append_chunk(chunk_result.segments);
+    }
+    return output_table;
+  }
+
+  /**
+   * Merge the groups of all chunks, in the order of the chunks
+   */
+  auto max_group_count = size_t{1};
+  for (const auto& chunk_result : results_by_chunk) {
+    max_group_count += chunk_result.group_keys.size();
+  }
+
+  auto groups = AggregateHashTable<AggregateKey>{max_group_count};
+
+  // Without GROUP BY, there is exactly one group, even if there are no rows. Its aggregates are NULL, or 0 for COUNT.
+  if (_groupby_column_ids.empty()) {
+    const auto key = create_aggregate_key<AggregateKey>(0);
+    groups.find_or_insert(key, hash_aggregate_key(key));
+  }
+
+  auto groupby_values = std::vector<std::unique_ptr<BaseGroupByValues>>{};
+  for (const auto column_id : _groupby_column_ids) {
+    groupby_values.emplace_back(create_groupby_values(projected_column_definitions[column_id].data_type));
+  }
+
+  auto aggregate_results = std::vector<std::unique_ptr<BaseAggregateResults>>{};
+  for (const auto& aggregate : _aggregates) {
+    const auto data_type = aggregate.column ? projected_column_definitions[*aggregate.column].data_type : DataType::Int;
+    aggregate_results.emplace_back(create_aggregate_results(data_type, aggregate.function));
+  }
+
+  for (auto& chunk_result : results_by_chunk) {
+    // Chunks without matches have no groups
+    if (chunk_result.group_keys.empty()) continue;
+
+    // Translate the value IDs of the chunk into the merged ones
+    auto merged_value_ids = std::vector<std::vector<AggregateKeyEntry>>{};
+    for (auto groupby_column_idx = size_t{0}; groupby_column_idx < groupby_values.size(); ++groupby_column_idx) {
+      merged_value_ids.emplace_back(
+          chunk_result.groupby_values[groupby_column_idx]->merge_into(*groupby_values[groupby_column_idx]));
+    }
+
+    auto merged_group_indices = std::vector<uint32_t>{};
+    merged_group_indices.reserve(chunk_result.group_keys.size());
+    for (auto& key : chunk_result.group_keys) {
+      for (auto groupby_column_idx = size_t{0}; groupby_column_idx < groupby_values.size(); ++groupby_column_idx) {
+        auto& value_id = aggregate_key_entry(key, groupby_column_idx);
+        value_id = merged_value_ids[groupby_column_idx][value_id];
+      }
+      merged_group_indices.emplace_back(groups.find_or_insert(key, hash_aggregate_key(key)).first);
+    }
+
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+      aggregate_results[aggregate_idx]->resize(groups.size());
+      chunk_result.aggregate_results[aggregate_idx]->merge_into(*aggregate_results[aggregate_idx],
+                                                                merged_group_indices);
+    }
+
+    chunk_result = ChunkPipelineResult<AggregateKey>{};
+  }
+
+  /**
+   * Write the output, with the same columns as the Aggregate operator
+   */
+  auto output_column_definitions = TableColumnDefinitions{};
+  auto output_segments = Segments{};
+
+  for (auto groupby_column_idx = size_t{0}; groupby_column_idx < _groupby_column_ids.size(); ++groupby_column_idx) {
+    const auto& column_definition = projected_column_definitions[_groupby_column_ids[groupby_column_idx]];
+    output_column_definitions.emplace_back(column_definition.name, column_definition.data_type);
+
+    auto value_ids = std::vector<AggregateKeyEntry>(groups.size());
+    for (auto group_index = uint32_t{0}; group_index < groups.size(); ++group_index) {
+      value_ids[group_index] = aggregate_key_entry(groups.key(group_index), groupby_column_idx);
+    }
+    output_segments.emplace_back(groupby_values[groupby_column_idx]->create_output_segment(value_ids));
+  }
+
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    std::stringstream column_name_stream;
+    if (aggregate.function == AggregateFunction::CountDistinct) {
+      column_name_stream << "COUNT(DISTINCT ";
+    } else {
+      column_name_stream << aggregate_function_to_string.left.at(aggregate.function) << "(";
+    }
+    column_name_stream << (aggregate.column ? projected_column_definitions[*aggregate.column].name : "*") << ")";
+
+    const auto nullable =
+        aggregate.function != AggregateFunction::Count && aggregate.function != AggregateFunction::CountDistinct;
+
+    aggregate_results[aggregate_idx]->resize(groups.size());
+    output_column_definitions.emplace_back(column_name_stream.str(), aggregate_results[aggregate_idx]->data_type(),
+                                           nullable);
+    output_segments.emplace_back(aggregate_results[aggregate_idx]->create_output_segment());
+  }
+
+  auto output_table = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  output_table->append_chunk(output_segments);
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "aggregate.hpp"
+#include "operator_scan_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+
+/**
+ * Executes a chain of TableScans, a Projection, and an Aggregate chunk by chunk, without materializing the output
+ * tables of the intermediate operators. Each input chunk is pushed through all stages by a single job:
+ *
+ *     input chunk -> TableScans -> Projection -> pre-aggregation of the chunk's groups
+ *
+ * so that the matches and the projected segments of a chunk are consumed while they are still in the cache, and are
+ * dropped right after. Finally, the groups of all chunks are merged. Without an Aggregate, the projected chunks form
+ * the output.
+ *
+ * The stages use the same kernels as the operators they replace (BaseTableScanImpls, the ExpressionEvaluator, and
+ * typed segment iterables for the aggregates), so no code is generated at runtime as it is by the JitOperatorWrapper,
+ * and no LLVM is required.
+ *
+ * The predicates and the projection expressions refer to the columns of the input. The aggregates and group-by
+ * columns refer to the columns of the projection, or to those of the input if there are no projection expressions.
+ * The output is the same as that of the replaced operators. Use the ChunkPipelineAwareLQPTranslator to create
+ * ChunkPipelines.
+ */
+class ChunkPipeline : public AbstractReadOnlyOperator {
+ public:
+  ChunkPipeline(const std::shared_ptr<const AbstractOperator>& in, const std::vector<OperatorScanPredicate>& predicates,
+                const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                const std::vector<AggregateColumnDefinition>& aggregates = {},
+                const std::vector<ColumnID>& groupby_column_ids = {});
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<OperatorScanPredicate>& predicates() const;
+  const std::vector<std::shared_ptr<AbstractExpression>>& expressions() const;
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& groupby_column_ids() const;
+
+  // Whether the pipeline ends with an Aggregate, i.e., has aggregates or group-by columns
+  bool has_aggregate() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+ private:
+  // Executes the pipeline, grouping by AggregateKeys as the Aggregate operator does
+  template <typename AggregateKey>
+  std::shared_ptr<const Table> _execute();
+
+  std::vector<OperatorScanPredicate> _predicates;
+  const std::vector<std::shared_ptr<AbstractExpression>> _expressions;
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _groupby_column_ids;
+};
+
+}  // namespace opossum
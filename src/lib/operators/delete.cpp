@@ -39,9 +39,24 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
     _pos_lists.emplace_back(pos_list);
 
+    // Locking rows changes their visibility (at least for this transaction), so the visibility summaries used by
+    // Validate have to be invalidated. This must happen after the rows of a chunk are locked: a concurrent Validate
+    // that obtains the summary generation after the invalidation then sees the locked rows and stores no summary.
+    // Consecutive rows usually belong to the same chunk, so a chunk is invalidated once its run of rows ends.
+    auto locked_chunk_id = INVALID_CHUNK_ID;
+    const auto invalidate_locked_chunk = [&]() {
+      if (locked_chunk_id == INVALID_CHUNK_ID) return;
+      _table->get_chunk(locked_chunk_id)->get_scoped_mvcc_data_lock()->invalidate_visibility_summary();
+    };
+
     for (const auto& row_id : *pos_list) {
       auto referenced_chunk = _table->get_chunk(row_id.chunk_id);
 
+      if (row_id.chunk_id != locked_chunk_id) {
+        invalidate_locked_chunk();
+        locked_chunk_id = row_id.chunk_id;
+      }
+
       auto expected = 0u;
       // Actual row lock for delete happens here
       const auto success =
@@ -61,9 +76,12 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
       }
 
       // the row is already locked by someone else and the transaction needs to be rolled back
+      invalidate_locked_chunk();
       _mark_as_failed();
       return nullptr;
     }
+
+    invalidate_locked_chunk();
   }
 
   _num_rows_deleted = input_table_left()->row_count();
@@ -72,6 +90,8 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 }
 
 void Delete::_on_commit_records(const CommitID cid) {
+  _table->raise_last_modification_commit_id(cid);
+
   for (const auto& pos_list : _pos_lists) {
     for (const auto& row_id : *pos_list) {
       auto chunk = _table->get_chunk(row_id.chunk_id);
@@ -7,6 +7,7 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
@@ -24,7 +25,7 @@ class AbstractTypedSegmentProcessor : public Noncopyable {
   AbstractTypedSegmentProcessor(AbstractTypedSegmentProcessor&&) = default;
   AbstractTypedSegmentProcessor& operator=(AbstractTypedSegmentProcessor&&) = default;
   virtual ~AbstractTypedSegmentProcessor() = default;
-  virtual void resize_vector(std::shared_ptr<BaseSegment> segment, size_t new_size) = 0;
+  virtual void grow_vector(std::shared_ptr<BaseSegment> segment, size_t min_size) = 0;
   virtual void copy_data(std::shared_ptr<const BaseSegment> source, size_t source_start_index,
                          std::shared_ptr<BaseSegment> target, size_t target_start_index, size_t length) = 0;
 };
@@ -32,16 +33,17 @@ class AbstractTypedSegmentProcessor : public Noncopyable {
 template <typename T>
 class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
  public:
-  void resize_vector(std::shared_ptr<BaseSegment> segment, size_t new_size) override {
+  // Thread-safe, so that concurrent Inserts can grow the segment to the end of the rows they reserved
+  void grow_vector(std::shared_ptr<BaseSegment> segment, size_t min_size) override {
     auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment);
     DebugAssert(static_cast<bool>(value_segment), "Type mismatch");
-    auto& values = value_segment->values();
-
-    values.resize(new_size);
 
+    // Grow the null values first, as the size of the segment is the size of its values
     if (value_segment->is_nullable()) {
-      value_segment->null_values().resize(new_size);
+      value_segment->null_values().grow_to_at_least(min_size);
     }
+
+    value_segment->values().grow_to_at_least(min_size);
   }
 
   // this copies
@@ -118,76 +120,53 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
 
-  // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
-  // modifying the table's size simultaneously.
-  auto start_index = 0u;
-  auto start_chunk_id = ChunkID{0};
-  auto total_chunks_inserted = 0u;
-  {
-    auto scoped_lock = _target_table->acquire_append_mutex();
-
-    start_chunk_id = _target_table->chunk_count() - 1;
-    auto last_chunk = _target_table->get_chunk(start_chunk_id);
-    start_index = last_chunk->size();
-
-    // If last chunk is compressed, add a new uncompressed chunk
-    if (!last_chunk->is_mutable()) {
-      _target_table->append_mutable_chunk();
-      total_chunks_inserted++;
+  // First, reserve the rows to insert. Concurrent Inserts reserve disjoint rows without blocking each other, see
+  // Table::reserve_rows().
+  auto reservations = std::vector<Table::RowReservation>{};
+  for (auto remaining_rows = total_rows_to_insert; remaining_rows > 0;) {
+    const auto& reservation = reservations.emplace_back(_target_table->reserve_rows(remaining_rows));
+    remaining_rows -= reservation.row_count;
+
+    // Create the chunk that is appended once this one is full in the background, instead of when it is needed
+    if (reservation.appended_chunk) {
+      std::make_shared<JobTask>([target_table = _target_table]() { target_table->prepare_mutable_chunk(); })
+          ->schedule();
     }
+  }
 
-    auto remaining_rows = total_rows_to_insert;
-    while (remaining_rows > 0) {
-      auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
-      auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
-
-      // Resize MVCC vectors.
-      current_chunk->get_scoped_mvcc_data_lock()->grow_by(rows_to_insert_this_loop, MvccData::MAX_COMMIT_ID);
-
-      // Resize current chunk to full size.
-      auto old_size = current_chunk->size();
-      for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
-        typed_segment_processors[column_id]->resize_vector(current_chunk->get_segment(column_id),
-                                                           old_size + rows_to_insert_this_loop);
-      }
-
-      remaining_rows -= rows_to_insert_this_loop;
+  // Then, grow the chunks to include the reserved rows. Other Inserts might have grown them already or might grow them
+  // concurrently. The MVCC data is grown first, so that the new rows are invisible as soon as they exist. The first
+  // segment is grown last, as it determines the size of the chunk, which thus never exceeds the size of any segment.
+  for (const auto& reservation : reservations) {
+    const auto end = reservation.begin + reservation.row_count;
+    reservation.chunk->get_scoped_mvcc_data_lock()->grow_to_at_least(end, MvccData::MAX_COMMIT_ID);
 
-      // Create new chunk if necessary.
-      if (remaining_rows > 0) {
-        _target_table->append_mutable_chunk();
-        total_chunks_inserted++;
-      }
+    for (auto column_id = static_cast<ColumnID>(reservation.chunk->column_count()); column_id-- > 0;) {
+      typed_segment_processors[column_id]->grow_vector(reservation.chunk->get_segment(column_id), end);
     }
   }
   // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
-  // Then, actually insert the data.
-  auto input_offset = 0u;
+  // Finally, actually insert the data.
   auto source_chunk_id = ChunkID{0};
   auto source_chunk_start_index = 0u;
 
-  for (auto target_chunk_id = start_chunk_id; target_chunk_id <= start_chunk_id + total_chunks_inserted;
-       target_chunk_id++) {
-    auto target_chunk = _target_table->get_chunk(target_chunk_id);
-
-    const auto current_num_rows_to_insert =
-        std::min(target_chunk->size() - start_index, total_rows_to_insert - input_offset);
+  for (const auto& reservation : reservations) {
+    const auto& target_chunk = reservation.chunk;
+    const auto target_end_index = reservation.begin + reservation.row_count;
+    auto target_start_index = reservation.begin;
 
-    auto target_start_index = start_index;
-    auto still_to_insert = current_num_rows_to_insert;
-
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
+    // while the reserved rows are not filled
+    while (target_start_index != target_end_index) {
       const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
-      auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
+      auto num_to_insert =
+          std::min(source_chunk->size() - source_chunk_start_index, target_end_index - target_start_index);
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
         const auto& source_segment = source_chunk->get_segment(column_id);
         typed_segment_processors[column_id]->copy_data(source_segment, source_chunk_start_index,
                                                        target_chunk->get_segment(column_id), target_start_index,
                                                        num_to_insert);
       }
-      still_to_insert -= num_to_insert;
       target_start_index += num_to_insert;
       source_chunk_start_index += num_to_insert;
 
@@ -198,24 +177,24 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
-    for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
+    auto mvcc_data = target_chunk->get_scoped_mvcc_data_lock();
+    for (auto i = reservation.begin; i < target_end_index; i++) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
       // the transaction IDs are set here and not during the resize, because
       // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
       // deleted.
-      target_chunk->get_scoped_mvcc_data_lock()->tids[i] = context->transaction_id();
-      _inserted_rows.emplace_back(RowID{target_chunk_id, i});
+      mvcc_data->tids[i] = context->transaction_id();
+      _inserted_rows.emplace_back(RowID{reservation.chunk_id, i});
     }
-
-    input_offset += current_num_rows_to_insert;
-    start_index = 0u;
   }
 
   return nullptr;
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
+  _target_table->raise_last_modification_commit_id(cid);
+
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
 
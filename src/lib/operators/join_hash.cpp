@@ -1,6 +1,5 @@
 #include "join_hash.hpp"
 
-#include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include <cmath>
@@ -12,7 +11,10 @@
 #include <utility>
 #include <vector>
 
+#include "join_hash/blocked_bloom_filter.hpp"
 #include "join_hash/hash_traits.hpp"
+#include "join_hash/open_addressing_hash_table.hpp"
+#include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
@@ -31,8 +33,9 @@ namespace opossum {
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-                   const size_t radix_bits)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
+                   const std::vector<OperatorJoinPredicate>& secondary_predicates, const size_t radix_bits)
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition,
+                           secondary_predicates),
       _radix_bits(radix_bits) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
 }
@@ -42,7 +45,8 @@ const std::string JoinHash::name() const { return "JoinHash"; }
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                    _secondary_predicates, _radix_bits);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -58,8 +62,9 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   // (2) for a semi and anti join the inputs are always swapped
   bool inputs_swapped = (_mode == JoinMode::Left || _mode == JoinMode::Anti || _mode == JoinMode::Semi);
 
-  // (3) else the smaller relation will become build relation, the larger probe relation
-  if (!inputs_swapped && _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
+  // (3) else the smaller relation will become build relation, the larger probe relation. For a right outer join, the
+  //     right relation has to remain the probe relation.
+  if (_mode == JoinMode::Inner && _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
     inputs_swapped = true;
   }
 
@@ -78,12 +83,22 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   auto adjusted_column_ids = std::make_pair(build_column_id, probe_column_id);
 
+  // The secondary predicates are evaluated on (build row, probe row) pairs
+  auto adjusted_secondary_predicates = _secondary_predicates;
+  if (inputs_swapped) {
+    for (auto& secondary_predicate : adjusted_secondary_predicates) {
+      std::swap(secondary_predicate.column_ids.first, secondary_predicate.column_ids.second);
+      secondary_predicate.predicate_condition = flip_predicate_condition(secondary_predicate.predicate_condition);
+    }
+  }
+
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
       build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), build_operator,
-      probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
+      probe_operator, _mode, adjusted_column_ids, _predicate_condition, adjusted_secondary_predicates, inputs_swapped,
+      _radix_bits);
   return _impl->_on_execute();
 }
 
@@ -112,13 +127,8 @@ template <typename T>
 using Partition = std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
                                      std::vector<PartitionedElement<T>>>;
 
-// The small_vector holds the first n values in local storage and only resorts to heap storage after that. 1 is chosen
-// as n because in many cases, we join on primary key attributes where by definition we have only one match on the
-// smaller side.
-using SmallPosList = boost::container::small_vector<RowID, 1>;
-
 template <typename T>
-using HashTable = std::unordered_map<T, SmallPosList>;
+using HashTable = OpenAddressingHashTable<T>;
 
 /*
 This struct contains radix-partitioned data in a contiguous buffer,
@@ -160,19 +170,15 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
                                                  partition_size]() {
       auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
 
-      // Potentially oversizing the hash table when values are often repeated.
-      // But rather have slightly too large hash tables than paying for complete rehashing/resizing.
+      // The partition size is known from the histograms, so the hash table never needs to be resized. It is oversized
+      // when values are often repeated, but rather that than paying for rehashing.
       auto hashtable = HashTable<HashedType>(partition_size);
 
       for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end; ++partition_offset) {
         auto& element = partition_left[partition_offset];
 
-        auto [it, inserted] =  // NOLINT
-            hashtable.try_emplace(type_cast<HashedType>(std::move(element.value)), SmallPosList{element.row_id});
-        if (!inserted) {
-          // We already have the value in the map
-          it->second.emplace_back(element.row_id);
-        }
+        // The hash computed for the radix partitioning is reused for the hash table
+        hashtable.insert(type_cast<HashedType>(std::move(element.value)), element.partition_hash, element.row_id);
       }
 
       hashtables[current_partition_id] = std::move(hashtable);
@@ -194,10 +200,18 @@ constexpr Hash hash_value(const OriginalType& value, const unsigned int seed) {
   return murmur2<HashedType>(type_cast<HashedType>(value), seed);
 }
 
+/*
+Materializes the join column. The hashes of all materialized values are inserted into bloom_filter_to_build, if given.
+Values whose hash is not contained in bloom_filter_to_probe are skipped, just like NULL values.
+*/
 template <typename T, typename HashedType>
 std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
                                                 std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                                const unsigned int partitioning_seed, bool keep_nulls = false) {
+                                                const unsigned int partitioning_seed, bool keep_nulls = false,
+                                                BlockedBloomFilter* bloom_filter_to_build = nullptr,
+                                                const BlockedBloomFilter* bloom_filter_to_probe = nullptr) {
+  DebugAssert(!keep_nulls || !bloom_filter_to_probe, "Cannot drop rows without a match when NULLs have to be kept");
+
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>(in_table->row_count());
 
@@ -240,8 +254,17 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
         auto iterable = create_iterable_from_segment<T>(typed_segment);
 
         iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
-          if (!value.is_null() || keep_nulls) {
-            const Hash hashed_value = hash_value<T, HashedType>(value.value(), partitioning_seed);
+          const Hash hashed_value =
+              !value.is_null() || keep_nulls ? hash_value<T, HashedType>(value.value(), partitioning_seed) : Hash{0};
+
+          // Values without a join partner are skipped like NULL values, their slots are filled with invalid elements
+          const auto has_join_partner =
+              !value.is_null() && (!bloom_filter_to_probe || bloom_filter_to_probe->may_contain(hashed_value));
+
+          if (has_join_partner || (value.is_null() && keep_nulls)) {
+            if (bloom_filter_to_build) {
+              bloom_filter_to_build->insert(hashed_value);
+            }
 
             /*
             For ReferenceSegments we do not use the RowIDs from the referenced tables.
@@ -362,7 +385,8 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
 template <typename RightType, typename HashedType>
 void probe(const RadixContainer<RightType>& radix_container,
            const std::vector<std::optional<HashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
-           std::vector<PosList>& pos_lists_right, const JoinMode mode) {
+           std::vector<PosList>& pos_lists_right, const JoinMode mode,
+           const MultiPredicateJoinEvaluator* secondary_predicate_evaluator) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size() - 1);
 
@@ -406,20 +430,22 @@ void probe(const RadixContainer<RightType>& radix_container,
             continue;
           }
 
-          const auto& rows_iter = hashtable.find(type_cast<HashedType>(row.value));
-
-          if (rows_iter != hashtable.end()) {
-            // Key exists, thus we have at least one hit
-            const auto& matching_rows = rows_iter->second;
-            for (const auto& row_id : matching_rows) {
-              if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
-                pos_list_left_local.emplace_back(row_id);
-                pos_list_right_local.emplace_back(row.row_id);
-              }
+          auto has_match = false;
+          hashtable.for_each_match(type_cast<HashedType>(row.value), row.partition_hash, [&](const RowID& row_id) {
+            if (row_id.chunk_offset == INVALID_CHUNK_OFFSET) return;
+            if (secondary_predicate_evaluator &&
+                !secondary_predicate_evaluator->satisfies_all_predicates(row_id, row.row_id)) {
+              return;
             }
-            // We assume that the relations have been swapped previously,
-            // so that the outer relation is the probing relation.
-          } else if (mode == JoinMode::Left || mode == JoinMode::Right) {
+
+            pos_list_left_local.emplace_back(row_id);
+            pos_list_right_local.emplace_back(row.row_id);
+            has_match = true;
+          });
+
+          // We assume that the relations have been swapped previously,
+          // so that the outer relation is the probing relation.
+          if (!has_match && (mode == JoinMode::Left || mode == JoinMode::Right)) {
             pos_list_left_local.emplace_back(NULL_ROW_ID);
             pos_list_right_local.emplace_back(row.row_id);
           }
@@ -458,7 +484,8 @@ void probe(const RadixContainer<RightType>& radix_container,
 template <typename RightType, typename HashedType>
 void probe_semi_anti(const RadixContainer<RightType>& radix_container,
                      const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
-                     std::vector<PosList>& pos_lists, const JoinMode mode) {
+                     std::vector<PosList>& pos_lists, const JoinMode mode,
+                     const MultiPredicateJoinEvaluator* secondary_predicate_evaluator) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size() - 1);
 
@@ -489,9 +516,17 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
           }
 
           const auto& hashtable = hashtables[current_partition_id].value();
-          const auto it = hashtable.find(type_cast<HashedType>(row.value));
+          auto has_match = false;
+          if (!secondary_predicate_evaluator) {
+            has_match = hashtable.contains(type_cast<HashedType>(row.value), row.partition_hash);
+          } else {
+            hashtable.for_each_match(type_cast<HashedType>(row.value), row.partition_hash, [&](const RowID& row_id) {
+              has_match = has_match || (row_id.chunk_offset != INVALID_CHUNK_OFFSET &&
+                                        secondary_predicate_evaluator->satisfies_all_predicates(row_id, row.row_id));
+            });
+          }
 
-          if ((mode == JoinMode::Semi && it != hashtable.end()) || (mode == JoinMode::Anti && it == hashtable.end())) {
+          if ((mode == JoinMode::Semi && has_match) || (mode == JoinMode::Anti && !has_match)) {
             // Semi: found at least one match for this row -> match
             // Anti: no matching rows found -> match
             pos_list_local.emplace_back(row.row_id);
@@ -606,13 +641,15 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
   JoinHashImpl(const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
-               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
+               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+               const std::vector<OperatorJoinPredicate>& secondary_predicates, const bool inputs_swapped,
                const size_t radix_bits)
       : _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
+        _secondary_predicates(secondary_predicates),
         _inputs_swapped(inputs_swapped) {
     /*
       Setting number of bits for radix clustering:
@@ -642,14 +679,16 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     const auto l2_cache_size = 256'000;  // bytes
 
-    // We assume an std::unordered_map with a linked list within the buckets.
-    // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
-    // that each value maps to two RowIDs.
+    // See OpenAddressingHashTable: two 8-byte slots per row, and the distinct values with the heads and tails of their
+    // chains as well as the RowIDs with their chain links. To get a pessimistic estimation (ensure that the hash table
+    // fits within the cache), we assume that all values are distinct.
     const auto complete_hash_map_size =
-        // hash map
-        build_relation_size * (sizeof(LeftType) + sizeof(void*)) +
-        // PosLists
-        (build_relation_size / 2) * (sizeof(PosList) + 2 * sizeof(RowID));
+        // slots
+        build_relation_size * 2 * (2 * sizeof(uint32_t)) +
+        // distinct values
+        build_relation_size * (sizeof(LeftType) + 2 * sizeof(uint32_t)) +
+        // RowIDs
+        build_relation_size * (sizeof(RowID) + sizeof(uint32_t));
 
     const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
     const auto cluster_count = std::max(1.0f, (adaption_factor * complete_hash_map_size) / l2_cache_size);
@@ -662,6 +701,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
+  const std::vector<OperatorJoinPredicate> _secondary_predicates;
   const bool _inputs_swapped;
 
   std::shared_ptr<Table> _output_table;
@@ -737,12 +777,23 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     However, it would be a good idea to keep each materialized vector on one node if possible.
     This helps choosing a scheduler node for the radix phase (see below).
     */
+    /*
+    Inner and Semi joins only output rows of the probe relation that have a join partner. For these, a Bloom filter
+    over the build relation's hashes is filled while materializing the build relation. Rows of the probe relation that
+    do not pass it are dropped during materialization, so that they are neither stored nor partitioned.
+    */
+    auto bloom_filter = std::unique_ptr<BlockedBloomFilter>{};
+    if (_mode == JoinMode::Inner || _mode == JoinMode::Semi) {
+      bloom_filter = std::make_unique<BlockedBloomFilter>(left_in_table->row_count());
+    }
+
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto materialized_left = materialize_input<LeftType, HashedType>(left_in_table, _column_ids.first, histograms_left,
-                                                                     _radix_bits, _partitioning_seed);
+    auto materialized_left = materialize_input<LeftType, HashedType>(
+        left_in_table, _column_ids.first, histograms_left, _radix_bits, _partitioning_seed, false, bloom_filter.get());
     // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
-    auto materialized_right = materialize_input<RightType, HashedType>(
-        right_in_table, _column_ids.second, histograms_right, _radix_bits, _partitioning_seed, keep_nulls);
+    auto materialized_right =
+        materialize_input<RightType, HashedType>(right_in_table, _column_ids.second, histograms_right, _radix_bits,
+                                                 _partitioning_seed, keep_nulls, nullptr, bloom_filter.get());
 
     // Radix Partitioning phase
     /*
@@ -782,10 +833,18 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     The workers for each radix partition P should be scheduled on the same node as the input data:
     leftP, rightP and hashtableP.
     */
+    auto secondary_predicate_evaluator = std::unique_ptr<MultiPredicateJoinEvaluator>{};
+    if (!_secondary_predicates.empty()) {
+      secondary_predicate_evaluator =
+          std::make_unique<MultiPredicateJoinEvaluator>(*left_in_table, *right_in_table, _secondary_predicates);
+    }
+
     if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode,
+                                             secondary_predicate_evaluator.get());
     } else {
-      probe<RightType, HashedType>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+      probe<RightType, HashedType>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode,
+                                   secondary_predicate_evaluator.get());
     }
 
     auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
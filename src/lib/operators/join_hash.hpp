@@ -14,7 +14,8 @@ namespace opossum {
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
- * If you want to filter by multiple criteria, you can chain this operator.
+ * Additional predicates on other columns (e.g., for composite keys) can be passed as secondary predicates. They are
+ * evaluated for each pair of rows that matches the primary equality predicate during the probe phase.
  *
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
@@ -25,7 +26,7 @@ class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-           const size_t radix_bits = 9);
+           const std::vector<OperatorJoinPredicate>& secondary_predicates = {}, const size_t radix_bits = 9);
 
   const std::string name() const override;
 
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Bloom filter over the hashes of the build side of the JoinHash. Probe rows whose hash is not contained cannot have a
+ * join partner and are dropped before they are partitioned.
+ *
+ * The filter is blocked: all bits of one hash are set in the same 64-bit word, so that each insert and lookup touches a
+ * single cache line. This costs a slightly higher false positive rate than a classic Bloom filter of the same size.
+ * Inserts are thread-safe, so that the filter can be filled by the materialization jobs of all chunks concurrently.
+ */
+class BlockedBloomFilter {
+ public:
+  explicit BlockedBloomFilter(const size_t value_count) {
+    auto word_count = size_t{1};
+    while (word_count * 64 < value_count * BITS_PER_VALUE) word_count *= 2;
+
+    _words = std::vector<std::atomic<uint64_t>>(word_count);
+    _word_index_mask = word_count - 1;
+  }
+
+  void insert(const uint32_t hash) { _words[_word_index(hash)].fetch_or(_bit_mask(hash), std::memory_order_relaxed); }
+
+  // May return true for hashes that were never inserted, but never returns false for those that were
+  bool may_contain(const uint32_t hash) const {
+    const auto bit_mask = _bit_mask(hash);
+    return (_words[_word_index(hash)].load(std::memory_order_relaxed) & bit_mask) == bit_mask;
+  }
+
+ private:
+  static constexpr auto BITS_PER_VALUE = size_t{16};
+
+  size_t _word_index(const uint32_t hash) const {
+    // Fibonacci hashing, so that the word index does not depend on the same bits as the bit mask
+    return static_cast<size_t>((uint64_t{hash} * 11400714819323198485ull) >> 32) & _word_index_mask;
+  }
+
+  // Three bits per value, taken from the lower 18 bits of the hash
+  static uint64_t _bit_mask(const uint32_t hash) {
+    return (uint64_t{1} << (hash & 63u)) | (uint64_t{1} << ((hash >> 6) & 63u)) |
+           (uint64_t{1} << ((hash >> 12) & 63u));
+  }
+
+  std::vector<std::atomic<uint64_t>> _words;
+  size_t _word_index_mask;
+};
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Hash table used by the build and probe phases of the JoinHash. In contrast to an std::unordered_map, it does not
+ * allocate a node per entry and needs no pointer chasing during the probe:
+ *
+ *  - The slots are a power-of-two sized array that is probed linearly. Each slot holds the hash of its value and the
+ *    index of the value, so that most mismatches are detected without touching the values themselves.
+ *  - Each distinct value is stored once. All RowIDs with this value are chained through a separate array, which is
+ *    indexed by the position of the RowID (i.e., the order of insertion).
+ *
+ * The number of rows has to be known upfront (it is taken from the radix partitioning). The table is sized for twice
+ * that many slots, so that the load factor never exceeds 0.5 even if all values are distinct.
+ */
+template <typename T>
+class OpenAddressingHashTable {
+ public:
+  explicit OpenAddressingHashTable(const size_t row_count) {
+    auto slot_count = size_t{2};
+    while (slot_count < 2 * row_count) slot_count *= 2;
+
+    _slots.resize(slot_count, Slot{0, INVALID_INDEX});
+    _slot_index_mask = slot_count - 1;
+
+    _row_ids.reserve(row_count);
+    _next_row_indices.reserve(row_count);
+  }
+
+  /**
+   * The hash has to be the same for equal values, both when inserting and when probing. The JoinHash passes the hash
+   * that was already computed for the radix partitioning.
+   */
+  void insert(T value, const uint32_t hash, const RowID row_id) {
+    DebugAssert(_row_ids.size() < _row_ids.capacity(), "Inserted more rows than the hash table was sized for");
+
+    const auto row_index = static_cast<uint32_t>(_row_ids.size());
+    _row_ids.emplace_back(row_id);
+
+    auto& slot = _find_slot(value, hash);
+    if (slot.value_index == INVALID_INDEX) {
+      slot = Slot{hash, static_cast<uint32_t>(_values.size())};
+      _values.emplace_back(std::move(value));
+      _first_row_indices.emplace_back(row_index);
+      _last_row_indices.emplace_back(row_index);
+      _next_row_indices.emplace_back(INVALID_INDEX);
+      return;
+    }
+
+    // Append the row to the end of the chain, so that matches are returned in insertion order
+    _next_row_indices.emplace_back(INVALID_INDEX);
+    _next_row_indices[_last_row_indices[slot.value_index]] = row_index;
+    _last_row_indices[slot.value_index] = row_index;
+  }
+
+  bool contains(const T& value, const uint32_t hash) const {
+    return _find_slot(value, hash).value_index != INVALID_INDEX;
+  }
+
+  /**
+   * Calls functor(const RowID&) for each row that was inserted with the given value. Returns false if there is none.
+   */
+  template <typename Functor>
+  bool for_each_match(const T& value, const uint32_t hash, const Functor& functor) const {
+    const auto& slot = _find_slot(value, hash);
+    if (slot.value_index == INVALID_INDEX) return false;
+
+    for (auto row_index = _first_row_indices[slot.value_index]; row_index != INVALID_INDEX;
+         row_index = _next_row_indices[row_index]) {
+      functor(_row_ids[row_index]);
+    }
+    return true;
+  }
+
+  size_t distinct_value_count() const { return _values.size(); }
+
+  size_t row_count() const { return _row_ids.size(); }
+
+ private:
+  static constexpr auto INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+  struct Slot {
+    uint32_t hash;
+    uint32_t value_index;
+  };
+
+  // Returns the slot that holds the value or the empty slot in which it would be inserted
+  const Slot& _find_slot(const T& value, const uint32_t hash) const {
+    // The lower bits of the hash are shared by all values of a radix partition. Fibonacci hashing spreads all bits of
+    // the hash over the slot index.
+    auto slot_index = static_cast<size_t>((uint64_t{hash} * 11400714819323198485ull) >> 32) & _slot_index_mask;
+
+    while (true) {
+      const auto& slot = _slots[slot_index];
+      if (slot.value_index == INVALID_INDEX || (slot.hash == hash && _values[slot.value_index] == value)) return slot;
+      slot_index = (slot_index + 1) & _slot_index_mask;
+    }
+  }
+
+  Slot& _find_slot(const T& value, const uint32_t hash) {
+    return const_cast<Slot&>(static_cast<const OpenAddressingHashTable&>(*this)._find_slot(value, hash));
+  }
+
+  std::vector<Slot> _slots;
+  size_t _slot_index_mask;
+
+  // One entry per distinct value
+  std::vector<T> _values;
+  std::vector<uint32_t> _first_row_indices;
+  std::vector<uint32_t> _last_row_indices;
+
+  // One entry per row
+  std::vector<RowID> _row_ids;
+  std::vector<uint32_t> _next_row_indices;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -13,6 +14,7 @@
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -28,7 +30,7 @@ namespace opossum {
 JoinIndex::JoinIndex(const std::shared_ptr<const AbstractOperator>& left,
                      const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                      const std::pair<ColumnID, ColumnID>& column_ids, const PredicateCondition predicate_condition)
-    : AbstractJoinOperator(OperatorType::JoinIndex, left, right, mode, column_ids, predicate_condition,
+    : AbstractJoinOperator(OperatorType::JoinIndex, left, right, mode, column_ids, predicate_condition, {},
                            std::make_unique<JoinIndex::PerformanceData>()) {
   DebugAssert(mode != JoinMode::Cross, "Cross Join is not supported by index join.");
 }
@@ -104,15 +106,20 @@ void JoinIndex::_perform_join() {
   // Scan all chunks for right input
   for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
     const auto chunk_right = _right_in_table->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
     if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
 
     std::shared_ptr<BaseIndex> index = nullptr;
-
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+    _referencing_chunk_offsets.clear();
+
+    if (_right_in_table->type() == TableType::Data) {
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
+      if (!indices.empty()) {
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        index = indices.front();
+      }
+    } else {
+      index = _find_referenced_index(*chunk_right);
     }
 
     // Scan all chunks from left input
@@ -194,6 +201,41 @@ void JoinIndex::_perform_join() {
   }
 }
 
+std::shared_ptr<BaseIndex> JoinIndex::_find_referenced_index(const Chunk& chunk_right) {
+  const auto reference_segment =
+      std::static_pointer_cast<const ReferenceSegment>(chunk_right.get_segment(_right_column_id));
+  const auto& pos_list = *reference_segment->pos_list();
+  if (pos_list.empty()) return nullptr;
+
+  // Chunks of a Validate's output reference a single chunk each. Only then, an index of the referenced chunk covers
+  // all rows of chunk_right.
+  const auto referenced_chunk_id = pos_list.front().chunk_id;
+  if (referenced_chunk_id == INVALID_CHUNK_ID) return nullptr;
+
+  const auto references_single_chunk = std::all_of(
+      pos_list.begin(), pos_list.end(), [&](const auto& row_id) { return row_id.chunk_id == referenced_chunk_id; });
+  if (!references_single_chunk) return nullptr;
+
+  const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(referenced_chunk_id);
+  const auto indices =
+      referenced_chunk->get_indices(std::vector<ColumnID>{reference_segment->referenced_column_id()});
+  if (indices.empty()) return nullptr;
+
+  _referencing_chunk_offsets.assign(referenced_chunk->size(), INVALID_CHUNK_OFFSET);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < pos_list.size(); ++chunk_offset) {
+    auto& referencing_chunk_offset = _referencing_chunk_offsets[pos_list[chunk_offset].chunk_offset];
+
+    // A row that is referenced more than once cannot be mapped back to a single position
+    if (referencing_chunk_offset != INVALID_CHUNK_OFFSET) {
+      _referencing_chunk_offsets.clear();
+      return nullptr;
+    }
+    referencing_chunk_offset = chunk_offset;
+  }
+
+  return indices.front();
+}
+
 // join loop that joins two segments of two columns using an iterator for the left, and an index for the right
 template <typename LeftIterator>
 void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
@@ -287,6 +329,11 @@ void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIt
 void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                                 const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left,
                                 const ChunkID chunk_id_right) {
+  if (!_referencing_chunk_offsets.empty()) {
+    _append_referencing_matches(range_begin, range_end, chunk_offset_left, chunk_id_left, chunk_id_right);
+    return;
+  }
+
   const auto num_right_matches = std::distance(range_begin, range_end);
 
   if (num_right_matches == 0) {
@@ -313,6 +360,27 @@ void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const Ba
   }
 }
 
+void JoinIndex::_append_referencing_matches(const BaseIndex::Iterator& range_begin,
+                                            const BaseIndex::Iterator& range_end, const ChunkOffset chunk_offset_left,
+                                            const ChunkID chunk_id_left, const ChunkID chunk_id_right) {
+  for (auto index_it = range_begin; index_it != range_end; ++index_it) {
+    // Rows of the referenced chunk that chunk_right does not reference (e.g., invisible ones) are skipped
+    const auto chunk_offset_right = _referencing_chunk_offsets[*index_it];
+    if (chunk_offset_right == INVALID_CHUNK_OFFSET) continue;
+
+    _pos_list_left->emplace_back(RowID{chunk_id_left, chunk_offset_left});
+    _pos_list_right->emplace_back(RowID{chunk_id_right, chunk_offset_right});
+
+    if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+      _left_matches[chunk_id_left][chunk_offset_left] = true;
+    }
+
+    if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+      _right_matches[chunk_id_right][chunk_offset_right] = true;
+    }
+  }
+}
+
 void JoinIndex::_write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                                        std::shared_ptr<PosList> pos_list) {
   // Add segments from table to output chunk
@@ -369,6 +437,7 @@ void JoinIndex::_on_cleanup() {
   _pos_list_right.reset();
   _left_matches.clear();
   _right_matches.clear();
+  _referencing_chunk_offsets.clear();
 }
 
 std::string JoinIndex::PerformanceData::to_string(DescriptionMode description_mode) const {
@@ -11,12 +11,16 @@
 #include "types.hpp"
 
 namespace opossum {
+
+class Chunk;
+
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. If the right table is
+   *       a reference table, e.g., the output of a Validate, the indexes of the referenced chunks are used.
    * Note: Cross joins are not supported. Use the product operator instead.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -56,6 +60,15 @@ class JoinIndex : public AbstractJoinOperator {
   void _append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                        const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left, const ChunkID chunk_id_right);
 
+  // Like _append_matches(), for an index of the chunk referenced by chunk_right (see _find_referenced_index())
+  void _append_referencing_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
+                                   const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left,
+                                   const ChunkID chunk_id_right);
+
+  // If chunk_right is a reference chunk whose join column references a single chunk with an index, e.g., a chunk of a
+  // Validate's output, returns that index and fills _referencing_chunk_offsets. Returns nullptr otherwise.
+  std::shared_ptr<BaseIndex> _find_referenced_index(const Chunk& chunk_right);
+
   void _create_table_structure();
 
   void _write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
@@ -76,6 +89,10 @@ class JoinIndex : public AbstractJoinOperator {
   // The outer vector enumerates chunks, the inner enumerates chunk_offsets
   std::vector<std::vector<bool>> _left_matches;
   std::vector<std::vector<bool>> _right_matches;
+
+  // For an index of the chunk referenced by the current right chunk: the position in the right chunk of each row of
+  // the referenced chunk, or INVALID_CHUNK_OFFSET if the row is not referenced. Empty for indexes of data chunks.
+  std::vector<ChunkOffset> _referencing_chunk_offsets;
 };
 
 }  // namespace opossum
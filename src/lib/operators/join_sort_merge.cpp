@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "join_sort_merge/radix_cluster_sort.hpp"
+#include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
@@ -34,8 +35,9 @@ namespace opossum {
 **/
 JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left,
                              const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
-                             const ColumnIDPair& column_ids, const PredicateCondition op)
-    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, column_ids, op) {
+                             const ColumnIDPair& column_ids, const PredicateCondition op,
+                             const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, column_ids, op, secondary_predicates) {
   // Validate the parameters
   DebugAssert(mode != JoinMode::Cross, "This operator does not support cross joins.");
   DebugAssert(left != nullptr, "The left input operator is null.");
@@ -46,13 +48,15 @@ JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left
               "Unsupported predicate condition");
   DebugAssert(op != PredicateCondition::NotEquals || mode == JoinMode::Inner,
               "Outer joins are not implemented for not-equals joins.");
+  Assert(secondary_predicates.empty() || mode == JoinMode::Inner,
+         "Secondary predicates are only implemented for inner joins.");
 }
 
 std::shared_ptr<AbstractOperator> JoinSortMerge::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   return std::make_shared<JoinSortMerge>(copied_input_left, copied_input_right, _mode, _column_ids,
-                                         _predicate_condition);
+                                         _predicate_condition, _secondary_predicates);
 }
 
 void JoinSortMerge::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -116,6 +120,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_left;
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_right;
 
+  // Only set if the join has secondary predicates, which are checked for each pair of rows matching the primary one
+  std::unique_ptr<MultiPredicateJoinEvaluator> _secondary_predicate_evaluator;
+
   /**
    * The TablePosition is a utility struct that is used to define a specific position in a sorted input table.
   **/
@@ -259,6 +266,10 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   void _emit_all_combinations(size_t output_cluster, TableRange left_range, TableRange right_range) {
     left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
       right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
+        if (_secondary_predicate_evaluator &&
+            !_secondary_predicate_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
+          return;
+        }
         _emit_combination(output_cluster, left_row_id, right_row_id);
       });
     });
@@ -658,6 +669,12 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
+    if (!_sort_merge_join._secondary_predicates.empty()) {
+      _secondary_predicate_evaluator = std::make_unique<MultiPredicateJoinEvaluator>(
+          *_sort_merge_join.input_table_left(), *_sort_merge_join.input_table_right(),
+          _sort_merge_join._secondary_predicates);
+    }
+
     _perform_join();
 
     // merge the pos lists into single pos lists
@@ -20,12 +20,15 @@ namespace opossum {
    * Note: SortMergeJoin does not support null values in the input at the moment.
    * Note: Cross joins are not supported. Use the product operator instead.
    * Note: Outer joins are only implemented for the equi-join case, i.e. the "=" operator.
+   * Note: Secondary predicates are only supported for inner joins. They are checked for each pair of rows that matches
+   *       the primary predicate, see MultiPredicateJoinEvaluator.
    */
 class JoinSortMerge : public AbstractJoinOperator {
  public:
   JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left,
                 const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
-                const ColumnIDPair& column_ids, const PredicateCondition op);
+                const ColumnIDPair& column_ids, const PredicateCondition op,
+                const std::vector<OperatorJoinPredicate>& secondary_predicates = {});
 
   const std::string name() const override;
 
@@ -0,0 +1,163 @@
+#include "multi_predicate_join_evaluator.hpp"
+
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class BaseJoinFieldComparator {
+ public:
+  virtual ~BaseJoinFieldComparator() = default;
+  virtual bool compare(const RowID& left_row_id, const RowID& right_row_id) const = 0;
+};
+
+namespace {
+
+/**
+ * Provides the values of one column of a table by RowID. For ReferenceSegments, the values are accessed in the
+ * referenced table, so that the slow AllTypeVariant-based access of ReferenceSegments is avoided.
+ */
+template <typename T>
+class ColumnAccessor {
+ public:
+  ColumnAccessor(const Table& table, const ColumnID column_id) {
+    _chunk_accessors.resize(table.chunk_count());
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto segment = table.get_chunk(chunk_id)->get_segment(column_id);
+      auto& chunk_accessor = _chunk_accessors[chunk_id];
+
+      if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+        chunk_accessor.pos_list = reference_segment->pos_list();
+        chunk_accessor.referenced_accessors = &_accessors_of_referenced_column(
+            reference_segment->referenced_table(), reference_segment->referenced_column_id());
+      } else {
+        chunk_accessor.accessor = create_segment_accessor<T>(segment);
+      }
+    }
+  }
+
+  std::optional<T> access(const RowID& row_id) const {
+    const auto& chunk_accessor = _chunk_accessors[row_id.chunk_id];
+    if (!chunk_accessor.pos_list) return chunk_accessor.accessor->access(row_id.chunk_offset);
+
+    const auto& referenced_row_id = (*chunk_accessor.pos_list)[row_id.chunk_offset];
+    if (referenced_row_id.is_null()) return std::nullopt;
+    return (*chunk_accessor.referenced_accessors)[referenced_row_id.chunk_id]->access(referenced_row_id.chunk_offset);
+  }
+
+ private:
+  using SegmentAccessors = std::vector<std::unique_ptr<BaseSegmentAccessor<T>>>;
+
+  struct ChunkAccessor {
+    // Set for ReferenceSegments
+    std::shared_ptr<const PosList> pos_list;
+    const SegmentAccessors* referenced_accessors{nullptr};
+
+    // Set for all other segments
+    std::unique_ptr<BaseSegmentAccessor<T>> accessor;
+  };
+
+  struct ReferencedColumn {
+    std::shared_ptr<const Table> table;
+    ColumnID column_id;
+    SegmentAccessors accessors;
+  };
+
+  // The ReferenceSegments of all chunks usually reference the same table, so its accessors are only created once
+  const SegmentAccessors& _accessors_of_referenced_column(const std::shared_ptr<const Table>& table,
+                                                          const ColumnID column_id) {
+    for (const auto& referenced_column : _referenced_columns) {
+      if (referenced_column.table == table && referenced_column.column_id == column_id) {
+        return referenced_column.accessors;
+      }
+    }
+
+    auto& referenced_column = _referenced_columns.emplace_back(ReferencedColumn{table, column_id, {}});
+    referenced_column.accessors.reserve(table->chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto segment = table->get_chunk(chunk_id)->get_segment(column_id);
+      referenced_column.accessors.emplace_back(create_segment_accessor<T>(segment));
+    }
+    return referenced_column.accessors;
+  }
+
+  std::vector<ChunkAccessor> _chunk_accessors;
+
+  // std::deque does not move its elements when growing, so the pointers in _chunk_accessors stay valid
+  std::deque<ReferencedColumn> _referenced_columns;
+};
+
+template <typename Comparator, typename LeftType, typename RightType>
+class JoinFieldComparator : public BaseJoinFieldComparator {
+ public:
+  JoinFieldComparator(const Comparator& comparator, const Table& left, const ColumnID left_column_id,
+                      const Table& right, const ColumnID right_column_id)
+      : _comparator(comparator), _left_accessor(left, left_column_id), _right_accessor(right, right_column_id) {}
+
+  bool compare(const RowID& left_row_id, const RowID& right_row_id) const override {
+    const auto left_value = _left_accessor.access(left_row_id);
+    if (!left_value) return false;
+
+    const auto right_value = _right_accessor.access(right_row_id);
+    if (!right_value) return false;
+
+    return _comparator(*left_value, *right_value);
+  }
+
+ private:
+  const Comparator _comparator;
+  const ColumnAccessor<LeftType> _left_accessor;
+  const ColumnAccessor<RightType> _right_accessor;
+};
+
+}  // namespace
+
+MultiPredicateJoinEvaluator::MultiPredicateJoinEvaluator(const Table& left, const Table& right,
+                                                         const std::vector<OperatorJoinPredicate>& join_predicates) {
+  _comparators.reserve(join_predicates.size());
+
+  for (const auto& join_predicate : join_predicates) {
+    const auto left_column_id = join_predicate.column_ids.first;
+    const auto right_column_id = join_predicate.column_ids.second;
+
+    resolve_data_type(left.column_data_type(left_column_id), [&](auto left_type) {
+      resolve_data_type(right.column_data_type(right_column_id), [&](auto right_type) {
+        using LeftType = typename decltype(left_type)::type;
+        using RightType = typename decltype(right_type)::type;
+
+        if constexpr (std::is_same_v<LeftType, std::string> == std::is_same_v<RightType, std::string>) {
+          with_comparator(join_predicate.predicate_condition, [&](auto comparator) {
+            _comparators.emplace_back(std::make_unique<JoinFieldComparator<decltype(comparator), LeftType, RightType>>(
+                comparator, left, left_column_id, right, right_column_id));
+          });
+        } else {
+          Fail("Cannot compare strings and numbers in join predicates");
+        }
+      });
+    });
+  }
+}
+
+MultiPredicateJoinEvaluator::~MultiPredicateJoinEvaluator() = default;
+
+bool MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row_id,
+                                                           const RowID& right_row_id) const {
+  for (const auto& comparator : _comparators) {
+    if (!comparator->compare(left_row_id, right_row_id)) return false;
+  }
+  return true;
+}
+
+}  // namespace opossum
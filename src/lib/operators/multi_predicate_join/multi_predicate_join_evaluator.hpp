@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "operators/operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseJoinFieldComparator;
+class Table;
+
+/**
+ * Evaluates the secondary predicates of a join (e.g., `a.y = b.y` and `a.z < b.z` in
+ * `a.x = b.x AND a.y = b.y AND a.z < b.z`) for pairs of rows that match the primary predicate. This way, join
+ * operators can evaluate all predicates themselves instead of emitting all matches of the primary predicate, which are
+ * then filtered by a TableScan.
+ *
+ * The RowIDs refer to the rows of the left and right input table. Comparisons involving NULL are never satisfied.
+ * satisfies_all_predicates() does not modify the evaluator and can be called by multiple threads concurrently.
+ */
+class MultiPredicateJoinEvaluator {
+ public:
+  MultiPredicateJoinEvaluator(const Table& left, const Table& right,
+                              const std::vector<OperatorJoinPredicate>& join_predicates);
+  ~MultiPredicateJoinEvaluator();
+
+  bool satisfies_all_predicates(const RowID& left_row_id, const RowID& right_row_id) const;
+
+ private:
+  std::vector<std::unique_ptr<BaseJoinFieldComparator>> _comparators;
+};
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include "materialize_sorted_rows.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Ceiling of integer division
+template <typename T>
+T div_ceil(const T x, const T y) {
+  return (x + y - 1u) / y;
+}
+
+}  // namespace
+
+std::shared_ptr<const Table> materialize_sorted_rows(const std::shared_ptr<const Table>& table_in,
+                                                     const PosList& row_ids, const size_t output_chunk_size) {
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+  auto output = std::make_shared<Table>(table_in->column_definitions(), TableType::Data, output_chunk_size);
+
+  const auto row_count_out = row_ids.size();
+  const auto chunk_count_out = div_ceil(row_count_out, output_chunk_size);
+
+  // Vector of segments for each chunk. Each job writes only to the segments of its column.
+  auto output_segments_by_chunk = std::vector<Segments>(chunk_count_out, Segments(output->column_count()));
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(output->column_count());
+
+  for (auto column_id = ColumnID{0}; column_id < output->column_count(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      resolve_data_type(output->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        // Accessors are created lazily, as the sorted rows might only reference some of the input chunks
+        auto accessor_by_chunk_id = std::vector<std::unique_ptr<BaseSegmentAccessor<ColumnDataType>>>(
+            table_in->chunk_count());
+
+        for (auto chunk_id_out = size_t{0}; chunk_id_out < chunk_count_out; ++chunk_id_out) {
+          const auto row_index_begin = chunk_id_out * output_chunk_size;
+          const auto row_index_end = std::min(row_index_begin + output_chunk_size, row_count_out);
+
+          auto values = pmr_concurrent_vector<ColumnDataType>(row_index_end - row_index_begin);
+          auto null_values = pmr_concurrent_vector<bool>(row_index_end - row_index_begin);
+
+          for (auto row_index = row_index_begin; row_index < row_index_end; ++row_index) {
+            const auto [chunk_id, chunk_offset] = row_ids[row_index];  // NOLINT
+
+            auto& accessor = accessor_by_chunk_id[chunk_id];
+            if (!accessor) {
+              accessor = create_segment_accessor<ColumnDataType>(table_in->get_chunk(chunk_id)->get_segment(column_id));
+            }
+
+            const auto typed_value = accessor->access(chunk_offset);
+            if (typed_value) {
+              values[row_index - row_index_begin] = *typed_value;
+            } else {
+              null_values[row_index - row_index_begin] = true;
+            }
+          }
+
+          output_segments_by_chunk[chunk_id_out][column_id] =
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+        }
+      });
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (auto& segments : output_segments_by_chunk) {
+    output->append_chunk(segments);
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Creates a new data table from the rows of `table_in` in the order given by `row_ids`, which have to be RowIDs into
+ * `table_in` (not into the tables referenced by it). Used by the Sort and TopK operators. Each column is materialized
+ * by its own job.
+ */
+std::shared_ptr<const Table> materialize_sorted_rows(const std::shared_ptr<const Table>& table_in,
+                                                     const PosList& row_ids, const size_t output_chunk_size);
+
+}  // namespace opossum
@@ -0,0 +1,182 @@
+#include "normalized_sort_key.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// One byte placing NULLs before or after all other values of a sort column
+constexpr auto NULL_BYTE_SIZE = size_t{1};
+
+// The RowID that is appended to each key to make all keys distinct and the sort order deterministic
+constexpr auto ROW_ID_SIZE = sizeof(ChunkID::base_type) + sizeof(ChunkOffset);
+
+template <typename T>
+void write_big_endian(uint8_t*& out, const T value) {
+  static_assert(std::is_unsigned_v<T>, "Only unsigned values can be written byte by byte");
+  for (auto byte_index = sizeof(T); byte_index > 0; --byte_index) {
+    *out++ = static_cast<uint8_t>(value >> ((byte_index - 1) * 8));
+  }
+}
+
+template <typename T>
+size_t normalized_value_size(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Zero bytes within the string are escaped as 0x00 0xFF, the string is terminated with 0x00 0x00
+    return value.size() + std::count(value.begin(), value.end(), '\0') + 2;
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename T>
+void write_normalized_value(uint8_t*& out, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto character : value) {
+      *out++ = static_cast<uint8_t>(character);
+      if (character == '\0') *out++ = 0xFF;
+    }
+    *out++ = 0x00;
+    *out++ = 0x00;
+  } else if constexpr (std::is_integral_v<T>) {
+    // Flipping the sign bit moves negative values below positive ones in an unsigned comparison
+    using UnsignedType = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = UnsignedType{1} << (sizeof(T) * 8 - 1);
+    write_big_endian(out, static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ sign_bit));
+  } else {
+    static_assert(std::is_floating_point_v<T>, "Unexpected sort column type");
+    using BitsType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr auto sign_bit = BitsType{1} << (sizeof(T) * 8 - 1);
+
+    // -0.0 and 0.0 compare equal and thus have to share a key
+    const auto normalized_zero_value = value == T{0} ? T{0} : value;
+
+    auto bits = BitsType{};
+    std::memcpy(&bits, &normalized_zero_value, sizeof(T));
+
+    // Negative values are stored as sign and magnitude. Inverting them reverses their order and places them below the
+    // positive values, for which only the sign bit is set.
+    bits = (bits & sign_bit) ? static_cast<BitsType>(~bits) : static_cast<BitsType>(bits | sign_bit);
+    write_big_endian(out, bits);
+  }
+}
+
+}  // namespace
+
+void build_normalized_sort_keys(const Chunk& chunk, const ChunkID chunk_id,
+                                const std::vector<SortColumnDefinition>& sort_definitions,
+                                const std::vector<DataType>& sort_column_data_types, std::vector<uint8_t>& key_data,
+                                NormalizedSortKey* keys_out) {
+  DebugAssert(sort_definitions.size() == sort_column_data_types.size(), "Need one DataType per sort column");
+
+  const auto chunk_size = chunk.size();
+
+  // 1. Determine the size of each key. Only string columns have a variable size, all others always take the same
+  //    number of bytes (NULLs are padded with zeros).
+  auto fixed_key_size = ROW_ID_SIZE;
+  auto variable_key_sizes = std::vector<uint32_t>{};
+
+  for (auto sort_column_index = size_t{0}; sort_column_index < sort_definitions.size(); ++sort_column_index) {
+    fixed_key_size += NULL_BYTE_SIZE;
+
+    resolve_data_type(sort_column_data_types[sort_column_index], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        if (variable_key_sizes.empty()) variable_key_sizes.resize(chunk_size);
+
+        const auto segment = chunk.get_segment(sort_definitions[sort_column_index].column);
+        resolve_segment_type<ColumnDataType>(*segment, [&](const auto& typed_segment) {
+          create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+            if (value.is_null()) return;
+            variable_key_sizes[value.chunk_offset()] += normalized_value_size(value.value());
+          });
+        });
+      } else {
+        fixed_key_size += sizeof(ColumnDataType);
+      }
+    });
+  }
+
+  // 2. Allocate the key buffer and point the keys into it
+  if (variable_key_sizes.empty()) {
+    key_data.resize(fixed_key_size * chunk_size);
+  } else {
+    auto total_key_size = size_t{0};
+    for (const auto variable_key_size : variable_key_sizes) {
+      total_key_size += fixed_key_size + variable_key_size;
+    }
+    key_data.resize(total_key_size);
+  }
+
+  // Position at which the next byte of each key is written
+  auto key_cursors = std::vector<uint8_t*>(chunk_size);
+
+  auto key_begin = key_data.data();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    const auto key_size =
+        static_cast<uint32_t>(fixed_key_size + (variable_key_sizes.empty() ? 0 : variable_key_sizes[chunk_offset]));
+    keys_out[chunk_offset] = NormalizedSortKey{key_begin, key_size, RowID{chunk_id, chunk_offset}};
+    key_cursors[chunk_offset] = key_begin;
+    key_begin += key_size;
+  }
+
+  // 3. Write the sort columns one after another, beginning with the most significant one
+  for (auto sort_column_index = size_t{0}; sort_column_index < sort_definitions.size(); ++sort_column_index) {
+    const auto& sort_definition = sort_definitions[sort_column_index];
+    const auto order_by_mode = sort_definition.order_by_mode;
+    const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+    const auto descending =
+        order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+
+    const auto segment = chunk.get_segment(sort_definition.column);
+
+    resolve_data_type(sort_column_data_types[sort_column_index], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      resolve_segment_type<ColumnDataType>(*segment, [&](const auto& typed_segment) {
+        create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+          auto& cursor = key_cursors[value.chunk_offset()];
+
+          *cursor++ = value.is_null() == nulls_first ? 0x00 : 0x01;
+
+          if (value.is_null()) {
+            if constexpr (!std::is_same_v<ColumnDataType, std::string>) {
+              std::memset(cursor, 0, sizeof(ColumnDataType));
+              cursor += sizeof(ColumnDataType);
+            }
+            return;
+          }
+
+          const auto value_begin = cursor;
+          write_normalized_value(cursor, value.value());
+
+          if (descending) {
+            std::transform(value_begin, cursor, value_begin, [](const uint8_t byte) { return ~byte; });
+          }
+        });
+      });
+    });
+  }
+
+  // 4. Append the RowIDs
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    auto& cursor = key_cursors[chunk_offset];
+    write_big_endian(cursor, static_cast<ChunkID::base_type>(chunk_id));
+    write_big_endian(cursor, static_cast<ChunkOffset>(chunk_offset));
+    DebugAssert(cursor == keys_out[chunk_offset].data + keys_out[chunk_offset].size, "Key size mismatch");
+  }
+}
+
+}  // namespace opossum
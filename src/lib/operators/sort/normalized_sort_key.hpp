@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "operators/sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * A normalized sort key is a byte string that encodes the values of all sort columns of one row so that the order of
+ * two rows is given by a plain memcmp() of their keys. This way, multi-column sorts do not need to resolve the column
+ * types during the comparison and can compare all sort columns at once.
+ *
+ * Per sort column, the key contains
+ *   - one byte that places NULLs first or last, as requested by the OrderByMode
+ *   - the value in an order-preserving, big-endian representation (integers with a flipped sign bit, floats with a
+ *     flipped sign bit or fully inverted if negative, strings with escaped zero bytes and a two-byte terminator).
+ *     For descending columns, these bytes are inverted.
+ * Finally, the RowID of the row is appended. As no two keys are equal, any (unstable) sort algorithm produces the same
+ * order as a stable sort would.
+ */
+struct NormalizedSortKey {
+  const uint8_t* data;
+  uint32_t size;
+  RowID row_id;
+
+  bool operator<(const NormalizedSortKey& other) const {
+    const auto result = std::memcmp(data, other.data, std::min(size, other.size));
+    return result < 0 || (result == 0 && size < other.size);
+  }
+};
+
+/**
+ * Builds the normalized sort keys of all rows in a chunk. The key bytes are stored in `key_data`, which must outlive
+ * the keys and must not be modified afterwards. `keys_out` has to point to at least chunk.size() keys, which are
+ * written in the order of the chunk offsets.
+ */
+void build_normalized_sort_keys(const Chunk& chunk, const ChunkID chunk_id,
+                                const std::vector<SortColumnDefinition>& sort_definitions,
+                                const std::vector<DataType>& sort_column_data_types, std::vector<uint8_t>& key_data,
+                                NormalizedSortKey* keys_out);
+
+}  // namespace opossum
@@ -1,8 +1,9 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
-#include <mutex>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -29,6 +30,61 @@
 
 namespace opossum {
 
+Segments TableScan::create_output_segments(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                           const std::shared_ptr<const PosList>& matches_out) {
+  Segments out_segments;
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+   * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+   * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between segments as much as possible. Position lists can be shared between two segments iff
+   * (a) they point to the same table and
+   * (b) the reference segments of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (in_table->type() == TableType::References) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
+
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto segment_in = chunk_in->get_segment(column_id);
+
+      auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+      DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
+
+      const auto pos_list_in = ref_segment_in->pos_list();
+
+      const auto table_out = ref_segment_in->referenced_table();
+      const auto column_id_out = ref_segment_in->referenced_column_id();
+
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(matches_out->size());
+
+        for (const auto& match : *matches_out) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          filtered_pos_list->push_back(row_id);
+        }
+      }
+
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  } else {
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+      out_segments.push_back(ref_segment_out);
+    }
+  }
+
+  return out_segments;
+}
+
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const OperatorScanPredicate& predicate)
     : AbstractReadOnlyOperator{OperatorType::TableScan, in}, _predicate{predicate} {}
 
@@ -45,6 +101,8 @@ const std::string TableScan::description(DescriptionMode description_mode) const
 
 const OperatorScanPredicate& TableScan::predicate() const { return _predicate; }
 
+const std::vector<ChunkID>& TableScan::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
 void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
   if (!is_parameter_id(_predicate.value)) return;
 
@@ -63,100 +121,107 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
 std::shared_ptr<const Table> TableScan::_on_execute() {
   _in_table = input_table_left();
 
-  _init_scan();
+  _impl = create_impl(_in_table, _predicate);
 
   _output_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
-  std::mutex output_mutex;
-
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
+  const auto chunk_count = _in_table->chunk_count();
+
+  /**
+   * Chunks with more than MORSEL_SIZE rows are split into morsels, so that few large chunks can be scanned by as many
+   * workers as there are morsels. Each morsel writes its matches into its own slot. Thus, no synchronization is needed
+   * and the matches of a chunk can be concatenated in the order of the rows afterwards.
+   */
+  auto matches_by_chunk = std::vector<std::vector<std::shared_ptr<const PosList>>>(chunk_count);
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(_in_table->chunk_count() - excluded_chunk_set.size());
+  jobs.reserve(chunk_count - excluded_chunk_set.size());
 
-  for (ChunkID chunk_id{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
-      // towards the original chunk.
-      Segments out_segments;
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (_in_table->type() == TableType::References) {
-        const auto chunk_in = _in_table->get_chunk(chunk_id);
-
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
-
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
-
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
-
-          const auto pos_list_in = ref_segment_in->pos_list();
+    const auto chunk_size = _in_table->get_chunk(chunk_id)->size();
+
+    if (chunk_size <= MORSEL_SIZE || !_impl->supports_morsels()) {
+      matches_by_chunk[chunk_id].resize(1);
+      jobs.emplace_back(std::make_shared<JobTask>([=, &matches_by_chunk]() {
+        const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
+        // The actual scan happens in the sub classes of BaseTableScanImpl
+        matches_by_chunk[chunk_id][0] = _impl->scan_chunk(chunk_id);
+      }));
+      continue;
+    }
+
+    const auto morsel_count = (chunk_size + MORSEL_SIZE - 1) / MORSEL_SIZE;
+    matches_by_chunk[chunk_id].resize(morsel_count);
+
+    for (auto morsel_idx = ChunkOffset{0}; morsel_idx < morsel_count; ++morsel_idx) {
+      const auto begin_offset = static_cast<ChunkOffset>(morsel_idx * MORSEL_SIZE);
+      const auto end_offset = std::min(static_cast<ChunkOffset>(begin_offset + MORSEL_SIZE), chunk_size);
+
+      jobs.emplace_back(std::make_shared<JobTask>([=, &matches_by_chunk]() {
+        const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
+        matches_by_chunk[chunk_id][morsel_idx] = _impl->scan_morsel(chunk_id, begin_offset, end_offset);
+      }));
+    }
+  }
 
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  jobs.clear();
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+  // Build the output chunks, again in parallel and with one slot per chunk, so that they can be appended in order
+  auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
 
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
+  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& morsel_matches = matches_by_chunk[chunk_id];
+    const auto match_count =
+        std::accumulate(morsel_matches.begin(), morsel_matches.end(), size_t{0},
+                        [](const auto sum, const auto& matches) { return sum + (matches ? matches->size() : 0); });
+    if (match_count == 0) continue;
 
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
-          }
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, match_count]() {
+      auto matches_out = std::shared_ptr<const PosList>{};
 
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
+      if (matches_by_chunk[chunk_id].size() == 1) {
+        matches_out = matches_by_chunk[chunk_id][0];
       } else {
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
+        auto merged_matches = std::make_shared<PosList>();
+        merged_matches->reserve(match_count);
+        for (const auto& matches : matches_by_chunk[chunk_id]) {
+          merged_matches->insert(merged_matches->end(), matches->begin(), matches->end());
         }
+        matches_out = merged_matches;
       }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      _output_table->append_chunk(out_segments, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
-
-    jobs.push_back(job_task);
-    job_task->schedule();
+      output_segments_by_chunk[chunk_id] = create_output_segments(_in_table, chunk_id, matches_out);
+    }));
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
+    if (output_segments_by_chunk[chunk_id].empty()) continue;
+
+    // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
+    // towards the original chunk.
+    const auto chunk = _in_table->get_chunk(chunk_id);
+    _output_table->append_chunk(output_segments_by_chunk[chunk_id], chunk->get_allocator(), chunk->access_counter());
+  }
 
   return _output_table;
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
 
-void TableScan::_init_scan() {
-  const auto column_id = _predicate.column_id;
-  const auto condition = _predicate.predicate_condition;
-  const auto parameter = _predicate.value;
+std::unique_ptr<BaseTableScanImpl> TableScan::create_impl(const std::shared_ptr<const Table>& in_table,
+                                                          const OperatorScanPredicate& predicate) {
+  const auto column_id = predicate.column_id;
+  const auto condition = predicate.predicate_condition;
+  const auto parameter = predicate.value;
 
   if (condition == PredicateCondition::Like || condition == PredicateCondition::NotLike) {
-    const auto left_column_type = _in_table->column_data_type(column_id);
+    const auto left_column_type = in_table->column_data_type(column_id);
     Assert((left_column_type == DataType::String), "LIKE operator only applicable on string columns.");
 
     DebugAssert(is_variant(parameter), "Right parameter must be variant.");
@@ -167,24 +232,21 @@ void TableScan::_init_scan() {
 
     const auto right_wildcard = type_cast<std::string>(right_value);
 
-    _impl = std::make_unique<LikeTableScanImpl>(_in_table, column_id, condition, right_wildcard);
-
-    return;
+    return std::make_unique<LikeTableScanImpl>(in_table, column_id, condition, right_wildcard);
   }
 
   if (condition == PredicateCondition::IsNull || condition == PredicateCondition::IsNotNull) {
-    _impl = std::make_unique<IsNullTableScanImpl>(_in_table, column_id, condition);
-    return;
+    return std::make_unique<IsNullTableScanImpl>(in_table, column_id, condition);
   }
 
   if (is_variant(parameter)) {
     const auto right_value = boost::get<AllTypeVariant>(parameter);
 
-    _impl = std::make_unique<SingleColumnTableScanImpl>(_in_table, column_id, condition, right_value);
+    return std::make_unique<SingleColumnTableScanImpl>(in_table, column_id, condition, right_value);
   } else /* is_column_name(parameter) */ {
     const auto right_column_id = boost::get<ColumnID>(parameter);
 
-    _impl = std::make_unique<ColumnComparisonTableScanImpl>(_in_table, column_id, condition, right_column_id);
+    return std::make_unique<ColumnComparisonTableScanImpl>(in_table, column_id, condition, right_column_id);
   }
 }
 
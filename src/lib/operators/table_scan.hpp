@@ -8,6 +8,7 @@
 #include "abstract_read_only_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "operator_scan_predicate.hpp"
+#include "storage/chunk.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -43,6 +44,18 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
   const OperatorScanPredicate& predicate() const;
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
+
+  // Creates the implementation that scans the chunks of in_table for the predicate
+  static std::unique_ptr<BaseTableScanImpl> create_impl(const std::shared_ptr<const Table>& in_table,
+                                                        const OperatorScanPredicate& predicate);
+
+  // Creates the reference segments that contain the matches of a chunk of in_table
+  static Segments create_output_segments(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                         const std::shared_ptr<const PosList>& matches_out);
+
+  // Chunks with more rows are split into multiple morsels that are scanned in parallel
+  static constexpr ChunkOffset MORSEL_SIZE = 32'768;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -55,8 +68,6 @@ class TableScan : public AbstractReadOnlyOperator {
 
   void _on_cleanup() override;
 
-  void _init_scan();
-
  private:
   OperatorScanPredicate _predicate;
 
@@ -0,0 +1,295 @@
+#include "attribute_vector_scan_kernels.hpp"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The number of values that one match bitmask is emitted for
+constexpr auto BITMASK_SIZE = size_t{64};
+
+// The number of values that one 16-bit mask is computed for
+constexpr auto VALUES_PER_MASK = size_t{16};
+
+/**
+ * Checks whether values lie in the inclusive range [first, last] and are not the excluded value.
+ *
+ * The range check `first <= value <= last` is evaluated as `value - first <= last - first` with wrap-around
+ * subtraction, which only needs a single unsigned comparison. SSE2 only has signed comparisons, so both sides of it
+ * are shifted into the signed range by flipping their sign bits. The kernels look for mismatches, i.e., `value - first
+ * > last - first` or `value == excluded`, and invert the resulting bitmask.
+ */
+template <typename UnsignedIntType>
+class RangeMatcher {
+ public:
+  // The range must not be empty, and its first value must be representable by UnsignedIntType
+  explicit RangeMatcher(const CompressedVectorValueRange& range)
+      : _first{static_cast<UnsignedIntType>(range.first)},
+        _width{static_cast<UnsignedIntType>(std::min(range.last, uint32_t{MAX_VALUE}) - range.first)},
+        _excluded{static_cast<UnsignedIntType>(range.excluded_value.value_or(0u))},
+        _has_excluded{range.excluded_value && *range.excluded_value >= range.first &&
+                      *range.excluded_value <= std::min(range.last, uint32_t{MAX_VALUE})},
+        _first_register{_broadcast(_first)},
+        _biased_width_register{_broadcast(static_cast<UnsignedIntType>(_width ^ SIGN_BIT))},
+        _excluded_register{_broadcast(_excluded)},
+        _sign_bit_register{_broadcast(SIGN_BIT)} {
+    DebugAssert(range.first <= range.last, "Invalid range");
+  }
+
+  static constexpr auto MAX_VALUE = std::numeric_limits<UnsignedIntType>::max();
+
+  // Appends the positions of the matching values, which start at first_chunk_offset, to matches_out
+  void scan(const UnsignedIntType* values, const size_t size, const ChunkOffset first_chunk_offset,
+            const ChunkID chunk_id, PosList& matches_out) const {
+    if (_has_excluded) {
+      _scan<true>(values, size, first_chunk_offset, chunk_id, matches_out);
+    } else {
+      _scan<false>(values, size, first_chunk_offset, chunk_id, matches_out);
+    }
+  }
+
+ private:
+  static constexpr auto SIGN_BIT = static_cast<UnsignedIntType>(1u << (sizeof(UnsignedIntType) * 8 - 1));
+  static constexpr auto VALUES_PER_REGISTER = sizeof(__m128i) / sizeof(UnsignedIntType);
+
+  static __m128i _broadcast(const UnsignedIntType value) {
+    if constexpr (sizeof(UnsignedIntType) == 1) {
+      return _mm_set1_epi8(static_cast<char>(value));
+    } else if constexpr (sizeof(UnsignedIntType) == 2) {
+      return _mm_set1_epi16(static_cast<int16_t>(value));
+    } else {
+      return _mm_set1_epi32(static_cast<int32_t>(value));
+    }
+  }
+
+  template <bool HasExcluded>
+  bool _matches(const UnsignedIntType value) const {
+    return static_cast<UnsignedIntType>(value - _first) <= _width && (!HasExcluded || value != _excluded);
+  }
+
+  // Sets all bits of the lanes whose value does not match
+  template <bool HasExcluded>
+  __m128i _mismatch_lanes(const __m128i values) const {
+    auto mismatches = __m128i{};
+    auto excluded = __m128i{};
+
+    if constexpr (sizeof(UnsignedIntType) == 1) {
+      const auto offsets = _mm_xor_si128(_mm_sub_epi8(values, _first_register), _sign_bit_register);
+      mismatches = _mm_cmpgt_epi8(offsets, _biased_width_register);
+      if constexpr (HasExcluded) excluded = _mm_cmpeq_epi8(values, _excluded_register);
+    } else if constexpr (sizeof(UnsignedIntType) == 2) {
+      const auto offsets = _mm_xor_si128(_mm_sub_epi16(values, _first_register), _sign_bit_register);
+      mismatches = _mm_cmpgt_epi16(offsets, _biased_width_register);
+      if constexpr (HasExcluded) excluded = _mm_cmpeq_epi16(values, _excluded_register);
+    } else {
+      const auto offsets = _mm_xor_si128(_mm_sub_epi32(values, _first_register), _sign_bit_register);
+      mismatches = _mm_cmpgt_epi32(offsets, _biased_width_register);
+      if constexpr (HasExcluded) excluded = _mm_cmpeq_epi32(values, _excluded_register);
+    }
+
+    if constexpr (HasExcluded) mismatches = _mm_or_si128(mismatches, excluded);
+    return mismatches;
+  }
+
+  // Returns a mask with one bit per value, which is set if the value matches
+  template <bool HasExcluded>
+  uint16_t _match_16(const UnsignedIntType* values) const {
+    const auto mismatch_register = [&](const size_t register_index) {
+      const auto address = reinterpret_cast<const __m128i*>(values + register_index * VALUES_PER_REGISTER);
+      return _mismatch_lanes<HasExcluded>(_mm_loadu_si128(address));
+    };
+
+    // Narrow the lanes to one byte each. The lanes are either all zeros or all ones, which saturation preserves.
+    auto mismatches = __m128i{};
+    if constexpr (sizeof(UnsignedIntType) == 1) {
+      mismatches = mismatch_register(0);
+    } else if constexpr (sizeof(UnsignedIntType) == 2) {
+      mismatches = _mm_packs_epi16(mismatch_register(0), mismatch_register(1));
+    } else {
+      mismatches = _mm_packs_epi16(_mm_packs_epi32(mismatch_register(0), mismatch_register(1)),
+                                   _mm_packs_epi32(mismatch_register(2), mismatch_register(3)));
+    }
+
+    return static_cast<uint16_t>(~_mm_movemask_epi8(mismatches));
+  }
+
+  template <bool HasExcluded>
+  void _scan(const UnsignedIntType* values, const size_t size, const ChunkOffset first_chunk_offset,
+             const ChunkID chunk_id, PosList& matches_out) const {
+    auto index = size_t{0};
+    for (; index + BITMASK_SIZE <= size; index += BITMASK_SIZE) {
+      auto bitmask = uint64_t{0};
+      for (auto mask_index = size_t{0}; mask_index < BITMASK_SIZE / VALUES_PER_MASK; ++mask_index) {
+        const auto mask = _match_16<HasExcluded>(values + index + mask_index * VALUES_PER_MASK);
+        bitmask |= uint64_t{mask} << (mask_index * VALUES_PER_MASK);
+      }
+
+      // Emit the positions of the set bits
+      while (bitmask != 0) {
+        const auto bit_index = static_cast<size_t>(__builtin_ctzll(bitmask));
+        matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index + bit_index)});
+        bitmask &= bitmask - 1;
+      }
+    }
+
+    for (; index < size; ++index) {
+      if (_matches<HasExcluded>(values[index])) {
+        matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index)});
+      }
+    }
+  }
+
+  const UnsignedIntType _first;
+  const UnsignedIntType _width;
+  const UnsignedIntType _excluded;
+  const bool _has_excluded;
+
+  const __m128i _first_register;
+  const __m128i _biased_width_register;
+  const __m128i _excluded_register;
+  const __m128i _sign_bit_register;
+};
+
+// Whether the range contains all values that UnsignedIntType can represent
+template <typename UnsignedIntType>
+bool range_contains_all_values(const CompressedVectorValueRange& range) {
+  constexpr auto max_value = uint32_t{std::numeric_limits<UnsignedIntType>::max()};
+  if (range.first != 0 || range.last < max_value) return false;
+
+  if constexpr (sizeof(UnsignedIntType) < sizeof(uint32_t)) {
+    return !range.excluded_value || *range.excluded_value > max_value;
+  } else {
+    return !range.excluded_value;
+  }
+}
+
+// Emits the positions of a whole block, whose values do not need to be decoded
+void emit_all(const ChunkOffset first_chunk_offset, const size_t size, const ChunkID chunk_id, PosList& matches_out) {
+  for (auto index = size_t{0}; index < size; ++index) {
+    matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index)});
+  }
+}
+
+template <typename UnsignedIntType>
+void scan_block(const UnsignedIntType* values, const size_t size, const CompressedVectorValueRange& range,
+                const ChunkOffset first_chunk_offset, const ChunkID chunk_id, PosList& matches_out) {
+  if constexpr (sizeof(UnsignedIntType) < sizeof(uint32_t)) {
+    // None of the values can lie in the range
+    if (range.first > RangeMatcher<UnsignedIntType>::MAX_VALUE) return;
+  }
+
+  if (range_contains_all_values<UnsignedIntType>(range)) {
+    emit_all(first_chunk_offset, size, chunk_id, matches_out);
+    return;
+  }
+
+  RangeMatcher<UnsignedIntType>{range}.scan(values, size, first_chunk_offset, chunk_id, matches_out);
+}
+
+template <typename UnsignedIntType>
+void scan_vector(const FixedSizeByteAlignedVector<UnsignedIntType>& vector, const ChunkOffset begin_offset,
+                 const ChunkOffset end_offset,
+                 const std::function<std::optional<CompressedVectorValueRange>(size_t)>& range_for_block,
+                 const ChunkID chunk_id, PosList& matches_out) {
+  const auto* values = vector.data().data();
+
+  for (auto block_index = begin_offset / COMPRESSED_VECTOR_SCAN_BLOCK_SIZE;
+       block_index * COMPRESSED_VECTOR_SCAN_BLOCK_SIZE < end_offset; ++block_index) {
+    const auto range = range_for_block(block_index);
+    if (!range) continue;
+
+    const auto block_begin = block_index * COMPRESSED_VECTOR_SCAN_BLOCK_SIZE;
+    const auto scan_begin = std::max(size_t{begin_offset}, block_begin);
+    const auto scan_end = std::min(size_t{end_offset}, block_begin + COMPRESSED_VECTOR_SCAN_BLOCK_SIZE);
+    scan_block(values + scan_begin, scan_end - scan_begin, *range, static_cast<ChunkOffset>(scan_begin), chunk_id,
+               matches_out);
+  }
+}
+
+void scan_vector(const SimdBp128Vector& vector, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                 const std::function<std::optional<CompressedVectorValueRange>(size_t)>& range_for_block,
+                 const ChunkID chunk_id, PosList& matches_out) {
+  using Packing = SimdBp128Packing;
+  static_assert(Packing::meta_block_size == COMPRESSED_VECTOR_SCAN_BLOCK_SIZE, "Blocks must be meta blocks");
+
+  const auto& data = vector.data();
+  const auto size = vector.size();
+
+  // Packing::unpack_block() uses aligned stores
+  alignas(16) auto meta_block = std::array<uint32_t, Packing::meta_block_size>{};
+  auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+
+  auto data_index = size_t{0};
+  for (auto meta_block_begin = size_t{0}; meta_block_begin < end_offset; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(data.data() + data_index++, meta_info.data());
+
+    // The blocks of the last meta block that lie behind the end of the vector are not unpacked
+    const auto meta_block_value_count = std::min(size_t{Packing::meta_block_size}, size - meta_block_begin);
+    const auto block_count = (meta_block_value_count + Packing::block_size - 1) / Packing::block_size;
+
+    const auto scan_begin = std::max(size_t{begin_offset}, meta_block_begin);
+    const auto scan_end = std::min(size_t{end_offset}, meta_block_begin + meta_block_value_count);
+
+    // Meta blocks in front of the scanned positions, that cannot contain any matches, or that only contain matches are
+    // not unpacked but skipped. The size of a packed block is given by its bit size.
+    const auto range = scan_begin < scan_end ? range_for_block(meta_block_begin / Packing::meta_block_size)
+                                             : std::optional<CompressedVectorValueRange>{};
+    if (!range || range_contains_all_values<uint32_t>(*range)) {
+      if (range) emit_all(static_cast<ChunkOffset>(scan_begin), scan_end - scan_begin, chunk_id, matches_out);
+
+      for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+        data_index += meta_info[block_index];
+      }
+      continue;
+    }
+
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      const auto bit_size = meta_info[block_index];
+      Packing::unpack_block(data.data() + data_index, meta_block.data() + block_index * Packing::block_size, bit_size);
+      data_index += bit_size;
+    }
+
+    scan_block(meta_block.data() + (scan_begin - meta_block_begin), scan_end - scan_begin, *range,
+               static_cast<ChunkOffset>(scan_begin), chunk_id, matches_out);
+  }
+}
+
+}  // namespace
+
+void scan_compressed_vector(
+    const BaseCompressedVector& vector, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+    const std::function<std::optional<CompressedVectorValueRange>(size_t block_index)>& range_for_block,
+    const ChunkID chunk_id, PosList& matches_out) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= vector.size(), "Invalid range of positions");
+
+  resolve_compressed_vector_type(vector, [&](const auto& typed_vector) {
+    scan_vector(typed_vector, begin_offset, end_offset, range_for_block, chunk_id, matches_out);
+  });
+}
+
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ChunkOffset begin_offset,
+                         const ChunkOffset end_offset, const ValueID begin_value_id, const ValueID end_value_id,
+                         const std::optional<ValueID>& excluded_value_id, const ChunkID chunk_id,
+                         PosList& matches_out) {
+  if (begin_value_id >= end_value_id) return;
+
+  auto range = CompressedVectorValueRange{begin_value_id, end_value_id - 1, std::nullopt};
+  if (excluded_value_id) range.excluded_value = *excluded_value_id;
+
+  scan_compressed_vector(
+      attribute_vector, begin_offset, end_offset,
+      [&](const size_t) { return std::optional<CompressedVectorValueRange>{range}; }, chunk_id, matches_out);
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+// An inclusive range of the values of a compressed vector, minus an optional excluded value
+struct CompressedVectorValueRange {
+  uint32_t first;
+  uint32_t last;
+  std::optional<uint32_t> excluded_value;
+};
+
+// Compressed vectors are scanned in blocks of this many values, which is the size of a SimdBp128 meta block and of a
+// FrameOfReference block
+constexpr auto COMPRESSED_VECTOR_SCAN_BLOCK_SIZE = size_t{2048};
+
+/**
+ * @brief Finds the values of a compressed vector at the positions [begin_offset, end_offset) that lie in a range
+ *
+ * The vector is scanned in blocks of COMPRESSED_VECTOR_SCAN_BLOCK_SIZE values. For each block, range_for_block returns
+ * the range of matching values, or std::nullopt if the block cannot contain any matches. Such blocks are skipped
+ * without decoding them.
+ *
+ * Instead of decompressing the values one at a time, the kernels compare 16 bytes of values at once using SSE2 and
+ * emit a match bitmask per 64 values, which is then turned into positions. FixedSizeByteAligned vectors are scanned in
+ * place. SimdBp128 vectors are unpacked one meta block at a time and the unpacked values are scanned.
+ *
+ * The positions of all matches are appended to matches_out in ascending order.
+ */
+void scan_compressed_vector(
+    const BaseCompressedVector& vector, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+    const std::function<std::optional<CompressedVectorValueRange>(size_t block_index)>& range_for_block,
+    const ChunkID chunk_id, PosList& matches_out);
+
+/**
+ * @brief Evaluates value id predicates directly on the attribute vector of a dictionary segment
+ *
+ * Every predicate of the dictionary scan can be expressed as a range of value ids [begin_value_id, end_value_id),
+ * minus an optional excluded value id (for NotEquals). For example, `value_id < search_value_id` becomes
+ * [0, search_value_id). As NULLs are encoded as the largest value id, they are excluded by choosing end_value_id <=
+ * null_value_id.
+ */
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ChunkOffset begin_offset,
+                         const ChunkOffset end_offset, const ValueID begin_value_id, const ValueID end_value_id,
+                         const std::optional<ValueID>& excluded_value_id, const ChunkID chunk_id,
+                         PosList& matches_out);
+
+}  // namespace opossum
@@ -20,11 +20,22 @@ BaseSingleColumnTableScanImpl::BaseSingleColumnTableScanImpl(const std::shared_p
     : BaseTableScanImpl{in_table, column_id, predicate_condition} {}
 
 std::shared_ptr<PosList> BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  return scan_morsel(chunk_id, ChunkOffset{0}, _in_table->get_chunk(chunk_id)->size());
+}
+
+bool BaseSingleColumnTableScanImpl::supports_morsels() const { return true; }
+
+std::shared_ptr<PosList> BaseSingleColumnTableScanImpl::scan_morsel(ChunkID chunk_id, ChunkOffset begin_offset,
+                                                                    ChunkOffset end_offset) {
   const auto chunk = _in_table->get_chunk(chunk_id);
   const auto segment = chunk->get_segment(_left_column_id);
 
+  DebugAssert(begin_offset <= end_offset && end_offset <= chunk->size(), "Invalid morsel");
+
   auto matches_out = std::make_shared<PosList>();
-  auto context = std::make_shared<Context>(chunk_id, *matches_out);
+
+  // Data segments are scanned at the range of the morsel, reference segments at the part of their pos_list in it
+  auto context = std::make_shared<Context>(chunk_id, *matches_out, begin_offset, end_offset);
 
   resolve_data_and_segment_type(*segment, [&](const auto data_type_t, const auto& resolved_segment) {
     static_cast<AbstractSegmentVisitor*>(this)->handle_segment(resolved_segment, context);
@@ -39,7 +50,8 @@ void BaseSingleColumnTableScanImpl::handle_segment(const ReferenceSegment& segme
   const ChunkID chunk_id = context->_chunk_id;
   auto& matches_out = context->_matches_out;
 
-  auto chunk_offsets_by_chunk_id = split_pos_list_by_chunk_id(*segment.pos_list());
+  auto chunk_offsets_by_chunk_id =
+      split_pos_list_by_chunk_id(*segment.pos_list(), context->_begin_offset, context->_end_offset);
 
   // Visit each referenced segment
   for (auto& pair : chunk_offsets_by_chunk_id) {
@@ -30,6 +30,9 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public AbstractS
 
   std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) override;
 
+  bool supports_morsels() const override;
+  std::shared_ptr<PosList> scan_morsel(ChunkID chunk_id, ChunkOffset begin_offset, ChunkOffset end_offset) override;
+
   void handle_segment(const ReferenceSegment& segment, std::shared_ptr<SegmentVisitorContext> base_context) override;
 
  protected:
@@ -42,11 +45,33 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public AbstractS
     Context(const ChunkID chunk_id, PosList& matches_out, std::unique_ptr<ChunkOffsetsList> mapped_chunk_offsets)
         : _chunk_id{chunk_id}, _matches_out{matches_out}, _mapped_chunk_offsets{std::move(mapped_chunk_offsets)} {}
 
+    Context(const ChunkID chunk_id, PosList& matches_out, const ChunkOffset begin_offset, const ChunkOffset end_offset)
+        : _chunk_id{chunk_id}, _matches_out{matches_out}, _begin_offset{begin_offset}, _end_offset{end_offset} {}
+
+    // Whether the scanned segment is scanned at the contiguous range of positions [_begin_offset, _end_offset)
+    // instead of at the _mapped_chunk_offsets
+    bool scans_range() const { return _end_offset != INVALID_CHUNK_OFFSET; }
+
     const ChunkID _chunk_id;
     PosList& _matches_out;
 
     std::unique_ptr<ChunkOffsetsList> _mapped_chunk_offsets;
+
+    // The range of positions that is scanned (see scan_morsel()). Not set for the segments referenced by a
+    // ReferenceSegment, which are scanned at the _mapped_chunk_offsets.
+    const ChunkOffset _begin_offset{0};
+    const ChunkOffset _end_offset{INVALID_CHUNK_OFFSET};
   };
+
+  // Calls the functor with iterators over the positions of the iterable's segment that are scanned in the context
+  template <typename Iterable, typename Functor>
+  static void _with_iterators(const Iterable& iterable, const Context& context, const Functor& functor) {
+    if (context.scans_range()) {
+      iterable.with_iterators(context._begin_offset, context._end_offset, functor);
+    } else {
+      iterable.with_iterators(context._mapped_chunk_offsets.get(), functor);
+    }
+  }
 };
 
 }  // namespace opossum
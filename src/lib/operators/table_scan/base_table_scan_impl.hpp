@@ -24,6 +24,15 @@ class BaseTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) = 0;
 
+  /**
+   * Scans only the rows [begin_offset, end_offset) of a chunk. This allows the TableScan to split large chunks into
+   * morsels that are scanned in parallel. Only impls that return true for supports_morsels() implement this.
+   */
+  virtual bool supports_morsels() const { return false; }
+  virtual std::shared_ptr<PosList> scan_morsel(ChunkID chunk_id, ChunkOffset begin_offset, ChunkOffset end_offset) {
+    Fail("This table scan impl cannot scan parts of a chunk");
+  }
+
  protected:
   /**
    * @defgroup The hot loops of the table scan
@@ -1,5 +1,6 @@
 #include "is_null_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "storage/base_value_segment.hpp"
@@ -25,11 +26,12 @@ void IsNullTableScanImpl::handle_segment(const ReferenceSegment& base_segment,
   auto context = std::static_pointer_cast<Context>(base_context);
   BaseSingleColumnTableScanImpl::handle_segment(base_segment, base_context);
 
-  const auto pos_list = *base_segment.pos_list();
+  const auto& pos_list = *base_segment.pos_list();
 
   // Additionally to the null values in the referencED segment, we need to find null values in the referencING segment
   if (_predicate_condition == PredicateCondition::IsNull) {
-    for (ChunkOffset chunk_offset{0}; chunk_offset < pos_list.size(); ++chunk_offset) {
+    const auto end_offset = std::min(static_cast<size_t>(context->_end_offset), pos_list.size());
+    for (auto chunk_offset = context->_begin_offset; chunk_offset < end_offset; ++chunk_offset) {
       if (pos_list[chunk_offset].is_null()) context->_matches_out.emplace_back(context->_chunk_id, chunk_offset);
     }
   }
@@ -38,10 +40,9 @@ void IsNullTableScanImpl::handle_segment(const ReferenceSegment& base_segment,
 void IsNullTableScanImpl::handle_segment(const BaseValueSegment& base_segment,
                                          std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
 
   if (_matches_all(base_segment)) {
-    _add_all(*context, base_segment.size());
+    _add_all(*context);
     return;
   }
 
@@ -54,25 +55,23 @@ void IsNullTableScanImpl::handle_segment(const BaseValueSegment& base_segment,
 
   auto base_segment_iterable = NullValueVectorIterable{base_segment.null_values()};
 
-  base_segment_iterable.with_iterators(mapped_chunk_offsets.get(),
-                                       [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+  _with_iterators(base_segment_iterable, *context,
+                  [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
 }
 
 void IsNullTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment,
                                          std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
 
   auto base_segment_iterable = create_iterable_from_attribute_vector(base_segment);
 
-  base_segment_iterable.with_iterators(mapped_chunk_offsets.get(),
-                                       [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+  _with_iterators(base_segment_iterable, *context,
+                  [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
 }
 
 void IsNullTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment,
                                          std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
 
   const auto base_column_type = _in_table->column_data_type(_left_column_id);
 
@@ -82,8 +81,8 @@ void IsNullTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment,
     resolve_encoded_segment_type<Type>(base_segment, [&](const auto& typed_segment) {
       auto base_segment_iterable = create_iterable_from_segment(typed_segment);
 
-      base_segment_iterable.with_iterators(
-          mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+      _with_iterators(base_segment_iterable, *context,
+                      [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
     });
   });
 }
@@ -114,18 +113,17 @@ bool IsNullTableScanImpl::_matches_none(const BaseValueSegment& segment) {
   }
 }
 
-void IsNullTableScanImpl::_add_all(Context& context, size_t segment_size) {
+void IsNullTableScanImpl::_add_all(Context& context) {
   auto& matches_out = context._matches_out;
   const auto chunk_id = context._chunk_id;
-  const auto& mapped_chunk_offsets = context._mapped_chunk_offsets;
 
-  if (mapped_chunk_offsets) {
-    for (const auto& chunk_offsets : *mapped_chunk_offsets) {
-      matches_out.emplace_back(RowID{chunk_id, chunk_offsets.into_referencing});
+  if (context.scans_range()) {
+    for (auto chunk_offset = context._begin_offset; chunk_offset < context._end_offset; ++chunk_offset) {
+      matches_out.emplace_back(RowID{chunk_id, chunk_offset});
     }
   } else {
-    for (auto chunk_offset = 0u; chunk_offset < segment_size; ++chunk_offset) {
-      matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+    for (const auto& chunk_offsets : *context._mapped_chunk_offsets) {
+      matches_out.emplace_back(RowID{chunk_id, chunk_offsets.into_referencing});
     }
   }
 }
@@ -42,7 +42,7 @@ class IsNullTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   bool _matches_none(const BaseValueSegment& segment);
 
-  void _add_all(Context& context, size_t segment_size);
+  void _add_all(Context& context);
 
   /**@}*/
 
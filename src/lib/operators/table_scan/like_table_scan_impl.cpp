@@ -11,10 +11,12 @@
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 namespace opossum {
 
@@ -27,25 +29,26 @@ LikeTableScanImpl::LikeTableScanImpl(const std::shared_ptr<const Table>& in_tabl
 void LikeTableScanImpl::handle_segment(const BaseValueSegment& base_segment,
                                        std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
-  const auto chunk_id = context->_chunk_id;
   auto& left_segment = static_cast<const ValueSegment<std::string>&>(base_segment);
   auto left_iterable = ValueSegmentIterable<std::string>{left_segment};
 
-  _scan_iterable(left_iterable, chunk_id, matches_out, mapped_chunk_offsets.get());
+  _scan_iterable(left_iterable, *context);
 }
 
 void LikeTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment,
                                        std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
-  const auto chunk_id = context->_chunk_id;
+
+  if (base_segment.encoding_type() == EncodingType::FSST && context->scans_range()) {
+    const auto& left_segment = static_cast<const FSSTSegment<std::string>&>(base_segment);
+    _scan_fsst_segment(left_segment, context->_begin_offset, context->_end_offset, context->_chunk_id,
+                       context->_matches_out);
+    return;
+  }
 
   resolve_encoded_segment_type<std::string>(base_segment, [&](const auto& typed_segment) {
     auto left_iterable = create_iterable_from_segment(typed_segment);
-    _scan_iterable(left_iterable, chunk_id, matches_out, mapped_chunk_offsets.get());
+    _scan_iterable(left_iterable, *context);
   });
 }
 
@@ -53,7 +56,6 @@ void LikeTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment
                                        std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
   std::pair<size_t, std::vector<bool>> result;
@@ -73,7 +75,7 @@ void LikeTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment
 
   // LIKE matches all rows
   if (match_count == dictionary_matches.size()) {
-    attribute_vector_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    _with_iterators(attribute_vector_iterable, *context, [&](auto left_it, auto left_end) {
       static const auto always_true = [](const auto&) { return true; };
       this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
     });
@@ -88,17 +90,42 @@ void LikeTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment
 
   const auto dictionary_lookup = [&dictionary_matches](const ValueID& value) { return dictionary_matches[value]; };
 
-  attribute_vector_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+  _with_iterators(attribute_vector_iterable, *context, [&](auto left_it, auto left_end) {
     this->_unary_scan(dictionary_lookup, left_it, left_end, chunk_id, matches_out);
   });
 }
 
 template <typename Iterable>
-void LikeTableScanImpl::_scan_iterable(const Iterable& iterable, const ChunkID chunk_id, PosList& matches_out,
-                                       const ChunkOffsetsList* const mapped_chunk_offsets) {
+void LikeTableScanImpl::_scan_iterable(const Iterable& iterable, Context& context) {
+  _matcher.resolve(_invert_results, [&](const auto& matcher) {
+    _with_iterators(iterable, context, [&](auto left_it, auto left_end) {
+      this->_unary_scan(matcher, left_it, left_end, context._chunk_id, context._matches_out);
+    });
+  });
+}
+
+void LikeTableScanImpl::_scan_fsst_segment(const FSSTSegment<std::string>& segment, const ChunkOffset begin_offset,
+                                           const ChunkOffset end_offset, const ChunkID chunk_id, PosList& matches_out) {
+  const auto& compressed_values = segment.compressed_values();
+  const auto& null_values = segment.null_values();
+  const auto& symbol_table = segment.symbol_table();
+
   _matcher.resolve(_invert_results, [&](const auto& matcher) {
-    iterable.with_iterators(mapped_chunk_offsets, [&](auto left_it, auto left_end) {
-      this->_unary_scan(matcher, left_it, left_end, chunk_id, matches_out);
+    resolve_compressed_vector_type(segment.end_offsets(), [&](const auto& end_offsets) {
+      auto decoder = end_offsets.create_decoder();
+      auto value = std::string{};
+
+      auto codes_begin = begin_offset == 0 ? uint32_t{0} : decoder->get(begin_offset - 1);
+      for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+        const auto codes_end = decoder->get(chunk_offset);
+
+        if (!null_values[chunk_offset]) {
+          symbol_table.decompress(compressed_values.data() + codes_begin, compressed_values.data() + codes_end, value);
+          if (matcher(value)) matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+
+        codes_begin = codes_end;
+      }
     });
   });
 }
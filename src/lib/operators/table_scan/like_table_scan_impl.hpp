@@ -10,6 +10,7 @@
 #include "base_single_column_table_scan_impl.hpp"
 #include "boost/variant.hpp"
 #include "expression/evaluation/like_matcher.hpp"
+#include "storage/fsst_segment.hpp"
 
 #include "types.hpp"
 
@@ -25,6 +26,7 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the results in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments, each value is decompressed into the same buffer instead of into a new string
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -47,12 +49,15 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
 
  private:
   /**
-   * Scan the iterable (using the optional mapped_chunk_offsets) with _pattern_variant and fill the matches_out with
-   * RowIDs that match the pattern.
+   * Scan the positions of the iterable that are scanned in the context with _pattern_variant and fill the
+   * context's matches_out with RowIDs that match the pattern.
    */
   template <typename Iterable>
-  void _scan_iterable(const Iterable& iterable, const ChunkID chunk_id, PosList& matches_out,
-                      const ChunkOffsetsList* const mapped_chunk_offsets);
+  void _scan_iterable(const Iterable& iterable, Context& context);
+
+  // Scans the positions [begin_offset, end_offset) of an FSST segment
+  void _scan_fsst_segment(const FSSTSegment<std::string>& segment, const ChunkOffset begin_offset,
+                          const ChunkOffset end_offset, const ChunkID chunk_id, PosList& matches_out);
 
   /**
    * Used for dictionary segments
@@ -1,26 +1,210 @@
 #include "single_column_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "attribute_vector_scan_kernels.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Segments without an encoding-specific scan are scanned using their iterables
+template <typename Segment, typename T>
+bool scan_encoded_segment(const Segment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                          const PredicateCondition predicate_condition, const T& search_value, const ChunkID chunk_id,
+                          PosList& matches_out) {
+  return false;
+}
+
+// The predicate is evaluated once per run. The positions of matching runs are emitted as a whole.
+template <typename T>
+bool scan_encoded_segment(const RunLengthSegment<T>& segment, const ChunkOffset begin_offset,
+                          const ChunkOffset end_offset, const PredicateCondition predicate_condition,
+                          const T& search_value, const ChunkID chunk_id, PosList& matches_out) {
+  const auto& values = *segment.values();
+  const auto& null_values = *segment.null_values();
+  const auto& end_positions = *segment.end_positions();
+
+  with_comparator(predicate_condition, [&](auto comparator) {
+    // End positions are inclusive. Start with the run that contains begin_offset.
+    const auto first_run = std::lower_bound(end_positions.cbegin(), end_positions.cend(), begin_offset);
+    auto run_index = static_cast<size_t>(std::distance(end_positions.cbegin(), first_run));
+    auto run_begin = begin_offset;
+    for (; run_begin < end_offset; ++run_index) {
+      const auto run_end = std::min(static_cast<ChunkOffset>(end_positions[run_index] + 1), end_offset);
+
+      if (!null_values[run_index] && comparator(values[run_index], search_value)) {
+        for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+          matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+
+      run_begin = run_end;
+    }
+  });
+
+  return true;
+}
+
+/**
+ * The predicate is turned into a range of offsets per block, relative to the block's minimum. Blocks whose minimum
+ * shows that they cannot contain any matches are skipped without decoding their offsets. The other blocks are scanned
+ * using the kernels in attribute_vector_scan_kernels.hpp.
+ */
+template <typename T>
+bool scan_encoded_segment(const FrameOfReferenceSegment<T>& segment, const ChunkOffset begin_offset,
+                          const ChunkOffset end_offset, const PredicateCondition predicate_condition,
+                          const T& search_value, const ChunkID chunk_id, PosList& matches_out) {
+  static_assert(FrameOfReferenceSegment<T>::block_size == COMPRESSED_VECTOR_SCAN_BLOCK_SIZE,
+                "FrameOfReference blocks must be scanned as a whole");
+
+  // The matching values are [first_value, last_value], except for excluded_value
+  auto first_value = std::numeric_limits<T>::min();
+  auto last_value = std::numeric_limits<T>::max();
+  auto excluded_value = std::optional<T>{};
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      first_value = search_value;
+      last_value = search_value;
+      break;
+
+    case PredicateCondition::NotEquals:
+      excluded_value = search_value;
+      break;
+
+    case PredicateCondition::LessThan:
+      if (search_value == std::numeric_limits<T>::min()) return true;
+      last_value = search_value - 1;
+      break;
+
+    case PredicateCondition::LessThanEquals:
+      last_value = search_value;
+      break;
+
+    case PredicateCondition::GreaterThan:
+      if (search_value == std::numeric_limits<T>::max()) return true;
+      first_value = search_value + 1;
+      break;
+
+    case PredicateCondition::GreaterThanEquals:
+      first_value = search_value;
+      break;
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+
+  // Offsets are computed in the unsigned type, where the difference of two values does not overflow
+  using UnsignedT = std::make_unsigned_t<T>;
+  constexpr auto max_offset = UnsignedT{std::numeric_limits<uint32_t>::max()};
+  const auto offset = [](const T value, const T block_minimum) {
+    return static_cast<UnsignedT>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(block_minimum));
+  };
+
+  const auto& block_minima = segment.block_minima();
+  const auto range_for_block = [&](const size_t block_index) -> std::optional<CompressedVectorValueRange> {
+    const auto block_minimum = block_minima[block_index];
+    if (last_value < block_minimum) return std::nullopt;
+
+    const auto first_offset = first_value <= block_minimum ? UnsignedT{0} : offset(first_value, block_minimum);
+    const auto last_offset = offset(last_value, block_minimum);
+    if constexpr (sizeof(UnsignedT) > sizeof(uint32_t)) {
+      if (first_offset > max_offset) return std::nullopt;
+    }
+
+    auto range = CompressedVectorValueRange{static_cast<uint32_t>(first_offset),
+                                            static_cast<uint32_t>(std::min(last_offset, max_offset)), std::nullopt};
+    if (excluded_value && *excluded_value >= block_minimum && offset(*excluded_value, block_minimum) <= max_offset) {
+      range.excluded_value = static_cast<uint32_t>(offset(*excluded_value, block_minimum));
+    }
+    return range;
+  };
+
+  const auto first_match_index = matches_out.size();
+  scan_compressed_vector(segment.offset_values(), begin_offset, end_offset, range_for_block, chunk_id, matches_out);
+
+  // NULLs are stored as regular offsets and have to be removed from the matches. Only the scanned range is searched
+  // for NULLs, as the segment is scanned once per morsel.
+  const auto& null_values = segment.null_values();
+  const auto null_values_end = null_values.cbegin() + end_offset;
+  if (std::find(null_values.cbegin() + begin_offset, null_values_end, true) != null_values_end) {
+    const auto first_match = matches_out.begin() + first_match_index;
+    matches_out.erase(std::remove_if(first_match, matches_out.end(),
+                                     [&](const RowID& row_id) { return null_values[row_id.chunk_offset]; }),
+                      matches_out.end());
+  }
+
+  return true;
+}
+
+/**
+ * Equality is evaluated on the codes, which are equal if and only if the strings are (see FSSTSymbolTable). The search
+ * value is compressed once and the strings are not decompressed. Other predicates fall back to the iterables.
+ */
+template <typename T>
+bool scan_encoded_segment(const FSSTSegment<T>& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                          const PredicateCondition predicate_condition, const T& search_value, const ChunkID chunk_id,
+                          PosList& matches_out) {
+  if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals) {
+    return false;
+  }
+
+  auto search_codes = pmr_vector<uint8_t>{};
+  segment.symbol_table().compress(search_value, search_codes);
+
+  const auto match_equal_values = predicate_condition == PredicateCondition::Equals;
+  const auto& compressed_values = segment.compressed_values();
+  const auto& null_values = segment.null_values();
+
+  resolve_compressed_vector_type(segment.end_offsets(), [&](const auto& end_offsets) {
+    auto decoder = end_offsets.create_decoder();
+
+    auto codes_begin = begin_offset == 0 ? uint32_t{0} : decoder->get(begin_offset - 1);
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      const auto codes_end = decoder->get(chunk_offset);
+
+      if (!null_values[chunk_offset]) {
+        const auto is_equal = codes_end - codes_begin == search_codes.size() &&
+                              std::equal(search_codes.cbegin(), search_codes.cend(),
+                                         compressed_values.cbegin() + codes_begin);
+        if (is_equal == match_equal_values) matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+      }
+
+      codes_begin = codes_end;
+    }
+  });
+
+  return true;
+}
+
+}  // namespace
+
 SingleColumnTableScanImpl::SingleColumnTableScanImpl(const std::shared_ptr<const Table>& in_table,
                                                      const ColumnID left_column_id,
                                                      const PredicateCondition& predicate_condition,
                                                      const AllTypeVariant& right_value)
     : BaseSingleColumnTableScanImpl{in_table, left_column_id, predicate_condition}, _right_value{right_value} {}
 
-std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_morsel(ChunkID chunk_id, ChunkOffset begin_offset,
+                                                                ChunkOffset end_offset) {
   // early outs for specific NULL semantics
   if (variant_is_null(_right_value)) {
     /**
@@ -32,14 +216,13 @@ std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id)
     return std::make_shared<PosList>();
   }
 
-  return BaseSingleColumnTableScanImpl::scan_chunk(chunk_id);
+  return BaseSingleColumnTableScanImpl::scan_morsel(chunk_id, begin_offset, end_offset);
 }
 
 void SingleColumnTableScanImpl::handle_segment(const BaseValueSegment& base_segment,
                                                std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
   const auto left_column_type = _in_table->column_data_type(_left_column_id);
@@ -51,7 +234,7 @@ void SingleColumnTableScanImpl::handle_segment(const BaseValueSegment& base_segm
 
     auto left_segment_iterable = create_iterable_from_segment(left_segment);
 
-    left_segment_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    _with_iterators(left_segment_iterable, *context, [&](auto left_it, auto left_end) {
       with_comparator(_predicate_condition, [&](auto comparator) {
         _unary_scan_with_value(comparator, left_it, left_end, type_cast<ColumnDataType>(_right_value), chunk_id,
                                matches_out);
@@ -64,7 +247,6 @@ void SingleColumnTableScanImpl::handle_segment(const BaseEncodedSegment& base_se
                                                std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
   const auto left_column_type = _in_table->column_data_type(_left_column_id);
@@ -73,9 +255,16 @@ void SingleColumnTableScanImpl::handle_segment(const BaseEncodedSegment& base_se
     using Type = typename decltype(type)::type;
 
     resolve_encoded_segment_type<Type>(base_segment, [&](const auto& typed_segment) {
+      // Encoding-specific scans are only used for contiguous ranges of positions
+      if (context->scans_range() &&
+          scan_encoded_segment(typed_segment, context->_begin_offset, context->_end_offset, _predicate_condition,
+                               type_cast<Type>(_right_value), chunk_id, matches_out)) {
+        return;
+      }
+
       auto left_segment_iterable = create_iterable_from_segment(typed_segment);
 
-      left_segment_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+      _with_iterators(left_segment_iterable, *context, [&](auto left_it, auto left_end) {
         with_comparator(_predicate_condition, [&](auto comparator) {
           _unary_scan_with_value(comparator, left_it, left_end, type_cast<Type>(_right_value), chunk_id, matches_out);
         });
@@ -120,9 +309,22 @@ void SingleColumnTableScanImpl::handle_segment(const BaseDictionarySegment& base
    * value_id >= value | search_vid == 0                       | search_vid == INVALID_VALUE_ID
    */
 
+  const auto matches_all = _right_value_matches_all(base_segment, search_value_id);
+
+  if (!matches_all && _right_value_matches_none(base_segment, search_value_id)) {
+    return;
+  }
+
+  if (context->scans_range()) {
+    // Contiguous ranges of positions are scanned directly on the attribute vector
+    _scan_attribute_vector(base_segment, context->_begin_offset, context->_end_offset, search_value_id, matches_all,
+                           chunk_id, matches_out);
+    return;
+  }
+
   auto left_iterable = create_iterable_from_attribute_vector(base_segment);
 
-  if (_right_value_matches_all(base_segment, search_value_id)) {
+  if (matches_all) {
     left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
       static const auto always_true = [](const auto&) { return true; };
       this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
@@ -131,10 +333,6 @@ void SingleColumnTableScanImpl::handle_segment(const BaseDictionarySegment& base
     return;
   }
 
-  if (_right_value_matches_none(base_segment, search_value_id)) {
-    return;
-  }
-
   left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
     this->_with_operator_for_dict_segment_scan(_predicate_condition, [&](auto comparator) {
       this->_unary_scan_with_value(comparator, left_it, left_end, search_value_id, chunk_id, matches_out);
@@ -142,6 +340,49 @@ void SingleColumnTableScanImpl::handle_segment(const BaseDictionarySegment& base
   });
 }
 
+void SingleColumnTableScanImpl::_scan_attribute_vector(const BaseDictionarySegment& segment,
+                                                       const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                                       const ValueID search_value_id, const bool matches_all,
+                                                       const ChunkID chunk_id, PosList& matches_out) const {
+  const auto null_value_id = segment.null_value_id();
+  const auto& attribute_vector = *segment.attribute_vector();
+
+  // All value ids except the one of NULL
+  if (matches_all) {
+    scan_value_id_range(attribute_vector, begin_offset, end_offset, ValueID{0u}, null_value_id, std::nullopt,
+                        chunk_id, matches_out);
+    return;
+  }
+
+  // See the table of conditions in handle_segment()
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      scan_value_id_range(attribute_vector, begin_offset, end_offset, search_value_id, ValueID{search_value_id + 1},
+                          std::nullopt, chunk_id, matches_out);
+      return;
+
+    case PredicateCondition::NotEquals:
+      scan_value_id_range(attribute_vector, begin_offset, end_offset, ValueID{0u}, null_value_id, search_value_id,
+                          chunk_id, matches_out);
+      return;
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      scan_value_id_range(attribute_vector, begin_offset, end_offset, ValueID{0u}, search_value_id, std::nullopt,
+                          chunk_id, matches_out);
+      return;
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      scan_value_id_range(attribute_vector, begin_offset, end_offset, search_value_id, null_value_id, std::nullopt,
+                          chunk_id, matches_out);
+      return;
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
 ValueID SingleColumnTableScanImpl::_get_search_value_id(const BaseDictionarySegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::Equals:
@@ -26,7 +26,7 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
   SingleColumnTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID left_column_id,
                             const PredicateCondition& predicate_condition, const AllTypeVariant& right_value);
 
-  std::shared_ptr<PosList> scan_chunk(ChunkID) override;
+  std::shared_ptr<PosList> scan_morsel(ChunkID chunk_id, ChunkOffset begin_offset, ChunkOffset end_offset) override;
 
   void handle_segment(const BaseValueSegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
@@ -51,6 +51,11 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   bool _right_value_matches_none(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
 
+  // Scans the positions [begin_offset, end_offset) using the kernels in attribute_vector_scan_kernels.hpp
+  void _scan_attribute_vector(const BaseDictionarySegment& segment, const ChunkOffset begin_offset,
+                              const ChunkOffset end_offset, const ValueID search_value_id, const bool matches_all,
+                              const ChunkID chunk_id, PosList& matches_out) const;
+
   template <typename Functor>
   void _with_operator_for_dict_segment_scan(const PredicateCondition predicate_condition, const Functor& func) const {
     switch (predicate_condition) {
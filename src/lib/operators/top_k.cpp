@@ -0,0 +1,192 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/materialize_sorted_rows.hpp"
+#include "sort/normalized_sort_key.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The sorted k smallest keys of a chunk. Their bytes are stored in `key_data`.
+struct TopKCandidates {
+  std::vector<uint8_t> key_data;
+  std::vector<NormalizedSortKey> keys;
+};
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in,
+           const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression, const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Expected at least one column to sort by");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+const std::string TopK::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << _row_count_expression->as_column_name() << separator << "{";
+  for (auto sort_definition_idx = size_t{0}; sort_definition_idx < _sort_definitions.size(); ++sort_definition_idx) {
+    const auto& sort_definition = _sort_definitions[sort_definition_idx];
+    stream << "Column #" << sort_definition.column << " "
+           << order_by_mode_to_string.at(sort_definition.order_by_mode);
+
+    if (sort_definition_idx + 1 < _sort_definitions.size()) stream << ", ";
+  }
+  stream << "}";
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopK>(copied_input_left, _sort_definitions, _row_count_expression->deep_copy(),
+                                _output_chunk_size);
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  /**
+   * Evaluate the _row_count_expression to determine the number of rows to return
+   */
+  const auto num_rows_expression_result =
+      ExpressionEvaluator{}.evaluate_expression_to_result<int64_t>(*_row_count_expression);
+  Assert(num_rows_expression_result->size() == 1, "Expected exactly one row for TopK");
+  Assert(!num_rows_expression_result->is_null(0), "Expected non-null for TopK");
+
+  const auto signed_num_rows = num_rows_expression_result->value(0);
+  Assert(signed_num_rows >= 0, "Can't Limit to a negative number of Rows");
+
+  const auto num_rows = std::min(static_cast<size_t>(signed_num_rows), static_cast<size_t>(input_table->row_count()));
+
+  if (num_rows == 0) return materialize_sorted_rows(input_table, PosList{}, _output_chunk_size);
+
+  auto sort_column_data_types = std::vector<DataType>{};
+  sort_column_data_types.reserve(_sort_definitions.size());
+  for (const auto& sort_definition : _sort_definitions) {
+    sort_column_data_types.emplace_back(input_table->column_data_type(sort_definition.column));
+  }
+
+  /**
+   * 1. Determine the num_rows smallest keys of each chunk
+   */
+  auto candidates_by_chunk_id = std::vector<TopKCandidates>(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+      if (chunk_size == 0) return;
+
+      auto chunk_key_data = std::vector<uint8_t>{};
+      auto keys = std::vector<NormalizedSortKey>(chunk_size);
+      build_normalized_sort_keys(*chunk, chunk_id, _sort_definitions, sort_column_data_types, chunk_key_data,
+                                 keys.data());
+
+      // std::partial_sort keeps the candidates in a heap bounded by the number of requested rows
+      const auto candidate_count = std::min(num_rows, static_cast<size_t>(chunk_size));
+      std::partial_sort(keys.begin(), keys.begin() + candidate_count, keys.end());
+      keys.resize(candidate_count);
+
+      auto& candidates = candidates_by_chunk_id[chunk_id];
+
+      if (candidate_count == chunk_size) {
+        // All keys are candidates, moving the vector keeps the keys' data pointers valid
+        candidates.key_data = std::move(chunk_key_data);
+      } else {
+        // Copy the candidates' bytes so that the keys of all other rows can be freed
+        auto candidate_key_data_size = size_t{0};
+        for (const auto& key : keys) {
+          candidate_key_data_size += key.size;
+        }
+        candidates.key_data.resize(candidate_key_data_size);
+
+        auto candidate_key_data = candidates.key_data.data();
+        for (auto& key : keys) {
+          std::memcpy(candidate_key_data, key.data, key.size);
+          key.data = candidate_key_data;
+          candidate_key_data += key.size;
+        }
+      }
+
+      candidates.keys = std::move(keys);
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * 2. Merge the sorted candidates of all chunks. The heap holds the position of the smallest remaining candidate of
+   *    each chunk.
+   */
+  using CandidatePosition = std::pair<ChunkID, size_t>;
+  const auto candidate_greater = [&](const CandidatePosition& lhs, const CandidatePosition& rhs) {
+    return candidates_by_chunk_id[rhs.first].keys[rhs.second] < candidates_by_chunk_id[lhs.first].keys[lhs.second];
+  };
+  auto candidate_heap =
+      std::priority_queue<CandidatePosition, std::vector<CandidatePosition>, decltype(candidate_greater)>{
+          candidate_greater};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!candidates_by_chunk_id[chunk_id].keys.empty()) candidate_heap.emplace(chunk_id, 0);
+  }
+
+  auto row_ids = PosList{};
+  row_ids.reserve(num_rows);
+
+  while (row_ids.size() < num_rows) {
+    const auto [chunk_id, candidate_index] = candidate_heap.top();  // NOLINT
+    candidate_heap.pop();
+
+    const auto& chunk_candidates = candidates_by_chunk_id[chunk_id].keys;
+    row_ids.emplace_back(chunk_candidates[candidate_index].row_id);
+
+    if (candidate_index + 1 < chunk_candidates.size()) candidate_heap.emplace(chunk_id, candidate_index + 1);
+  }
+
+  /**
+   * 3. Materialize the result rows
+   */
+  return materialize_sorted_rows(input_table, row_ids, _output_chunk_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "sort.hpp"
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first `row_count_expression` rows of its input in the order defined by the
+ * SortColumnDefinitions, i.e., Sort followed by Limit in one step. It is chosen by the LQPTranslator for LimitNodes
+ * that the TopKRule marked as LimitType::TopK.
+ *
+ * For each chunk, a job builds the normalized sort keys (see normalized_sort_key.hpp) and keeps only the k smallest
+ * ones in a bounded heap. The sorted per-chunk candidates are then merged and only the k result rows are materialized,
+ * so that neither the whole input is sorted nor every input row is copied. Like Sort, TopK is stable.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  // The parameter chunk_size sets the chunk size of the output table, which will always be materialized
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression,
+       const size_t output_chunk_size = Chunk::MAX_SIZE);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+  const size_t _output_chunk_size;
+};
+
+}  // namespace opossum
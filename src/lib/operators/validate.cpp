@@ -1,11 +1,17 @@
 #include "validate.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
@@ -28,6 +34,51 @@ bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset c
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+// Returns whether the visibility summary of a chunk guarantees that its first `row_count` rows are visible
+bool all_rows_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset row_count, const MvccData& mvcc_data) {
+  // Rows locked by the invalid transaction id would be visible to it, so it must not use the summary
+  if (our_tid == TransactionManager::INVALID_TRANSACTION_ID) return false;
+
+  const auto visibility_summary = mvcc_data.visibility_summary();
+  return visibility_summary && visibility_summary->row_count >= row_count &&
+         visibility_summary->max_begin_cid <= snapshot_commit_id;
+}
+
+// Checks the rows [0, row_count) of a data chunk. As this touches all rows, it also computes the visibility summary of
+// the chunk on the way and stores it if all rows are committed and neither locked nor deleted.
+void validate_data_chunk(CommitID our_tid, CommitID snapshot_commit_id, ChunkID chunk_id, ChunkOffset row_count,
+                         const MvccData& mvcc_data, PosList& pos_list_out) {
+  const auto visibility_summary_generation = mvcc_data.visibility_summary_generation();
+
+  pos_list_out.resize(row_count);
+
+  auto visible_row_count = ChunkOffset{0};
+  auto all_rows_committed = true;
+  auto max_begin_cid = CommitID{0};
+
+  // The loop is free of branches: each RowID is written unconditionally and only kept (by advancing the output
+  // position) if the row is visible. This avoids mispredictions on chunks with interleaved visible and invisible rows.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    const auto row_tid = mvcc_data.tids[chunk_offset].load();
+    const auto begin_cid = mvcc_data.begin_cids[chunk_offset];
+    const auto end_cid = mvcc_data.end_cids[chunk_offset];
+
+    const auto visible = snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
+    pos_list_out[visible_row_count] = RowID{chunk_id, chunk_offset};
+    visible_row_count += visible;
+
+    all_rows_committed &= row_tid == TransactionManager::INVALID_TRANSACTION_ID &&
+                          begin_cid != MvccData::MAX_COMMIT_ID && end_cid == MvccData::MAX_COMMIT_ID;
+    max_begin_cid = std::max(max_begin_cid, begin_cid);
+  }
+
+  pos_list_out.resize(visible_row_count);
+
+  if (all_rows_committed && row_count > 0) {
+    mvcc_data.set_visibility_summary({row_count, max_begin_cid}, visibility_summary_generation);
+  }
+}
+
 }  // namespace
 
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
@@ -56,67 +107,102 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = in_table->get_chunk(chunk_id);
+  const auto chunk_count = in_table->chunk_count();
 
-    Segments output_segments;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
+  // The chunks are validated in parallel. Each job writes the segments of its output chunk to its own slot so that the
+  // output chunks keep the order of the input chunks.
+  auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
 
-    // If the segments in this chunk reference a segment, build a poslist for a reference segment.
-    if (ref_segment_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_segment_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+      auto& output_segments = output_segments_by_chunk[chunk_id];
 
-      for (auto row_id : *ref_segment_in->pos_list()) {
-        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+      auto pos_list_out = std::make_shared<PosList>();
+      const auto ref_segment_in =
+          std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
 
-        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+      // If the segments in this chunk reference a segment, build a poslist for a reference segment.
+      if (ref_segment_in) {
+        DebugAssert(chunk_in->references_exactly_one_table(),
+                    "Input to Validate contains a Chunk referencing more than one table.");
 
-        if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-          pos_list_out->emplace_back(row_id);
+        const auto referenced_table = ref_segment_in->referenced_table();
+        DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+
+        const auto& pos_list_in = *ref_segment_in->pos_list();
+        pos_list_out->reserve(pos_list_in.size());
+
+        // Check all rows in the old poslist and put them in pos_list_out if they are visible. Consecutive positions
+        // usually point into the same chunk, so the MVCC data is locked once per such run of positions.
+        for (auto run_begin = pos_list_in.begin(); run_begin != pos_list_in.end();) {
+          const auto referenced_chunk_id = run_begin->chunk_id;
+          const auto run_end = std::find_if(run_begin, pos_list_in.end(), [&](const auto& row_id) {
+            return row_id.chunk_id != referenced_chunk_id;
+          });
+
+          const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+          const auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+
+          if (all_rows_visible(our_tid, snapshot_commit_id, referenced_chunk->size(), *mvcc_data)) {
+            pos_list_out->insert(pos_list_out->end(), run_begin, run_end);
+          } else {
+            std::copy_if(run_begin, run_end, std::back_inserter(*pos_list_out), [&](const auto& row_id) {
+              return is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data);
+            });
+          }
+
+          run_begin = run_end;
         }
-      }
 
-      // Construct the actual ReferenceSegment objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto reference_segment =
-            std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
-        const auto referenced_column_id = reference_segment->referenced_column_id();
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
-      }
+        // If all rows are visible, the input poslist can be shared instead of the copy
+        const auto output_pos_list = pos_list_out->size() == pos_list_in.size()
+                                         ? ref_segment_in->pos_list()
+                                         : std::shared_ptr<const PosList>{pos_list_out};
+
+        // Construct the actual ReferenceSegment objects and add them to the chunk.
+        for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+          const auto reference_segment =
+              std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
+          const auto referenced_column_id = reference_segment->referenced_column_id();
+          output_segments.push_back(
+              std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list));
+        }
 
-      // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
-    } else {
-      referenced_table = in_table;
-      DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
-      const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
-
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
+        // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
+      } else {
+        DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
+        const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
+        const auto chunk_size = chunk_in->size();
+
+        if (all_rows_visible(our_tid, snapshot_commit_id, chunk_size, *mvcc_data)) {
+          pos_list_out->resize(chunk_size);
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            (*pos_list_out)[chunk_offset] = RowID{chunk_id, chunk_offset};
+          }
+        } else {
+          validate_data_chunk(our_tid, snapshot_commit_id, chunk_id, chunk_size, *mvcc_data, *pos_list_out);
         }
-      }
 
-      // Create actual ReferenceSegment objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+        // Create actual ReferenceSegment objects.
+        for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+          output_segments.push_back(std::make_shared<ReferenceSegment>(in_table, column_id, pos_list_out));
+        }
       }
-    }
 
-    if (!pos_list_out->empty() > 0) {
-      output->append_chunk(output_segments);
-    }
+      if (pos_list_out->empty()) output_segments.clear();
+    }));
   }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& output_segments : output_segments_by_chunk) {
+    if (!output_segments.empty()) output->append_chunk(output_segments);
+  }
+
   return output;
 }
 
@@ -0,0 +1,30 @@
+#include "top_k_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+
+namespace opossum {
+
+std::string TopKRule::name() const { return "TopK Rule"; }
+
+bool TopKRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  auto rewritten = false;
+
+  if (node->type == LQPNodeType::Limit) {
+    const auto& input = node->left_input();
+    const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+
+    if (input->type == LQPNodeType::Sort && input->output_count() == 1 && limit_node->limit_type != LimitType::TopK) {
+      limit_node->limit_type = LimitType::TopK;
+      rewritten = true;
+    }
+  }
+
+  const auto inputs_rewritten = _apply_to_inputs(node);
+  return rewritten || inputs_rewritten;
+}
+
+}  // namespace opossum
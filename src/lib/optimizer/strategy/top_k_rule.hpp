@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule finds LimitNodes whose input is a SortNode (i.e., ORDER BY ... LIMIT k) and sets their LimitType
+ * to TopK. The LQPTranslator then translates both nodes into a single TopK operator, which does not have to sort and
+ * materialize the entire input.
+ *
+ * SortNodes that are used by other nodes as well are not fused, as their full output is needed anyway.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
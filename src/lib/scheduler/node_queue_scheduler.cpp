@@ -76,6 +76,11 @@ void NodeQueueScheduler::finish() {
     processing_unit->shutdown();
   }
 
+  // Parked workers would otherwise only notice the shutdown once their parking duration expires
+  for (auto& queue : _queues) {
+    queue->wake_all_parked_workers();
+  }
+
   for (auto& processing_unit : _processing_units) {
     processing_unit->join();
   }
@@ -118,5 +123,13 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
+
+  // push() wakes up a parked worker of the preferred node. If there is none, all workers of that node are busy and a
+  // parked worker of another node can steal the task.
+  if (_queues.size() > 1 && task->is_stealable() && !queue->has_parked_workers()) {
+    for (const auto& other_queue : _queues) {
+      if (other_queue != queue && other_queue->wake_parked_worker()) break;
+    }
+  }
 }
 }  // namespace opossum
@@ -69,6 +69,14 @@ namespace opossum {
  * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
  * Afterwards, the current worker is checking its local queue gain.
  *
+ *
+ * IDLE WORKERS
+ *
+ * A worker that neither finds a task in its queue nor one to steal retries for a few rounds and then parks on the
+ * TaskQueue of its node. Pushing a task into a queue wakes up one of the workers parked on it. If no worker of that
+ * node is parked, the scheduler wakes up a parked worker of another node, which can then steal the task. Each
+ * TaskQueue counts how long tasks waited before they were pulled (see TaskQueue::Statistics).
+ *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
 
@@ -1,6 +1,8 @@
 #include "task_queue.hpp"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "abstract_task.hpp"
@@ -21,13 +23,17 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+  _queues[priority].push({task, std::chrono::steady_clock::now()});
 
+  // _num_tasks has to be incremented before checking for parked workers. park_worker() does it the other way round, so
+  // that either the worker sees the new task or we see the parked worker.
   _num_tasks++;
+
+  wake_parked_worker();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull(SchedulePriority min_priority) {
-  std::shared_ptr<AbstractTask> task;
+  QueuedTask queued_task;
   for (auto priority :
        {SchedulePriority::JobTask, SchedulePriority::Highest, SchedulePriority::Default, SchedulePriority::Lowest}) {
     if (priority > min_priority) {
@@ -35,30 +41,88 @@ std::shared_ptr<AbstractTask> TaskQueue::pull(SchedulePriority min_priority) {
     }
     auto& queue = _queues[static_cast<uint32_t>(priority)];
 
-    if (queue.try_pop(task)) {
+    if (queue.try_pop(queued_task)) {
       _num_tasks--;
-      return task;
+      _on_task_dequeued(queued_task);
+      return queued_task.task;
     }
   }
   return nullptr;
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
+  QueuedTask queued_task;
   for (auto priority :
        {SchedulePriority::JobTask, SchedulePriority::Highest, SchedulePriority::Default, SchedulePriority::Lowest}) {
     auto& queue = _queues[static_cast<uint32_t>(priority)];
 
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
+    if (queue.try_pop(queued_task)) {
+      if (queued_task.task->is_stealable()) {
         _num_tasks--;
-        return task;
+        _on_task_dequeued(queued_task);
+        return queued_task.task;
       } else {
-        queue.push(task);
+        queue.push(queued_task);
       }
     }
   }
   return nullptr;
 }
 
+void TaskQueue::park_worker(const std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> lock(_parking_mutex);
+
+  _num_currently_parked_workers++;
+
+  if (empty()) {
+    _num_parked_workers++;
+    _parking_cv.wait_for(lock, timeout);
+  }
+
+  _num_currently_parked_workers--;
+}
+
+bool TaskQueue::wake_parked_worker() {
+  if (_num_currently_parked_workers == 0) return false;
+
+  {
+    // Taking the mutex makes sure that a worker that is about to park is either already waiting or sees the new task
+    std::lock_guard<std::mutex> lock(_parking_mutex);
+    _num_wakeups++;
+  }
+  _parking_cv.notify_one();
+  return true;
+}
+
+bool TaskQueue::has_parked_workers() const { return _num_currently_parked_workers > 0; }
+
+void TaskQueue::wake_all_parked_workers() {
+  std::lock_guard<std::mutex> lock(_parking_mutex);
+  _parking_cv.notify_all();
+}
+
+TaskQueue::Statistics TaskQueue::statistics() const {
+  auto statistics = Statistics{};
+  statistics.num_dequeued_tasks = _num_dequeued_tasks;
+  statistics.total_queue_time = std::chrono::nanoseconds{_total_queue_time_ns};
+  statistics.max_queue_time = std::chrono::nanoseconds{_max_queue_time_ns};
+  statistics.num_parked_workers = _num_parked_workers;
+  statistics.num_wakeups = _num_wakeups;
+  return statistics;
+}
+
+void TaskQueue::_on_task_dequeued(const QueuedTask& queued_task) {
+  const auto queue_time_ns = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - queued_task.enqueue_time)
+          .count());
+
+  _num_dequeued_tasks++;
+  _total_queue_time_ns += queue_time_ns;
+
+  auto max_queue_time_ns = _max_queue_time_ns.load();
+  while (queue_time_ns > max_queue_time_ns &&
+         !_max_queue_time_ns.compare_exchange_weak(max_queue_time_ns, queue_time_ns)) {
+  }
+}
+
 }  // namespace opossum
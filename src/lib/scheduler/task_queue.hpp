@@ -4,7 +4,10 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "types.hpp"
 
@@ -14,11 +17,25 @@ class AbstractTask;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Workers that find neither a task in this queue nor one to steal park on the queue of their node. Pushing a task
+ * wakes up one of them, so that idle workers react to new tasks immediately instead of polling the queues.
  */
 class TaskQueue {
  public:
   static constexpr uint32_t NUM_PRIORITY_LEVELS = 4;
 
+  /**
+   * Counters to monitor the scheduling latency, i.e., the time tasks spend in the queue before being pulled or stolen
+   */
+  struct Statistics {
+    uint64_t num_dequeued_tasks{0};
+    std::chrono::nanoseconds total_queue_time{0};
+    std::chrono::nanoseconds max_queue_time{0};
+    uint64_t num_parked_workers{0};  // Number of times a worker parked on this queue
+    uint64_t num_wakeups{0};         // Number of times a parked worker was signalled
+  };
+
   explicit TaskQueue(NodeID node_id);
 
   bool empty() const;
@@ -39,10 +56,44 @@ class TaskQueue {
    */
   std::shared_ptr<AbstractTask> steal();
 
+  /**
+   * Blocks the calling worker until a task is pushed to this queue, wake_parked_worker() or wake_all_parked_workers()
+   * is called, or the timeout expires. Returns immediately if the queue is not empty.
+   */
+  void park_worker(const std::chrono::microseconds timeout);
+
+  /**
+   * Wakes up one parked worker, returns false if no worker is parked on this queue
+   */
+  bool wake_parked_worker();
+
+  bool has_parked_workers() const;
+
+  void wake_all_parked_workers();
+
+  Statistics statistics() const;
+
  private:
+  struct QueuedTask {
+    std::shared_ptr<AbstractTask> task;
+    std::chrono::steady_clock::time_point enqueue_time;
+  };
+
+  void _on_task_dequeued(const QueuedTask& queued_task);
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  std::array<tbb::concurrent_queue<QueuedTask>, NUM_PRIORITY_LEVELS> _queues;
   std::atomic_uint _num_tasks{0};
+
+  std::mutex _parking_mutex;
+  std::condition_variable _parking_cv;
+  std::atomic_uint _num_currently_parked_workers{0};
+
+  std::atomic<uint64_t> _num_dequeued_tasks{0};
+  std::atomic<uint64_t> _total_queue_time_ns{0};
+  std::atomic<uint64_t> _max_queue_time_ns{0};
+  std::atomic<uint64_t> _num_parked_workers{0};
+  std::atomic<uint64_t> _num_wakeups{0};
 };
 
 }  // namespace opossum
@@ -55,6 +55,9 @@ void Worker::operator()() {
 
   DebugAssert(static_cast<bool>(processing_unit), "No processing unit");
 
+  // Number of consecutive iterations in which this worker did not find a task
+  auto idle_rounds = uint32_t{0};
+
   while (!processing_unit->shutdown_flag()) {
     // Hibernate if this is not the active worker.
     {
@@ -93,13 +96,20 @@ void Worker::operator()() {
         }
       }
 
-      // Sleep if there is no ready task in our queue and work stealing was not successful.
+      // If there is no ready task in our queue and work stealing was not successful, spin for a few rounds first, as
+      // short queries often schedule their next task right away. Afterwards, park until a task is pushed to our queue.
       if (!work_stealing_successful) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (idle_rounds < SPIN_ROUNDS_BEFORE_PARKING) {
+          ++idle_rounds;
+          std::this_thread::yield();
+        } else {
+          _queue->park_worker(MAX_PARKING_DURATION);
+        }
         continue;
       }
     }
 
+    idle_rounds = 0;
     task->execute();
 
     // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
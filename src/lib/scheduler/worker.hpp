@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -21,6 +22,13 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   friend class NodeQueueScheduler;
 
  public:
+  // An idle worker retries to pull or steal a task this many times before it parks on its TaskQueue
+  static constexpr uint32_t SPIN_ROUNDS_BEFORE_PARKING = 64;
+
+  // Parked workers are woken up by tasks pushed to their own queue. Tasks on other nodes do not necessarily wake them,
+  // so they periodically check whether there is something to steal.
+  static constexpr std::chrono::microseconds MAX_PARKING_DURATION{10'000};
+
   static std::shared_ptr<Worker> get_this_thread_worker();
 
   Worker(const std::weak_ptr<ProcessingUnit>& processing_unit, const std::shared_ptr<TaskQueue>& queue, WorkerID id,
@@ -1,6 +1,8 @@
 #include "client_connection.hpp"
 
 #include <boost/asio.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
 
 #include "postgres_wire_handler.hpp"
 #include "then_operator.hpp"
@@ -65,6 +67,19 @@ boost::future<std::string> ClientConnection::receive_execute_packet_body(uint32_
   return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_execute_packet;
 }
 
+boost::future<ByteBuffer> ClientConnection::receive_copy_data_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_data_packet;
+}
+
+boost::future<void> ClientConnection::receive_copy_done_packet_body(uint32_t size) {
+  // Packet has no content, we'll make the receive call anyways, just in case size > 0
+  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+}
+
+boost::future<std::string> ClientConnection::receive_copy_fail_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_fail_packet;
+}
+
 boost::future<void> ClientConnection::send_ssl_denied() {
   // Don't use new_output_packet here, because this packet has special size requirements (only contains N, no size)
   auto output_packet = std::make_shared<OutputPacket>();
@@ -166,55 +181,75 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
     PostgresWireHandler::write_value(*output_packet, htonl(column_description.object_id));   // object id of type
     PostgresWireHandler::write_value(*output_packet, htons(column_description.type_width));  // regular int
     PostgresWireHandler::write_value(*output_packet, htonl(-1));                             // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                             // text format
+    PostgresWireHandler::write_value(*output_packet,
+                                     htons(static_cast<uint16_t>(column_description.format_code)));  // text or binary
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
+boost::future<void> ClientConnection::send_data_rows(const std::shared_ptr<OutputPacket>& data_rows) {
+  // The DataRow messages are complete already (see QueryResponseBuilder::write_data_rows)
+  return _send_messages_async(data_rows);
+}
 
-  /*
-  DataRow (B)
-  Byte1('D')
-  Identifies the message as a data row.
+boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
+  PostgresWireHandler::write_string(*output_packet, message);
 
-  Int32
-  Length of message contents in bytes, including self.
+  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+}
 
-  Int16
-  The number of column values that follow (possibly zero).
+boost::future<void> ClientConnection::send_copy_in_response(CopyFormat format, size_t column_count) {
+  return _send_copy_response(NetworkMessageType::CopyInResponse, format, column_count);
+}
 
-  Next, the following pair of fields appear for each column:
+boost::future<void> ClientConnection::send_copy_out_response(CopyFormat format, size_t column_count) {
+  return _send_copy_response(NetworkMessageType::CopyOutResponse, format, column_count);
+}
 
-  Int32
-  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
-  -1 indicates a NULL column value. No value bytes follow in the NULL case.
+boost::future<void> ClientConnection::send_copy_data(const std::shared_ptr<OutputPacket>& copy_data) {
+  // The CopyData messages are complete already (see QueryResponseBuilder::write_copy_data)
+  return _send_messages_async(copy_data);
+}
 
-  Byte n
-  The value of the column, in the format indicated by the associated format code. n is the above length.
-  */
+boost::future<void> ClientConnection::_send_copy_response(NetworkMessageType type, CopyFormat format,
+                                                          size_t column_count) {
+  auto output_packet = PostgresWireHandler::new_output_packet(type);
 
-  // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(row_strings.size()));
+  /*
+  Int8
+  0 indicates the overall COPY format is textual (rows separated by newlines, columns separated by separator
+  characters, etc). 1 indicates the overall copy format is binary (similar to DataRow format).
 
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(value_string.length()));
+  Int16
+  The number of columns in the data to be copied.
 
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
+  Int16[N]
+  The format codes to be used for each column. If the overall copy format is textual, all must be zero.
+  */
+  const auto format_code = format == CopyFormat::Binary ? FormatCode::Binary : FormatCode::Text;
+  PostgresWireHandler::write_value(*output_packet, static_cast<char>(format_code));
+  PostgresWireHandler::write_value(*output_packet, htons(column_count));
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(format_code)));
   }
 
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
-  PostgresWireHandler::write_string(*output_packet, message);
-
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+boost::future<void> ClientConnection::_send_messages_async(const std::shared_ptr<OutputPacket>& messages) {
+  // The messages can be large, so they are not copied into the response buffer but written to the socket directly.
+  // Messages that are still in the buffer have to be sent first.
+  auto self = shared_from_this();
+  return _flush_async() >> then >> [self, messages](uint64_t) {
+    const auto buffer = boost::asio::buffer(messages->data);
+    return boost::asio::async_write(self->_socket, buffer, boost::asio::use_boost_future) >> then >>
+           [self, messages](uint64_t sent_bytes) {
+             // If this fails, the connection may be closed but the server will keep running.
+             Assert(sent_bytes == messages->data.size(), "Could not send all data");
+           };
+  };
 }
 
 boost::future<InputPacket> ClientConnection::_receive_bytes_async(size_t size) {
@@ -223,7 +258,9 @@ boost::future<InputPacket> ClientConnection::_receive_bytes_async(size_t size) {
 
   // We need a copy of this client connection to outlive the async operation
   auto self = shared_from_this();
-  return _socket.async_read_some(boost::asio::buffer(result->data, size), boost::asio::use_boost_future) >> then >>
+  // CopyData messages can be larger than what arrives in one read, so we read until the buffer is full
+  const auto buffer = boost::asio::buffer(result->data, size);
+  return boost::asio::async_read(_socket, buffer, boost::asio::use_boost_future) >> then >>
          [self, result, size](uint64_t received_size) {
            // If this assertion should fail, we will end up in either the error handler for the current command or
            // the entire session. The connection may be closed but the server will keep running either way.
@@ -262,6 +299,8 @@ boost::future<uint64_t> ClientConnection::_send_bytes_async(const std::shared_pt
 }
 
 boost::future<uint64_t> ClientConnection::_flush_async() {
+  if (_response_buffer.empty()) return boost::make_ready_future<uint64_t>(0);
+
   return _socket.async_send(boost::asio::buffer(_response_buffer), boost::asio::use_boost_future) >> then >>
          [=](uint64_t sent_bytes) {
            // If this fails, the connection may be closed but the server will keep running.
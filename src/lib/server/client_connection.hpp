@@ -5,6 +5,8 @@
 
 #include <memory>
 
+#include "types.hpp"
+
 namespace opossum {
 
 using ByteBuffer = std::vector<char>;
@@ -13,12 +15,12 @@ struct OutputPacket;
 struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
-enum class NetworkMessageType : unsigned char;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  FormatCode format_code = FormatCode::Text;
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
@@ -39,6 +41,9 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> receive_sync_packet_body(uint32_t size);
   boost::future<void> receive_flush_packet_body(uint32_t size);
   boost::future<std::string> receive_execute_packet_body(uint32_t size);
+  boost::future<ByteBuffer> receive_copy_data_packet_body(uint32_t size);
+  boost::future<void> receive_copy_done_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_fail_packet_body(uint32_t size);
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
@@ -48,10 +53,18 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+  boost::future<void> send_data_rows(const std::shared_ptr<OutputPacket>& data_rows);
   boost::future<void> send_command_complete(const std::string& message);
+  boost::future<void> send_copy_in_response(CopyFormat format, size_t column_count);
+  boost::future<void> send_copy_out_response(CopyFormat format, size_t column_count);
+  boost::future<void> send_copy_data(const std::shared_ptr<OutputPacket>& copy_data);
 
  protected:
+  boost::future<void> _send_copy_response(NetworkMessageType type, CopyFormat format, size_t column_count);
+
+  // Writes complete messages, which may exceed _max_response_size, directly to the socket
+  boost::future<void> _send_messages_async(const std::shared_ptr<OutputPacket>& messages);
+
   boost::future<InputPacket> _receive_bytes_async(size_t size);
 
   boost::future<uint64_t> _send_bytes_async(const std::shared_ptr<OutputPacket>& packet, bool flush = false);
@@ -0,0 +1,374 @@
+#include "copy_decoder.hpp"
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "postgres_wire_handler.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class BaseCopyColumnBuilder {
+ public:
+  virtual ~BaseCopyColumnBuilder() = default;
+
+  virtual void append_text(const std::string& text) = 0;
+  virtual void append_binary(const char* bytes, const size_t length) = 0;
+  virtual void append_null() = 0;
+
+  // Moves the values collected so far into a ValueSegment
+  virtual std::shared_ptr<BaseSegment> build_segment() = 0;
+};
+
+namespace {
+
+constexpr auto BINARY_SIGNATURE_SIZE = sizeof(COPY_BINARY_SIGNATURE);
+
+template <typename T>
+class CopyColumnBuilder : public BaseCopyColumnBuilder {
+ public:
+  CopyColumnBuilder(const std::string& column_name, const bool nullable)
+      : _column_name(column_name), _nullable(nullable) {}
+
+  void append_text(const std::string& text) override {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _values.push_back(text);
+    } else {
+      auto position = size_t{0};
+      auto value = T{};
+      if constexpr (std::is_same_v<T, int32_t>) {
+        value = std::stoi(text, &position);
+      } else if constexpr (std::is_same_v<T, int64_t>) {
+        value = static_cast<int64_t>(std::stoll(text, &position));
+      } else if constexpr (std::is_same_v<T, float>) {
+        value = std::stof(text, &position);
+      } else {
+        value = std::stod(text, &position);
+      }
+      Assert(position == text.size(), "Invalid value '" + text + "' for column " + _column_name);
+
+      _values.push_back(value);
+    }
+
+    if (_nullable) _null_values.push_back(false);
+  }
+
+  void append_binary(const char* bytes, const size_t length) override {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _values.push_back(std::string{bytes, length});
+    } else {
+      Assert(length == sizeof(T), "Binary value for column " + _column_name + " has an unexpected length");
+      _values.push_back(PostgresWireHandler::read_binary_value<T>(bytes));
+    }
+
+    if (_nullable) _null_values.push_back(false);
+  }
+
+  void append_null() override {
+    Assert(_nullable, "Column " + _column_name + " is not nullable");
+
+    _values.push_back(T{});
+    _null_values.push_back(true);
+  }
+
+  std::shared_ptr<BaseSegment> build_segment() override {
+    auto segment = _nullable ? std::make_shared<ValueSegment<T>>(std::move(_values), std::move(_null_values))
+                             : std::make_shared<ValueSegment<T>>(std::move(_values));
+
+    _values = pmr_concurrent_vector<T>{};
+    _null_values = pmr_concurrent_vector<bool>{};
+
+    return segment;
+  }
+
+ private:
+  const std::string _column_name;
+  const bool _nullable;
+
+  pmr_concurrent_vector<T> _values;
+  pmr_concurrent_vector<bool> _null_values;
+};
+
+}  // namespace
+
+CopyDecoder::CopyDecoder(const std::shared_ptr<Table>& table, const CopyFormat format)
+    : _table(table), _format(format) {
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    _column_builders.emplace_back(make_unique_by_data_type<BaseCopyColumnBuilder, CopyColumnBuilder>(
+        table->column_data_type(column_id), table->column_name(column_id), table->column_is_nullable(column_id)));
+  }
+}
+
+CopyDecoder::~CopyDecoder() = default;
+
+void CopyDecoder::add_data(const ByteBuffer& data) { _buffer.append(data.data(), data.size()); }
+
+size_t CopyDecoder::buffered_size() const { return _buffer.size() - _buffer_offset; }
+
+void CopyDecoder::decode() {
+  while (!_end_of_data) {
+    auto row_decoded = false;
+    switch (_format) {
+      case CopyFormat::Text:
+        row_decoded = _decode_text_row();
+        break;
+      case CopyFormat::Csv:
+        row_decoded = _decode_csv_row();
+        break;
+      case CopyFormat::Binary:
+        row_decoded = _decode_binary_row();
+        break;
+    }
+    if (!row_decoded) break;
+  }
+
+  // Drop the decoded data, anything following the end-of-data marker is ignored
+  if (_end_of_data) {
+    _buffer.clear();
+  } else {
+    _buffer.erase(0, _buffer_offset);
+  }
+  _buffer_offset = 0;
+}
+
+void CopyDecoder::finish() {
+  decode();
+
+  // The last row of the text and CSV formats does not need to end with a newline
+  if (!_end_of_data && !_buffer.empty() && _format != CopyFormat::Binary) {
+    _buffer.push_back('\n');
+    decode();
+  }
+
+  Assert(_buffer.empty(), "COPY data ended with an incomplete row");
+
+  if (_rows_in_chunk > 0) _append_chunk();
+}
+
+uint64_t CopyDecoder::row_count() const { return _row_count; }
+
+bool CopyDecoder::_decode_text_row() {
+  const auto row_end = _buffer.find('\n', _buffer_offset);
+  if (row_end == std::string::npos) return false;
+
+  auto row = std::string_view{_buffer}.substr(_buffer_offset, row_end - _buffer_offset);
+  _buffer_offset = row_end + 1;
+
+  if (!row.empty() && row.back() == '\r') row.remove_suffix(1);
+
+  // End-of-data marker of the old protocol versions, still sent by some clients
+  if (row == "\\.") {
+    _end_of_data = true;
+    return true;
+  }
+
+  const auto column_count = _column_builders.size();
+  auto column_id = size_t{0};
+  auto field = std::string{};
+  auto field_begin = size_t{0};
+
+  for (auto position = size_t{0}; position <= row.size(); ++position) {
+    if (position == row.size() || row[position] == '\t') {
+      Assert(column_id < column_count, "COPY data row has more columns than the table");
+
+      if (row.substr(field_begin, position - field_begin) == "\\N") {
+        _column_builders[column_id]->append_null();
+      } else {
+        _column_builders[column_id]->append_text(field);
+      }
+
+      ++column_id;
+      field.clear();
+      field_begin = position + 1;
+      continue;
+    }
+
+    if (row[position] != '\\' || position + 1 == row.size()) {
+      field.push_back(row[position]);
+      continue;
+    }
+
+    // Backslash escapes
+    const auto escaped_character = row[++position];
+    switch (escaped_character) {
+      case 'b':
+        field.push_back('\b');
+        break;
+      case 'f':
+        field.push_back('\f');
+        break;
+      case 'n':
+        field.push_back('\n');
+        break;
+      case 'r':
+        field.push_back('\r');
+        break;
+      case 't':
+        field.push_back('\t');
+        break;
+      case 'v':
+        field.push_back('\v');
+        break;
+      default:
+        field.push_back(escaped_character);
+    }
+  }
+
+  Assert(column_id == column_count, "COPY data row has fewer columns than the table");
+  _finish_row();
+  return true;
+}
+
+bool CopyDecoder::_decode_csv_row() {
+  // Quoted fields may contain newlines, so the row ends at the first newline outside of quotes. Escaped quotes ("")
+  // toggle the state twice.
+  auto in_quotes = false;
+  auto row_end = _buffer_offset;
+  for (; row_end < _buffer.size(); ++row_end) {
+    if (_buffer[row_end] == '"') {
+      in_quotes = !in_quotes;
+    } else if (_buffer[row_end] == '\n' && !in_quotes) {
+      break;
+    }
+  }
+  if (row_end == _buffer.size()) return false;
+
+  auto row = std::string_view{_buffer}.substr(_buffer_offset, row_end - _buffer_offset);
+  _buffer_offset = row_end + 1;
+
+  if (!row.empty() && row.back() == '\r') row.remove_suffix(1);
+
+  const auto column_count = _column_builders.size();
+  auto column_id = size_t{0};
+  auto field = std::string{};
+  auto field_is_quoted = false;
+  in_quotes = false;
+
+  for (auto position = size_t{0}; position <= row.size(); ++position) {
+    if (position == row.size() || (row[position] == ',' && !in_quotes)) {
+      Assert(column_id < column_count, "COPY data row has more columns than the table");
+
+      // Unquoted empty fields are NULL, quoted empty fields are empty strings
+      if (field.empty() && !field_is_quoted) {
+        _column_builders[column_id]->append_null();
+      } else {
+        _column_builders[column_id]->append_text(field);
+      }
+
+      ++column_id;
+      field.clear();
+      field_is_quoted = false;
+      continue;
+    }
+
+    if (row[position] != '"') {
+      field.push_back(row[position]);
+    } else if (in_quotes && position + 1 < row.size() && row[position + 1] == '"') {
+      field.push_back('"');
+      ++position;
+    } else {
+      in_quotes = !in_quotes;
+      field_is_quoted = true;
+    }
+  }
+
+  Assert(column_id == column_count, "COPY data row has fewer columns than the table");
+  _finish_row();
+  return true;
+}
+
+bool CopyDecoder::_decode_binary_row() {
+  const auto* data = _buffer.data();
+  const auto available = _buffer.size() - _buffer_offset;
+
+  if (!_binary_header_decoded) {
+    // Signature, flags, and length of the header extension, which we skip
+    const auto header_size = BINARY_SIGNATURE_SIZE + 2 * sizeof(uint32_t);
+    if (available < header_size) return false;
+
+    Assert(std::memcmp(data + _buffer_offset, COPY_BINARY_SIGNATURE, BINARY_SIGNATURE_SIZE) == 0,
+           "Binary COPY data has an invalid signature");
+    const auto extension_length = PostgresWireHandler::read_binary_value<uint32_t>(
+        data + _buffer_offset + BINARY_SIGNATURE_SIZE + sizeof(uint32_t));
+    if (available < header_size + extension_length) return false;
+
+    _buffer_offset += header_size + extension_length;
+    _binary_header_decoded = true;
+    return true;
+  }
+
+  if (available < sizeof(int16_t)) return false;
+
+  // The trailer is a field count of -1
+  const auto field_count = PostgresWireHandler::read_binary_value<int16_t>(data + _buffer_offset);
+  if (field_count == -1) {
+    _buffer_offset += sizeof(int16_t);
+    _end_of_data = true;
+    return true;
+  }
+
+  Assert(static_cast<size_t>(field_count) == _column_builders.size(),
+         "COPY data row has a different number of columns than the table");
+
+  // Every field is preceded by its length, which is -1 for NULL. First, make sure that the complete row is available.
+  auto position = _buffer_offset + sizeof(int16_t);
+  for (auto field_index = 0; field_index < field_count; ++field_index) {
+    if (_buffer.size() - position < sizeof(int32_t)) return false;
+    const auto length = PostgresWireHandler::read_binary_value<int32_t>(data + position);
+    position += sizeof(int32_t);
+
+    if (length <= 0) continue;
+    if (_buffer.size() - position < static_cast<size_t>(length)) return false;
+    position += length;
+  }
+
+  position = _buffer_offset + sizeof(int16_t);
+  for (auto& column_builder : _column_builders) {
+    const auto length = PostgresWireHandler::read_binary_value<int32_t>(data + position);
+    position += sizeof(int32_t);
+
+    if (length < 0) {
+      column_builder->append_null();
+      continue;
+    }
+
+    column_builder->append_binary(data + position, length);
+    position += length;
+  }
+
+  _buffer_offset = position;
+  _finish_row();
+  return true;
+}
+
+void CopyDecoder::_finish_row() {
+  ++_rows_in_chunk;
+  ++_row_count;
+
+  if (_rows_in_chunk == _table->max_chunk_size()) _append_chunk();
+}
+
+void CopyDecoder::_append_chunk() {
+  Segments segments;
+  for (auto& column_builder : _column_builders) {
+    segments.emplace_back(column_builder->build_segment());
+  }
+
+  {
+    // Insert operators and other COPY commands might append to the table at the same time
+    auto scoped_lock = _table->acquire_append_mutex();
+    _table->append_chunk(segments);
+  }
+
+  _rows_in_chunk = 0;
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+using ByteBuffer = std::vector<char>;
+
+class BaseCopyColumnBuilder;
+
+/**
+ * Decodes the data of a COPY ... FROM STDIN command and appends it to the table. The data arrives in CopyData messages
+ * whose boundaries do not have to match the rows, so the data of incomplete rows is kept until more data arrives.
+ *
+ * The decoded values are collected column by column. Every time the table's maximum chunk size is reached, they are
+ * moved into ValueSegments and appended to the table as a new chunk, so that the rows do not have to go through the
+ * SQL pipeline and the Insert operator. Just like tables loaded from files, the chunks are visible to all transactions
+ * right away and stay in the table if the COPY fails later on.
+ *
+ * Supported are the text format (tab-separated, \N for NULL, backslash escapes), the CSV format (comma-separated,
+ * quoted fields, unquoted empty fields for NULL), and the binary format of PostgreSQL.
+ */
+class CopyDecoder {
+ public:
+  CopyDecoder(const std::shared_ptr<Table>& table, const CopyFormat format);
+  ~CopyDecoder();
+
+  // Only copies the data, so that it can be decoded in larger batches
+  void add_data(const ByteBuffer& data);
+  size_t buffered_size() const;
+
+  // Decodes all complete rows that were added so far and appends full chunks to the table
+  void decode();
+
+  // Decodes the remaining data, which has to consist of complete rows, and appends the last chunk to the table
+  void finish();
+
+  // The number of rows decoded so far
+  uint64_t row_count() const;
+
+ protected:
+  // These return false if the buffer does not contain the complete row yet
+  bool _decode_text_row();
+  bool _decode_csv_row();
+  bool _decode_binary_row();
+
+  void _finish_row();
+  void _append_chunk();
+
+  const std::shared_ptr<Table> _table;
+  const CopyFormat _format;
+  std::vector<std::unique_ptr<BaseCopyColumnBuilder>> _column_builders;
+
+  // The data that has not been decoded yet begins at _buffer_offset
+  std::string _buffer;
+  size_t _buffer_offset{0};
+
+  bool _binary_header_decoded{false};
+  bool _end_of_data{false};
+  uint32_t _rows_in_chunk{0};
+  uint64_t _row_count{0};
+};
+
+}  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <string>
 
 #include "sql/sql_pipeline.hpp"
 #include "types.hpp"
@@ -9,6 +10,55 @@
 
 namespace opossum {
 
+namespace {
+
+std::vector<FormatCode> read_format_codes(const InputPacket& packet) {
+  const auto num_format_codes = ntohs(PostgresWireHandler::read_value<uint16_t>(packet));
+
+  std::vector<FormatCode> format_codes;
+  format_codes.reserve(num_format_codes);
+  for (auto format_code_index = 0; format_code_index < num_format_codes; ++format_code_index) {
+    const auto format_code = ntohs(PostgresWireHandler::read_value<uint16_t>(packet));
+    AssertInput(format_code == static_cast<uint16_t>(FormatCode::Text) ||
+                    format_code == static_cast<uint16_t>(FormatCode::Binary),
+                "Unknown format code " + std::to_string(format_code));
+    format_codes.emplace_back(static_cast<FormatCode>(format_code));
+  }
+  return format_codes;
+}
+
+template <typename T>
+T read_binary_parameter_value(const ByteBuffer& bytes) {
+  Assert(bytes.size() == sizeof(T), "Binary parameter value has an unexpected length.");
+  return PostgresWireHandler::read_binary_value<T>(bytes.data());
+}
+
+AllTypeVariant read_binary_parameter(const ByteBuffer& bytes, const uint32_t parameter_data_type) {
+  switch (static_cast<PostgresDataType>(parameter_data_type)) {
+    case PostgresDataType::Int2:
+      return static_cast<int32_t>(read_binary_parameter_value<int16_t>(bytes));
+    case PostgresDataType::Int4:
+      return read_binary_parameter_value<int32_t>(bytes);
+    case PostgresDataType::Int8:
+      return read_binary_parameter_value<int64_t>(bytes);
+    case PostgresDataType::Float4:
+      return read_binary_parameter_value<float>(bytes);
+    case PostgresDataType::Float8:
+      return read_binary_parameter_value<double>(bytes);
+    case PostgresDataType::Text:
+    case PostgresDataType::Varchar:
+      return std::string{bytes.begin(), bytes.end()};
+    case PostgresDataType::Unspecified:
+      // Without a type, we can only guess that the client sent an integer
+      if (bytes.size() == sizeof(int32_t)) return read_binary_parameter_value<int32_t>(bytes);
+      if (bytes.size() == sizeof(int64_t)) return read_binary_parameter_value<int64_t>(bytes);
+      Fail("Cannot read binary parameter value without a parameter type.");
+  }
+  Fail("Unsupported parameter type for binary parameter value: " + std::to_string(parameter_data_type));
+}
+
+}  // namespace
+
 uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet) {
   auto network_length = read_value<uint32_t>(packet);
   // We ALWAYS need to convert from network endianess to host endianess with these fancy macros
@@ -56,11 +106,14 @@ ParsePacket PostgresWireHandler::handle_parse_packet(const InputPacket& packet)
 
   auto query = read_string(packet);
 
-  auto network_parameter_data_types = read_value<uint16_t>(packet);
+  auto num_parameter_data_types = ntohs(read_value<uint16_t>(packet));
 
-  /*auto parameter_data_types = */ read_values<uint32_t>(packet, network_parameter_data_types);
+  auto parameter_data_types = read_values<uint32_t>(packet, num_parameter_data_types);
+  for (auto& parameter_data_type : parameter_data_types) {
+    parameter_data_type = ntohl(parameter_data_type);
+  }
 
-  return ParsePacket{std::move(statement_name), std::move(query)};
+  return ParsePacket{std::move(statement_name), std::move(query), std::move(parameter_data_types)};
 }
 
 BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
@@ -68,26 +121,66 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
 
   auto statement_name = read_string(packet);
 
-  auto num_format_codes = ntohs(read_value<int16_t>(packet));
+  auto parameter_format_codes = read_format_codes(packet);
 
-  auto format_codes = read_values<int16_t>(packet, num_format_codes);
+  auto num_parameter_values = ntohs(read_value<uint16_t>(packet));
+
+  std::vector<std::optional<ByteBuffer>> parameter_values;
+  parameter_values.reserve(num_parameter_values);
+  for (auto parameter_index = 0; parameter_index < num_parameter_values; ++parameter_index) {
+    // A length of -1 indicates a NULL value, no value bytes follow in that case
+    const auto parameter_value_length = static_cast<int32_t>(ntohl(read_value<uint32_t>(packet)));
+    if (parameter_value_length < 0) {
+      parameter_values.emplace_back(std::nullopt);
+    } else {
+      parameter_values.emplace_back(read_values<char>(packet, parameter_value_length));
+    }
+  }
 
-  auto num_parameter_values = ntohs(read_value<int16_t>(packet));
+  auto result_format_codes = read_format_codes(packet);
 
-  std::vector<AllTypeVariant> parameter_values;
-  for (auto i = 0; i < num_parameter_values; ++i) {
-    auto parameter_value_length = ntohl(read_value<int32_t>(packet));
-    auto x = read_values<char>(packet, parameter_value_length);
-    const std::string x_str(x.begin(), x.end());
-    parameter_values.emplace_back(x_str);
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(parameter_format_codes),
+                    std::move(result_format_codes)};
+}
+
+std::vector<AllTypeVariant> PostgresWireHandler::read_bind_parameters(
+    const BindPacket& packet, const std::vector<uint32_t>& parameter_data_types) {
+  const auto& format_codes = packet.parameter_format_codes;
+  Assert(format_codes.size() <= 1 || format_codes.size() == packet.parameter_values.size(),
+         "Expected one format code for all parameters or one per parameter.");
+
+  std::vector<AllTypeVariant> parameters;
+  parameters.reserve(packet.parameter_values.size());
+
+  for (auto parameter_index = size_t{0}; parameter_index < packet.parameter_values.size(); ++parameter_index) {
+    const auto& value = packet.parameter_values[parameter_index];
+    if (!value) {
+      parameters.emplace_back(NULL_VALUE);
+      continue;
+    }
+
+    auto format_code = FormatCode::Text;
+    if (!format_codes.empty()) format_code = format_codes[format_codes.size() == 1 ? 0 : parameter_index];
+
+    if (format_code == FormatCode::Text) {
+      parameters.emplace_back(std::string{value->begin(), value->end()});
+    } else {
+      const auto parameter_data_type = parameter_index < parameter_data_types.size()
+                                           ? parameter_data_types[parameter_index]
+                                           : static_cast<uint32_t>(PostgresDataType::Unspecified);
+      parameters.emplace_back(read_binary_parameter(*value, parameter_data_type));
+    }
   }
 
-  auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
-  auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+  return parameters;
+}
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+ByteBuffer PostgresWireHandler::handle_copy_data_packet(const InputPacket& packet) {
+  return read_values<char>(packet, packet.data.cend() - packet.offset);
 }
 
+std::string PostgresWireHandler::handle_copy_fail_packet(const InputPacket& packet) { return read_string(packet); }
+
 std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
   const auto portal = read_string(packet);
   /*const auto max_rows = */ read_value<int32_t>(packet);
@@ -2,7 +2,10 @@
 
 #include <arpa/inet.h>
 #include <algorithm>
+#include <cstring>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "SQLParserResult.h"
@@ -37,12 +40,23 @@ struct RequestHeader {
 struct ParsePacket {
   std::string statement_name;
   std::string query;
+
+  // Object IDs of the parameter types (see PostgresDataType). The client may leave types unspecified (i.e., 0).
+  std::vector<uint32_t> parameter_data_types;
 };
 
 struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
-  std::vector<AllTypeVariant> params;
+
+  // The parameter values as sent by the client, std::nullopt stands for NULL. They are converted by
+  // read_bind_parameters() once the types of the parameters are known.
+  std::vector<std::optional<ByteBuffer>> parameter_values;
+
+  // For both, no format code means text for all values and a single format code applies to all values. Otherwise,
+  // there is one format code per value.
+  std::vector<FormatCode> parameter_format_codes;
+  std::vector<FormatCode> result_format_codes;
 };
 
 class PostgresWireHandler {
@@ -60,6 +74,13 @@ class PostgresWireHandler {
   static BindPacket handle_bind_packet(const InputPacket& packet);
   static std::string handle_describe_packet(const InputPacket& packet);
   static std::string handle_execute_packet(const InputPacket& packet);
+  static ByteBuffer handle_copy_data_packet(const InputPacket& packet);
+  static std::string handle_copy_fail_packet(const InputPacket& packet);
+
+  // Converts the parameter values of the Bind message. Values in text format are passed on as strings. Values in binary
+  // format are read according to the parameter types from the Parse message.
+  static std::vector<AllTypeVariant> read_bind_parameters(const BindPacket& packet,
+                                                          const std::vector<uint32_t>& parameter_data_types);
 
   template <typename T>
   static T read_value(const InputPacket& packet);
@@ -69,6 +90,11 @@ class PostgresWireHandler {
 
   static std::string read_string(const InputPacket& packet);
 
+  // Reads a value of the binary format, where numbers are in network byte order and floating-point numbers in their
+  // IEEE 754 representation. Reads sizeof(T) bytes.
+  template <typename T>
+  static T read_binary_value(const char* bytes);
+
   template <typename T>
   static void write_value(OutputPacket& packet, T value);
 
@@ -101,6 +127,21 @@ std::vector<T> PostgresWireHandler::read_values(const InputPacket& packet, const
   return result;
 }
 
+template <typename T>
+T PostgresWireHandler::read_binary_value(const char* bytes) {
+  using Bits = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+  static_assert(sizeof(T) == sizeof(Bits), "Unexpected size of binary value");
+
+  auto bits = Bits{0};
+  for (auto byte_offset = size_t{0}; byte_offset < sizeof(T); ++byte_offset) {
+    bits = static_cast<Bits>(bits << 8) | static_cast<unsigned char>(bytes[byte_offset]);
+  }
+
+  T value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
 template <typename T>
 void PostgresWireHandler::write_value(OutputPacket& packet, T value) {
   auto num_bytes = sizeof(T);
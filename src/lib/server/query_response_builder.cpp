@@ -1,7 +1,18 @@
 #include "query_response_builder.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/create_iterable_from_segment.hpp"
 
 #include "SQLParserResult.h"
 
@@ -11,9 +22,156 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const std::shared_ptr<const Table>& table) {
+namespace {
+
+// The text or binary representations of all values of a segment, stored back to back. NULLs have a length of -1 and no
+// bytes.
+struct SerializedSegment {
+  ByteBuffer bytes;
+  std::vector<int32_t> value_lengths;
+};
+
+void append_text_value(ByteBuffer& bytes, const std::string& value) {
+  bytes.insert(bytes.end(), value.begin(), value.end());
+}
+
+template <typename T>
+std::enable_if_t<std::is_integral_v<T>> append_text_value(ByteBuffer& bytes, const T value) {
+  // The digits are written from the back of the buffer, which fits all digits of a 64 bit number
+  char digits[20];
+  auto begin = std::end(digits);
+
+  auto magnitude = static_cast<std::make_unsigned_t<T>>(value);
+  if (value < 0) magnitude = 0 - magnitude;
+
+  do {
+    *--begin = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+
+  if (value < 0) bytes.push_back('-');
+  bytes.insert(bytes.end(), begin, std::end(digits));
+}
+
+template <typename T>
+std::enable_if_t<std::is_floating_point_v<T>> append_text_value(ByteBuffer& bytes, const T value) {
+  // Uses the same precision as boost::lexical_cast, which was used for the text representation before
+  char buffer[32];
+  const auto length = std::snprintf(buffer, sizeof(buffer), "%.*g", std::numeric_limits<T>::max_digits10,
+                                    static_cast<double>(value));
+  bytes.insert(bytes.end(), buffer, buffer + length);
+}
+
+// The binary format of strings is the same as their text format
+void append_binary_value(ByteBuffer& bytes, const std::string& value) { append_text_value(bytes, value); }
+
+// Numbers are sent in network byte order, floating-point numbers in their IEEE 754 representation. This matches the
+// binary format of the PostgreSQL types in build_row_description().
+template <typename T>
+std::enable_if_t<std::is_arithmetic_v<T>> append_binary_value(ByteBuffer& bytes, const T value) {
+  using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  static_assert(sizeof(T) == sizeof(Bits), "Unexpected size of binary value");
+
+  Bits bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  for (auto shift = static_cast<int>(sizeof(Bits) * 8) - 8; shift >= 0; shift -= 8) {
+    bytes.push_back(static_cast<char>(bits >> shift));
+  }
+}
+
+SerializedSegment serialize_segment(const BaseSegment& segment, const FormatCode format_code) {
+  auto serialized_segment = SerializedSegment{};
+  serialized_segment.value_lengths.reserve(segment.size());
+
+  resolve_data_and_segment_type(segment, [&](auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
+    iterable.for_each([&](const auto& value) {
+      if (value.is_null()) {
+        serialized_segment.value_lengths.emplace_back(-1);
+        return;
+      }
+
+      const auto previous_size = serialized_segment.bytes.size();
+      if (format_code == FormatCode::Binary) {
+        append_binary_value(serialized_segment.bytes, value.value());
+      } else {
+        append_text_value(serialized_segment.bytes, value.value());
+      }
+      serialized_segment.value_lengths.emplace_back(
+          static_cast<int32_t>(serialized_segment.bytes.size() - previous_size));
+    });
+  });
+
+  return serialized_segment;
+}
+
+// Appends a value of a COPY ... TO STDOUT row in the text or CSV format, see QueryResponseBuilder::write_copy_data()
+void append_copy_text_value(ByteBuffer& bytes, const char* value, const int32_t length, const CopyFormat format) {
+  if (format == CopyFormat::Text) {
+    if (length < 0) {
+      bytes.insert(bytes.end(), {'\\', 'N'});
+      return;
+    }
+
+    for (auto index = int32_t{0}; index < length; ++index) {
+      switch (value[index]) {
+        case '\\':
+          bytes.insert(bytes.end(), {'\\', '\\'});
+          break;
+        case '\t':
+          bytes.insert(bytes.end(), {'\\', 't'});
+          break;
+        case '\n':
+          bytes.insert(bytes.end(), {'\\', 'n'});
+          break;
+        case '\r':
+          bytes.insert(bytes.end(), {'\\', 'r'});
+          break;
+        default:
+          bytes.push_back(value[index]);
+      }
+    }
+    return;
+  }
+
+  // Unquoted empty values are NULL, so empty strings have to be quoted
+  if (length < 0) return;
+
+  const auto needs_quotes =
+      length == 0 || std::find_if(value, value + length, [](const char character) {
+                       return character == ',' || character == '"' || character == '\n' || character == '\r';
+                     }) != value + length;
+  if (!needs_quotes) {
+    bytes.insert(bytes.end(), value, value + length);
+    return;
+  }
+
+  bytes.push_back('"');
+  for (auto index = int32_t{0}; index < length; ++index) {
+    if (value[index] == '"') bytes.push_back('"');
+    bytes.push_back(value[index]);
+  }
+  bytes.push_back('"');
+}
+
+// Appends a CopyData message with the given bytes to the packet
+void write_copy_data_message(OutputPacket& packet, const ByteBuffer& bytes) {
+  PostgresWireHandler::write_value(packet, NetworkMessageType::CopyData);
+  PostgresWireHandler::write_value(packet, htonl(static_cast<uint32_t>(sizeof(uint32_t) + bytes.size())));
+  packet.data.insert(packet.data.end(), bytes.begin(), bytes.end());
+}
+
+}  // namespace
+
+std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(
+    const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& result_format_codes) {
   std::vector<ColumnDescription> result;
 
+  const auto format_codes = _column_format_codes(result_format_codes, table->column_count());
+
   const auto& column_names = table->column_names();
   const auto& column_types = table->column_data_types();
 
@@ -23,30 +181,30 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
 
     switch (column_types[column_id]) {
       case DataType::Int:
-        object_id = 23;
+        object_id = static_cast<uint32_t>(PostgresDataType::Int4);
         type_id = 4;
         break;
       case DataType::Long:
-        object_id = 20;
+        object_id = static_cast<uint32_t>(PostgresDataType::Int8);
         type_id = 8;
         break;
       case DataType::Float:
-        object_id = 700;
+        object_id = static_cast<uint32_t>(PostgresDataType::Float4);
         type_id = 4;
         break;
       case DataType::Double:
-        object_id = 701;
+        object_id = static_cast<uint32_t>(PostgresDataType::Float8);
         type_id = 8;
         break;
       case DataType::String:
-        object_id = 25;
+        object_id = static_cast<uint32_t>(PostgresDataType::Text);
         type_id = -1;
         break;
       default:
         Fail("Bad DataType");
     }
 
-    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id});
+    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id, format_codes[column_id]});
   }
 
   return result;
@@ -82,38 +240,197 @@ std::string QueryResponseBuilder::build_execution_info_message(const std::shared
   return sql_pipeline->metrics().to_string();
 }
 
-boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table) {
-  // Essentially we're iterating over every row in every chunk in the table, generating and sending
-  // its string representation. However, because of the asynchronous send_row call, we have to
-  // use this two-level recursion instead of two nested for-loops
+boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_data_rows_t& send_data_rows,
+                                                                  const Table& table,
+                                                                  const std::vector<FormatCode>& result_format_codes) {
+  // Instead of sending every row on its own, whole chunks are serialized into batches of DataRow messages. Because of
+  // the asynchronous send_data_rows call, we have to use recursion to send one batch after another.
+
+  const auto format_codes = _column_format_codes(result_format_codes, table.column_count());
+  const auto write_chunk = [format_codes](OutputPacket& packet, const Chunk& chunk) {
+    write_data_rows(packet, chunk, format_codes);
+  };
 
-  return _send_query_response_chunks(send_row, table, ChunkID{0}) >> then >> [&]() { return table.row_count(); };
+  return _send_query_response_chunks(send_data_rows, table, write_chunk, ChunkID{0}) >> then >>
+         [&]() { return table.row_count(); };
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                                      ChunkID current_chunk_id) {
-  if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
+boost::future<uint64_t> QueryResponseBuilder::send_copy_response(const send_data_rows_t& send_copy_data,
+                                                                 const Table& table, const CopyFormat format) {
+  const auto write_chunk = [format](OutputPacket& packet, const Chunk& chunk) {
+    write_copy_data(packet, chunk, format);
+  };
+
+  if (format != CopyFormat::Binary) {
+    return _send_query_response_chunks(send_copy_data, table, write_chunk, ChunkID{0}) >> then >>
+           [&]() { return table.row_count(); };
+  }
 
-  const auto& chunk = table.get_chunk(current_chunk_id);
+  // The binary format starts with a header (signature, flags, and the length of the header extension) and ends with a
+  // field count of -1
+  auto header = ByteBuffer(std::begin(COPY_BINARY_SIGNATURE), std::end(COPY_BINARY_SIGNATURE));
+  header.resize(header.size() + 2 * sizeof(uint32_t), 0);
+  auto header_packet = std::make_shared<OutputPacket>();
+  write_copy_data_message(*header_packet, header);
 
-  return _send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
-         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table),
-                   ChunkID{current_chunk_id + 1});
+  return send_copy_data(header_packet) >> then >>
+         [=, &table]() { return _send_query_response_chunks(send_copy_data, table, write_chunk, ChunkID{0}); } >>
+         then >> [=]() {
+           auto trailer_packet = std::make_shared<OutputPacket>();
+           write_copy_data_message(*trailer_packet, ByteBuffer{'\xff', '\xff'});
+           return send_copy_data(trailer_packet);
+         } >>
+         then >> [&]() { return table.row_count(); };
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                                    ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
+void QueryResponseBuilder::write_data_rows(OutputPacket& packet, const Chunk& chunk,
+                                           const std::vector<FormatCode>& result_format_codes) {
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
+  const auto format_codes = _column_format_codes(result_format_codes, column_count);
 
-  std::vector<std::string> row_strings(chunk.column_count());
+  std::vector<SerializedSegment> serialized_segments;
+  serialized_segments.reserve(column_count);
 
-  for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
-    const auto& segment = chunk.get_segment(column_id);
-    row_strings[column_id] = type_cast<std::string>((*segment)[current_chunk_offset]);
+  auto values_size = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    serialized_segments.emplace_back(serialize_segment(*chunk.get_segment(column_id), format_codes[column_id]));
+    values_size += serialized_segments.back().bytes.size();
   }
 
-  return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::_send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+  /*
+  DataRow (B)
+  Byte1('D')
+  Identifies the message as a data row.
+
+  Int32
+  Length of message contents in bytes, including self.
+
+  Int16
+  The number of column values that follow (possibly zero).
+
+  Next, the following pair of fields appear for each column:
+
+  Int32
+  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
+  -1 indicates a NULL column value. No value bytes follow in the NULL case.
+
+  Byte n
+  The value of the column, in the format indicated by the associated format code. n is the above length.
+  */
+
+  auto& data = packet.data;
+  const auto row_header_size = sizeof(NetworkMessageType) + sizeof(uint32_t) + sizeof(uint16_t);
+  data.reserve(data.size() + row_count * (row_header_size + column_count * sizeof(uint32_t)) + values_size);
+
+  std::vector<size_t> value_offsets(column_count, 0);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    const auto message_begin = data.size();
+
+    PostgresWireHandler::write_value(packet, NetworkMessageType::DataRow);
+
+    // Dummy message length, it is set once the row is written
+    PostgresWireHandler::write_value(packet, htonl(0u));
+
+    // Number of columns in row
+    PostgresWireHandler::write_value(packet, htons(column_count));
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& serialized_segment = serialized_segments[column_id];
+      const auto value_length = serialized_segment.value_lengths[chunk_offset];
+
+      // Size of the text or binary representation of the value
+      PostgresWireHandler::write_value(packet, htonl(static_cast<uint32_t>(value_length)));
+      if (value_length <= 0) continue;
+
+      // Strings are sent without terminating null byte in both formats
+      const auto value_begin = serialized_segment.bytes.begin() + value_offsets[column_id];
+      data.insert(data.end(), value_begin, value_begin + value_length);
+      value_offsets[column_id] += value_length;
+    }
+
+    // The message type byte does not contribute to the message length
+    const auto message_length = htonl(static_cast<uint32_t>(data.size() - message_begin - 1));
+    std::memcpy(&data[message_begin + 1], &message_length, sizeof(message_length));
+  }
+}
+
+void QueryResponseBuilder::write_copy_data(OutputPacket& packet, const Chunk& chunk, const CopyFormat format) {
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
+  const auto format_code = format == CopyFormat::Binary ? FormatCode::Binary : FormatCode::Text;
+
+  std::vector<SerializedSegment> serialized_segments;
+  serialized_segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    serialized_segments.emplace_back(serialize_segment(*chunk.get_segment(column_id), format_code));
+  }
+
+  std::vector<size_t> value_offsets(column_count, 0);
+  auto row = ByteBuffer{};
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    row.clear();
+
+    // In the binary format, every row starts with the number of fields and every field with its length
+    if (format == CopyFormat::Binary) {
+      const auto field_count = htons(static_cast<uint16_t>(column_count));
+      row.insert(row.end(), reinterpret_cast<const char*>(&field_count),
+                 reinterpret_cast<const char*>(&field_count) + sizeof(field_count));
+    }
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& serialized_segment = serialized_segments[column_id];
+      const auto value_length = serialized_segment.value_lengths[chunk_offset];
+      const auto* value = serialized_segment.bytes.data() + value_offsets[column_id];
+      if (value_length > 0) value_offsets[column_id] += value_length;
+
+      if (format == CopyFormat::Binary) {
+        const auto length = htonl(static_cast<uint32_t>(value_length));
+        row.insert(row.end(), reinterpret_cast<const char*>(&length),
+                   reinterpret_cast<const char*>(&length) + sizeof(length));
+        if (value_length > 0) row.insert(row.end(), value, value + value_length);
+        continue;
+      }
+
+      if (column_id > 0) row.push_back(format == CopyFormat::Csv ? ',' : '\t');
+      append_copy_text_value(row, value, value_length, format);
+    }
+
+    if (format != CopyFormat::Binary) row.push_back('\n');
+
+    write_copy_data_message(packet, row);
+  }
+}
+
+std::vector<FormatCode> QueryResponseBuilder::_column_format_codes(const std::vector<FormatCode>& result_format_codes,
+                                                                  const size_t column_count) {
+  // No format code means text for all columns, a single format code applies to all columns
+  if (result_format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (result_format_codes.size() == 1) return std::vector<FormatCode>(column_count, result_format_codes.front());
+
+  Assert(result_format_codes.size() == column_count, "Expected one result format code per column.");
+  return result_format_codes;
+}
+
+boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_data_rows_t& send_data_rows,
+                                                                      const Table& table,
+                                                                      const write_chunk_t& write_chunk,
+                                                                      ChunkID first_chunk_id) {
+  auto data_rows = std::make_shared<OutputPacket>();
+
+  auto chunk_id = first_chunk_id;
+  while (chunk_id < table.chunk_count() && data_rows->data.size() < DATA_ROWS_BATCH_SIZE) {
+    write_chunk(*data_rows, *table.get_chunk(chunk_id));
+    ++chunk_id;
+  }
+
+  if (data_rows->data.empty()) return boost::make_ready_future();
+
+  return send_data_rows(data_rows) >> then >>
+         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_data_rows, std::ref(table), write_chunk,
+                   chunk_id);
 }
 
 }  // namespace opossum
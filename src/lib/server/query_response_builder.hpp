@@ -11,19 +11,49 @@ class SQLPipeline;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // For result_format_codes, no format code means text for all columns and a single format code applies to all
+  // columns. Otherwise, there has to be one format code per column.
+  static std::vector<ColumnDescription> build_row_description(
+      const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& result_format_codes = {});
   static std::string build_command_complete_message(hsql::StatementType statement_type, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
-  using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
+  using send_data_rows_t = std::function<boost::future<void>(const std::shared_ptr<OutputPacket>&)>;
 
-  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
+  // Serializes the table into batches of DataRow messages and passes each batch to send_data_rows. Returns the number
+  // of rows sent.
+  static boost::future<uint64_t> send_query_response(const send_data_rows_t& send_data_rows, const Table& table,
+                                                     const std::vector<FormatCode>& result_format_codes = {});
+
+  // Appends one complete DataRow message (including its length) per row of the chunk to the packet. The values are
+  // sent in text or binary format. The segments are serialized column by column using their iterables, so that no
+  // AllTypeVariant has to be created per value.
+  static void write_data_rows(OutputPacket& packet, const Chunk& chunk,
+                              const std::vector<FormatCode>& result_format_codes = {});
+
+  // Serializes the table into batches of CopyData messages for COPY ... TO STDOUT, one message per row, and passes
+  // each batch to send_copy_data. In the binary format, the header and the trailer are sent as separate messages.
+  // Returns the number of rows sent.
+  static boost::future<uint64_t> send_copy_response(const send_data_rows_t& send_copy_data, const Table& table,
+                                                    const CopyFormat format);
+
+  // Appends one CopyData message per row of the chunk to the packet. In the text format, values are separated by tabs
+  // and NULLs are written as \N. In the CSV format, values are separated by commas and quoted if necessary, NULLs are
+  // empty. The binary format uses the same binary representation of the values as the DataRow messages.
+  static void write_copy_data(OutputPacket& packet, const Chunk& chunk, const CopyFormat format);
+
+  // Chunks are added to a batch until it has at least this many bytes. Only then, the batch is sent to the client.
+  static constexpr size_t DATA_ROWS_BATCH_SIZE = 262'144;
 
  protected:
-  static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                         ChunkID current_chunk_id);
-  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
+  static std::vector<FormatCode> _column_format_codes(const std::vector<FormatCode>& result_format_codes,
+                                                      const size_t column_count);
+
+  using write_chunk_t = std::function<void(OutputPacket&, const Chunk&)>;
+
+  // Writes the chunks using write_chunk and sends them in batches of at least DATA_ROWS_BATCH_SIZE bytes
+  static boost::future<void> _send_query_response_chunks(const send_data_rows_t& send_data_rows, const Table& table,
+                                                         const write_chunk_t& write_chunk, ChunkID first_chunk_id);
 };
 
 }  // namespace opossum
@@ -3,10 +3,14 @@
 #include <boost/asio/placeholders.hpp>
 #include <boost/bind.hpp>
 
+#include <thread>
+#include <vector>
+
 #include "client_connection.hpp"
 #include "server_session.hpp"
 #include "task_runner.hpp"
 #include "then_operator.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -26,6 +30,7 @@ void Server::_accept_next_connection() {
 void Server::_start_session(boost::system::error_code error) {
   if (!error) {
     auto connection = std::make_shared<ClientConnection>(std::move(_socket));
+    // Every session gets its own TaskRunner and thereby its own strand
     auto task_runner = std::make_shared<TaskRunner>(_io_service);
     auto session = std::make_shared<ServerSession>(connection, task_runner);
     // Start the session and release it once it has terminated
@@ -37,4 +42,20 @@ void Server::_start_session(boost::system::error_code error) {
 
 uint16_t Server::get_port_number() { return _acceptor.local_endpoint().port(); }
 
+void Server::run(size_t io_thread_count) {
+  Assert(io_thread_count > 0, "The server needs at least one io thread");
+
+  std::vector<std::thread> io_threads;
+  io_threads.reserve(io_thread_count - 1);
+  for (auto thread_index = size_t{1}; thread_index < io_thread_count; ++thread_index) {
+    io_threads.emplace_back([&]() { _io_service.run(); });
+  }
+
+  _io_service.run();
+
+  for (auto& io_thread : io_threads) {
+    io_thread.join();
+  }
+}
+
 }  // namespace opossum
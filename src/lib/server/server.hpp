@@ -13,6 +13,11 @@ class Server {
 
   uint16_t get_port_number();
 
+  // Runs the io_service on io_thread_count threads (including the calling one) and blocks until it is stopped or has
+  // no more work. Sessions are spread over all threads, so that the protocol handling and the serialization of results
+  // of many concurrent clients are not limited to a single core.
+  void run(size_t io_thread_count);
+
  protected:
   void _accept_next_connection();
   void _start_session(boost::system::error_code error);
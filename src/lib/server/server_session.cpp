@@ -12,15 +12,18 @@
 #include "SQLParserResult.h"
 
 #include "concurrency/transaction_manager.hpp"
+#include "storage/storage_manager.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
+#include "tasks/server/decode_copy_data_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
 
 #include "client_connection.hpp"
+#include "copy_decoder.hpp"
 #include "query_response_builder.hpp"
 #include "then_operator.hpp"
 #include "types.hpp"
@@ -104,6 +107,20 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
                [=](std::string portal) { return _handle_execute_command(portal); };
       }
 
+      // After a failed COPY FROM STDIN, the client may still send its data. It is discarded.
+      case NetworkMessageType::CopyData: {
+        return _connection->receive_copy_data_packet_body(request.payload_length) >> then >> [](ByteBuffer data) {};
+      }
+
+      case NetworkMessageType::CopyDone: {
+        return _connection->receive_copy_done_packet_body(request.payload_length);
+      }
+
+      case NetworkMessageType::CopyFail: {
+        return _connection->receive_copy_fail_packet_body(request.payload_length) >> then >>
+               [](std::string message) {};
+      }
+
       default:
         Fail("Unsupported message type.");
     }
@@ -154,7 +171,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 
     return _connection->send_row_description(row_description) >> then >> [=]() {
       return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+          [=](const std::shared_ptr<OutputPacket>& data_rows) { return _connection->send_data_rows(data_rows); },
+          *result_table);
     };
   };
 
@@ -194,6 +212,12 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
     if (result->load_table.has_value()) {
       return load_table_file(result->load_table->first, result->load_table->second);
+    } else if (result->copy.has_value() && result->copy->from_stdin) {
+      return _handle_copy_from_stdin(result->copy->table_name, result->copy->format);
+    } else if (result->copy.has_value()) {
+      const auto format = result->copy->format;
+      return execute_sql_pipeline(result->sql_pipeline) >> then >>
+             [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_copy_to_stdout(sql_pipeline, format); };
     } else {
       return execute_sql_pipeline(result->sql_pipeline) >> then >>
              [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_simple_query_response(sql_pipeline); };
@@ -201,9 +225,87 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_copy_from_stdin(const std::string& table_name,
+                                                                                        CopyFormat format) {
+  // Like LOAD, COPY appends to the table outside of any transaction
+  auto table = StorageManager::get().get_table(table_name);
+  auto decoder = std::make_shared<CopyDecoder>(table, format);
+
+  return _connection->send_copy_in_response(format, table->column_count()) >> then >>
+         [=]() { return _receive_copy_data(decoder); } >> then >>
+         [=](uint64_t row_count) { return _connection->send_command_complete("COPY " + std::to_string(row_count)); };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<uint64_t> ServerSessionImpl<TConnection, TTaskRunner>::_receive_copy_data(
+    const std::shared_ptr<CopyDecoder>& decoder) {
+  // The client sends CopyData messages until it is done (CopyDone) or aborts the COPY (CopyFail). Because of the
+  // asynchronous receive calls, we have to use recursion to receive one message after another.
+  return _connection->receive_packet_header() >> then >> [=](RequestHeader request) {
+    switch (request.message_type) {
+      case NetworkMessageType::CopyData: {
+        return _connection->receive_copy_data_packet_body(request.payload_length) >> then >> [=](ByteBuffer data) {
+          decoder->add_data(data);
+
+          // The data is decoded in larger batches by the scheduler, so that the session does not block
+          auto decoded = decoder->buffered_size() < COPY_DECODE_BATCH_SIZE
+                             ? boost::make_ready_future<uint64_t>(decoder->row_count())
+                             : _task_runner->dispatch_server_task(std::make_shared<DecodeCopyDataTask>(decoder, false));
+          return std::move(decoded) >> then >> [=](uint64_t row_count) { return _receive_copy_data(decoder); };
+        };
+      }
+
+      case NetworkMessageType::CopyDone: {
+        return _connection->receive_copy_done_packet_body(request.payload_length) >> then >> [=]() {
+          return _task_runner->dispatch_server_task(std::make_shared<DecodeCopyDataTask>(decoder, true));
+        };
+      }
+
+      case NetworkMessageType::CopyFail: {
+        return _connection->receive_copy_fail_packet_body(request.payload_length) >> then >>
+               [](std::string message) -> uint64_t { Fail("COPY failed: " + message); };
+      }
+
+      // Flush and Sync may be sent by clients during COPY FROM STDIN and are ignored
+      case NetworkMessageType::FlushCommand: {
+        return _connection->receive_flush_packet_body(request.payload_length) >> then >>
+               [=]() { return _receive_copy_data(decoder); };
+      }
+
+      case NetworkMessageType::SyncCommand: {
+        return _connection->receive_sync_packet_body(request.payload_length) >> then >>
+               [=]() { return _receive_copy_data(decoder); };
+      }
+
+      default:
+        Fail("Unexpected message type during COPY FROM STDIN.");
+    }
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_copy_to_stdout(
+    const std::shared_ptr<SQLPipeline>& sql_pipeline, CopyFormat format) {
+  auto result_table = sql_pipeline->get_result_table();
+  Assert(result_table, "COPY TO STDOUT requires a query with a result");
+
+  return _connection->send_copy_out_response(format, result_table->column_count()) >> then >>
+         [=]() {
+           return QueryResponseBuilder::send_copy_response(
+               [=](const std::shared_ptr<OutputPacket>& copy_data) { return _connection->send_copy_data(copy_data); },
+               *result_table, format);
+         } >>
+         then >> [=](uint64_t row_count) {
+           return _connection->send_status_message(NetworkMessageType::CopyDone) >> then >>
+                  [=]() { return _connection->send_command_complete("COPY " + std::to_string(row_count)); };
+         };
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_command(const ParsePacket& parse_info) {
   auto prepared_statement_name = parse_info.statement_name;
+  auto parameter_data_types = parse_info.parameter_data_types;
 
   // Named prepared statements must be explicitly closed before they can be redefined by another Parse message
   // https://www.postgresql.org/docs/10/static/protocol-flow.html
@@ -218,7 +320,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
   return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(parse_info.query)) >> then >>
          [=](std::unique_ptr<CreatePipelineResult> result) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
-           _prepared_statements.insert(std::make_pair(prepared_statement_name, result->sql_pipeline));
+           _prepared_statements.insert(
+               std::make_pair(prepared_statement_name, PreparedStatement{result->sql_pipeline, parameter_data_types}));
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::ParseComplete); };
 }
@@ -228,7 +331,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
   auto statement_it = _prepared_statements.find(packet.statement_name);
   if (statement_it == _prepared_statements.end()) Fail("The specified statement does not exist.");
 
-  auto sql_pipeline = statement_it->second;
+  auto sql_pipeline = statement_it->second.sql_pipeline;
+  auto params = PostgresWireHandler::read_bind_parameters(packet, statement_it->second.parameter_data_types);
   if (packet.statement_name.empty()) _prepared_statements.erase(statement_it);
 
   auto portal_name = packet.destination_portal;
@@ -244,11 +348,13 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
 
   auto statement_type = sql_pipeline->get_parsed_sql_statements().front()->getStatements().front()->type();
 
-  auto task = std::make_shared<BindServerPreparedStatementTask>(sql_pipeline, packet.params);
+  auto result_format_codes = packet.result_format_codes;
+
+  auto task = std::make_shared<BindServerPreparedStatementTask>(sql_pipeline, params);
   return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<SQLQueryPlan> query_plan) {
            std::shared_ptr<SQLQueryPlan> shared_query_plan = std::move(query_plan);
-           auto portal = std::make_pair(statement_type, shared_query_plan);
+           auto portal = Portal{statement_type, shared_query_plan, result_format_codes};
            _portals.insert(std::make_pair(portal_name, portal));
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
@@ -283,8 +389,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
   auto portal_it = _portals.find(portal_name);
   if (portal_it == _portals.end()) throw std::logic_error("The specified portal does not exist.");
 
-  auto statement_type = portal_it->second.first;
-  auto query_plan = portal_it->second.second;
+  auto statement_type = portal_it->second.statement_type;
+  auto query_plan = portal_it->second.query_plan;
+  auto result_format_codes = portal_it->second.result_format_codes;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
@@ -299,10 +406,12 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
              return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >>
                     []() { return uint64_t(0); };
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
+           const auto row_description =
+               QueryResponseBuilder::build_row_description(result_table, result_format_codes);
            return _connection->send_row_description(row_description) >> then >> [=]() {
              return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+                 [=](const std::shared_ptr<OutputPacket>& data_rows) { return _connection->send_data_rows(data_rows); },
+                 *result_table, result_format_codes);
            };
          } >>
          then >> [=](uint64_t row_count) {
@@ -14,6 +14,8 @@
 
 namespace opossum {
 
+class CopyDecoder;
+
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
@@ -36,13 +38,35 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
 
   boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
+  boost::future<void> _handle_copy_from_stdin(const std::string& table_name, CopyFormat format);
+  boost::future<uint64_t> _receive_copy_data(const std::shared_ptr<CopyDecoder>& decoder);
+  boost::future<void> _send_copy_to_stdout(const std::shared_ptr<SQLPipeline>& sql_pipeline, CopyFormat format);
+
+  // CopyData messages are collected until this many bytes can be decoded at once
+  static constexpr size_t COPY_DECODE_BATCH_SIZE = 1'048'576;
+
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
-  std::shared_ptr<TransactionContext> _transaction;
-  std::unordered_map<std::string, std::shared_ptr<SQLPipeline>> _prepared_statements;
+  struct PreparedStatement {
+    std::shared_ptr<SQLPipeline> sql_pipeline;
+
+    // As specified in the Parse message, used to read binary parameter values
+    std::vector<uint32_t> parameter_data_types;
+  };
+
   // TODO(lawben): The type of _portals will change when prepared statements are supported in the SQLPipeline
-  std::unordered_map<std::string, std::pair<hsql::StatementType, std::shared_ptr<SQLQueryPlan>>> _portals;
+  struct Portal {
+    hsql::StatementType statement_type;
+    std::shared_ptr<SQLQueryPlan> query_plan;
+
+    // As specified in the Bind message, determines whether the results are sent in text or binary format
+    std::vector<FormatCode> result_format_codes;
+  };
+
+  std::shared_ptr<TransactionContext> _transaction;
+  std::unordered_map<std::string, PreparedStatement> _prepared_statements;
+  std::unordered_map<std::string, Portal> _portals;
 };
 
 // The corresponding template instantiation takes place in the .cpp
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/asio/io_service.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/thread/future.hpp>
 
 #include <memory>
@@ -14,15 +15,20 @@ namespace opossum {
 
 // This class encapsulates the io_service and thus allows the ServerSession
 // to be easily tested with a mocked version of this class.
+//
+// The io_service may be run by multiple threads (see Server::run). Every session has its own TaskRunner, whose strand
+// makes sure that the results of the session's tasks are handled one after another. As a session only ever waits for a
+// single socket operation or task at a time, this pins the processing of a session to one io thread at any moment,
+// while different sessions are processed in parallel.
 class TaskRunner {
  public:
-  explicit TaskRunner(boost::asio::io_service& io_service) : _io_service(io_service) {}
+  explicit TaskRunner(boost::asio::io_service& io_service) : _strand(io_service) {}
 
   template <typename TResult>
   auto dispatch_server_task(std::shared_ptr<TResult> task) -> decltype(task->get_future());
 
  protected:
-  boost::asio::io_service& _io_service;
+  boost::asio::io_service::strand _strand;
 };
 
 template <typename TResult>
@@ -35,9 +41,9 @@ auto TaskRunner::dispatch_server_task(std::shared_ptr<TResult> task) -> decltype
   return task->get_future()
       .then(boost::launch::sync,
             [=](auto result) {
-              // This result comes in on the scheduler thread, so we want to dispatch it back to the io_service
-              return _io_service.post(boost::asio::use_boost_future)
-                     // Make sure to be on the main thread before re-throwing the exceptions
+              // This result comes in on the scheduler thread, so we want to dispatch it back to the session's strand
+              return _strand.post(boost::asio::use_boost_future)
+                     // Make sure to be on an io thread before re-throwing the exceptions
                      >> then >> [result = std::move(result)]() mutable { return result.get(); };
             })
       .unwrap();
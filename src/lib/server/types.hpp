@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
 enum class NetworkMessageType : unsigned char {
@@ -20,6 +22,8 @@ enum class NetworkMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
 
   // Errors
   HumanReadableError = 'M',
@@ -36,6 +40,11 @@ enum class NetworkMessageType : unsigned char {
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
 
+  // COPY sub-protocol, used in both directions
+  CopyData = 'd',
+  CopyDone = 'c',
+  CopyFail = 'f',
+
   // SSL willingness
   SslYes = 'S',
   SslNo = 'N',
@@ -48,4 +57,27 @@ enum class TransactionStatusIndicator : unsigned char {
   InFailedTransactionBlock = 'e'
 };
 
+// Formats of the data of COPY FROM STDIN and COPY TO STDOUT
+enum class CopyFormat { Text, Csv, Binary };
+
+// Signature at the beginning of the binary COPY format, including the terminating \0. It is followed by 32 bit flags
+// and the 32 bit length of a header extension.
+constexpr char COPY_BINARY_SIGNATURE[] = "PGCOPY\n\377\r\n";
+
+// Format of parameter values and result columns in the extended query protocol
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
+// Object IDs of the PostgreSQL data types that are used by the server
+// Found at: https://github.com/postgres/postgres/blob/master/src/include/catalog/pg_type.h
+enum class PostgresDataType : uint32_t {
+  Unspecified = 0,
+  Int8 = 20,
+  Int2 = 21,
+  Int4 = 23,
+  Text = 25,
+  Float4 = 700,
+  Float8 = 701,
+  Varchar = 1043
+};
+
 }  // namespace opossum
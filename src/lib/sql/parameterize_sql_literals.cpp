@@ -0,0 +1,253 @@
+#include "parameterize_sql_literals.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <cctype>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+namespace {
+
+enum class TokenType { Word, QuotedIdentifier, Number, String, Symbol };
+
+struct Token {
+  TokenType type;
+
+  // Position of the token in the SQL string, [begin, end)
+  size_t begin;
+  size_t end;
+
+  // Upper case for words, the content without quotes for strings, and the raw text otherwise
+  std::string text;
+};
+
+// The clause that the tokens at the current parenthesis level belong to
+enum class Clause { Select, Where, Having, Other };
+
+struct Scope {
+  Clause clause;
+  bool is_in_list;
+  bool expects_between_and;
+};
+
+bool is_word(const Token& token, const char* word) { return token.type == TokenType::Word && token.text == word; }
+
+bool is_symbol(const Token& token, const char* symbol) {
+  return token.type == TokenType::Symbol && token.text == symbol;
+}
+
+bool is_comparison(const Token& token) {
+  if (token.type != TokenType::Symbol) return false;
+  return token.text == "=" || token.text == "==" || token.text == "<>" || token.text == "!=" || token.text == "<" ||
+         token.text == "<=" || token.text == ">" || token.text == ">=";
+}
+
+bool is_word_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+// Splits the SQL string into tokens, skipping whitespace and comments. Returns std::nullopt for SQL that we do not
+// want to touch, i.e., unterminated strings or comments and SQL that already contains placeholders.
+std::optional<std::vector<Token>> tokenize(const std::string& sql) {
+  auto tokens = std::vector<Token>{};
+  auto position = size_t{0};
+
+  while (position < sql.size()) {
+    const auto character = sql[position];
+    const auto next_character = position + 1 < sql.size() ? sql[position + 1] : '\0';
+    const auto begin = position;
+
+    // Strings received by the server are terminated with a \0-byte
+    if (std::isspace(static_cast<unsigned char>(character)) || character == '\0') {
+      ++position;
+    } else if (character == '-' && next_character == '-') {
+      position = sql.find('\n', position);
+      if (position == std::string::npos) position = sql.size();
+    } else if (character == '/' && next_character == '*') {
+      position = sql.find("*/", position + 2);
+      if (position == std::string::npos) return std::nullopt;
+      position += 2;
+    } else if (character == '\'' || character == '"') {
+      position = sql.find(character, position + 1);
+      if (position == std::string::npos) return std::nullopt;
+      ++position;
+      tokens.push_back({character == '\'' ? TokenType::String : TokenType::QuotedIdentifier, begin, position,
+                        sql.substr(begin + 1, position - begin - 2)});
+    } else if (std::isdigit(static_cast<unsigned char>(character)) ||
+               (character == '.' && std::isdigit(static_cast<unsigned char>(next_character)))) {
+      while (position < sql.size() &&
+             (std::isdigit(static_cast<unsigned char>(sql[position])) || sql[position] == '.')) {
+        ++position;
+      }
+      if (position < sql.size() && (sql[position] == 'e' || sql[position] == 'E')) {
+        ++position;
+        if (position < sql.size() && (sql[position] == '+' || sql[position] == '-')) ++position;
+        while (position < sql.size() && std::isdigit(static_cast<unsigned char>(sql[position]))) ++position;
+      }
+      tokens.push_back({TokenType::Number, begin, position, sql.substr(begin, position - begin)});
+    } else if (is_word_character(character)) {
+      while (position < sql.size() && is_word_character(sql[position])) ++position;
+      tokens.push_back({TokenType::Word, begin, position, boost::to_upper_copy(sql.substr(begin, position - begin))});
+    } else if (character == '?') {
+      return std::nullopt;
+    } else {
+      const auto two_characters = sql.substr(position, 2);
+      const auto symbol_length = two_characters == "<=" || two_characters == ">=" || two_characters == "<>" ||
+                                         two_characters == "!=" || two_characters == "==" || two_characters == "||"
+                                     ? 2
+                                     : 1;
+      position += symbol_length;
+      tokens.push_back({TokenType::Symbol, begin, position, sql.substr(begin, symbol_length)});
+    }
+  }
+
+  return tokens;
+}
+
+// Converts the literal the same way the SQLTranslator does: integers become int32_t if they fit and int64_t otherwise,
+// all other numbers become double.
+std::optional<AllTypeVariant> literal_value(const Token& literal, const bool negative) {
+  if (literal.type == TokenType::String) return AllTypeVariant{literal.text};
+
+  const auto text = negative ? "-" + literal.text : literal.text;
+  const auto is_integer = text.find_first_of(".eE") == std::string::npos;
+
+  try {
+    auto parsed_length = size_t{0};
+    if (!is_integer) {
+      const auto value = std::stod(text, &parsed_length);
+      if (parsed_length != text.size()) return std::nullopt;
+      return AllTypeVariant{value};
+    }
+
+    const auto value = static_cast<int64_t>(std::stoll(text, &parsed_length));
+    if (parsed_length != text.size()) return std::nullopt;
+    if (static_cast<int32_t>(value) == value) return AllTypeVariant{static_cast<int32_t>(value)};
+    return AllTypeVariant{value};
+  } catch (const std::out_of_range&) {
+    return std::nullopt;
+  }
+}
+
+}  // namespace
+
+std::optional<ParameterizedSQL> parameterize_sql_literals(const std::string& sql) {
+  const auto tokens = tokenize(sql);
+  if (!tokens || tokens->empty() || !is_word(tokens->front(), "SELECT")) return std::nullopt;
+
+  const auto token_count = tokens->size();
+
+  // Only single statements are parameterized
+  for (auto token_index = size_t{0}; token_index + 1 < token_count; ++token_index) {
+    if (is_symbol((*tokens)[token_index], ";")) return std::nullopt;
+  }
+
+  auto parameterized_sql = ParameterizedSQL{};
+  auto copied_until = size_t{0};
+
+  // Every parenthesis opens a new scope that starts in the clause of the enclosing scope (e.g., an expression in the
+  // WHERE clause), which might be changed by a subquery
+  auto scopes = std::vector<Scope>{{Clause::Other, false, false}};
+
+  // Index of the last AND that belongs to a BETWEEN
+  auto between_and_index = std::optional<size_t>{};
+
+  for (auto token_index = size_t{0}; token_index < token_count; ++token_index) {
+    const auto& token = (*tokens)[token_index];
+    auto& scope = scopes.back();
+
+    if (token.type == TokenType::Word) {
+      if (token.text == "SELECT") {
+        scope.clause = Clause::Select;
+      } else if (token.text == "WHERE") {
+        scope.clause = Clause::Where;
+      } else if (token.text == "HAVING") {
+        scope.clause = Clause::Having;
+      } else if (token.text == "FROM" || token.text == "JOIN" || token.text == "ON" || token.text == "GROUP" ||
+                 token.text == "ORDER" || token.text == "LIMIT" || token.text == "OFFSET" || token.text == "UNION" ||
+                 token.text == "INTERSECT" || token.text == "EXCEPT") {
+        scope.clause = Clause::Other;
+      } else if (token.text == "BETWEEN") {
+        scope.expects_between_and = true;
+      } else if (token.text == "AND" && scope.expects_between_and) {
+        scope.expects_between_and = false;
+        between_and_index = token_index;
+      }
+      continue;
+    }
+
+    if (is_symbol(token, "(")) {
+      const auto is_in_list = token_index > 0 && is_word((*tokens)[token_index - 1], "IN");
+      scopes.push_back({scope.clause, is_in_list, false});
+      continue;
+    }
+
+    if (is_symbol(token, ")")) {
+      if (scopes.size() == 1) return std::nullopt;
+      scopes.pop_back();
+      continue;
+    }
+
+    // A literal, optionally with a minus sign
+    const auto negative = is_symbol(token, "-") && token_index + 1 < token_count &&
+                          (*tokens)[token_index + 1].type == TokenType::Number;
+    const auto literal_index = negative ? token_index + 1 : token_index;
+    const auto& literal = (*tokens)[literal_index];
+    if (literal.type != TokenType::Number && literal.type != TokenType::String) continue;
+
+    // Only literals that are used as values in predicates are extracted. Parameters in the SELECT list would change
+    // the data types and names of the result columns, so we stay away from literals in anything nested in it.
+    if (scope.clause != Clause::Where && scope.clause != Clause::Having) continue;
+    auto nested_in_select_list = false;
+    for (auto scope_index = size_t{0}; scope_index + 1 < scopes.size(); ++scope_index) {
+      if (scopes[scope_index].clause == Clause::Select) nested_in_select_list = true;
+    }
+    if (nested_in_select_list) continue;
+
+    // The literal has to be a complete operand, i.e., it must not be part of a larger expression such as a + 1
+    const auto* previous = token_index > 0 ? &(*tokens)[token_index - 1] : nullptr;
+    const auto* next = literal_index + 1 < token_count ? &(*tokens)[literal_index + 1] : nullptr;
+    if (!previous) continue;
+
+    const auto next_ends_operand = !next || next->type == TokenType::Word || is_symbol(*next, ")") ||
+                                   is_symbol(*next, ",") || is_symbol(*next, ";");
+
+    auto extractable = false;
+    if (is_comparison(*previous) || between_and_index == token_index - 1) {
+      extractable = next_ends_operand;
+    } else if (is_word(*previous, "BETWEEN")) {
+      extractable = next && is_word(*next, "AND");
+    } else if (scope.is_in_list && (is_symbol(*previous, "(") || is_symbol(*previous, ","))) {
+      extractable = next && (is_symbol(*next, ",") || is_symbol(*next, ")"));
+    }
+    if (!extractable) continue;
+
+    const auto value = literal_value(literal, negative);
+    if (!value) return std::nullopt;
+    if (parameterized_sql.values.size() > std::numeric_limits<ValuePlaceholderID::base_type>::max()) {
+      return std::nullopt;
+    }
+
+    parameterized_sql.sql += sql.substr(copied_until, token.begin - copied_until);
+    parameterized_sql.sql += '?';
+    parameterized_sql.values.emplace_back(*value);
+    copied_until = literal.end;
+
+    token_index = literal_index;
+  }
+
+  if (parameterized_sql.values.empty()) return std::nullopt;
+
+  parameterized_sql.sql += sql.substr(copied_until);
+  return parameterized_sql;
+}
+
+}  // namespace opossum
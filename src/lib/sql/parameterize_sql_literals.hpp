@@ -0,0 +1,35 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+struct ParameterizedSQL {
+  // The SQL string with the extracted literals replaced by value placeholders (?)
+  std::string sql;
+
+  // The values of the extracted literals, in the order of the value placeholders
+  std::vector<AllTypeVariant> values;
+};
+
+/**
+ * Extracts the literals of a single SELECT statement so that statements that only differ in these literals share the
+ * same normalized SQL string and thus the same cached query plan. E.g., both
+ *     SELECT * FROM t WHERE a = 5 AND b IN ('x', 'y')
+ *     SELECT * FROM t WHERE a = 7 AND b IN ('z', 'x')
+ * are normalized to
+ *     SELECT * FROM t WHERE a = ? AND b IN (?, ?)
+ *
+ * To make sure that the placeholders stand in for plain values only, only literals that are operands of a comparison,
+ * an IN list, or a BETWEEN in a WHERE or HAVING clause are extracted. Literals in the SELECT list, LIMIT, or any other
+ * place where the plan depends on the actual value are kept.
+ *
+ * Returns std::nullopt if the statement is not a SELECT, already contains placeholders, or has no extractable literals.
+ */
+std::optional<ParameterizedSQL> parameterize_sql_literals(const std::string& sql);
+
+}  // namespace opossum
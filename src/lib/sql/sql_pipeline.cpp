@@ -16,7 +16,8 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
                          const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                         const CleanupTemporaries cleanup_temporaries)
+                         const CleanupTemporaries cleanup_temporaries, const AutoParameterize auto_parameterize,
+                         const std::shared_ptr<SQLResultCache>& result_cache)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
@@ -76,7 +77,7 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
         statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
-        prepared_statements, cleanup_temporaries);
+        prepared_statements, cleanup_temporaries, auto_parameterize, result_cache);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -197,7 +198,33 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   _result_tables.reserve(_sql_pipeline_statements.size());
 
-  for (auto& pipeline_statement : _sql_pipeline_statements) {
+  const auto is_read_only = [](const auto& pipeline_statement) {
+    return pipeline_statement->get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect);
+  };
+
+  // Index of the first statement after the run of read-only statements whose tasks have been scheduled
+  auto scheduled_until = size_t{0};
+
+  for (auto statement_index = size_t{0}; statement_index < _sql_pipeline_statements.size(); ++statement_index) {
+    auto& pipeline_statement = _sql_pipeline_statements[statement_index];
+
+    if (statement_index >= scheduled_until && is_read_only(pipeline_statement)) {
+      scheduled_until = statement_index + 1;
+      while (scheduled_until < _sql_pipeline_statements.size() &&
+             is_read_only(_sql_pipeline_statements[scheduled_until])) {
+        ++scheduled_until;
+      }
+
+      // Schedule the tasks of all read-only statements before waiting for the first one. The statements are compiled
+      // one after another, as the LQPTranslator is shared. Preceding statements have been executed already, so that
+      // the statements see their structural changes.
+      if (scheduled_until - statement_index > 1) {
+        for (auto run_index = statement_index; run_index < scheduled_until; ++run_index) {
+          _sql_pipeline_statements[run_index]->schedule_tasks();
+        }
+      }
+    }
+
     pipeline_statement->get_result_table();
     if (_transaction_context && _transaction_context->aborted()) {
       _failed_pipeline_statement = pipeline_statement;
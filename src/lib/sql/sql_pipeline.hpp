@@ -37,6 +37,11 @@ struct SQLPipelineMetrics {
  * The advantage of using this over a self created vector of SQLPipelineStatements is that some sanity checks are
  * performed here, e.g. TransactionContexts and dependent statements (CREATE VIEW X followed by SELECT * FROM X)
  *
+ * Consecutive SELECT statements neither modify data nor the structure of the database, so they cannot depend on each
+ * other. When executing the pipeline, the tasks of such a run of statements are compiled one after another, but
+ * scheduled together, so that a NodeQueueScheduler executes them concurrently. The results are still returned in the
+ * order of the statements.
+ *
  * The SQLPipeline holds all results and only hands them out as const references. If the SQLPipeline goes out of scope
  * while the results are still needed, the result references are invalid (except maybe the result table).
  */
@@ -46,7 +51,8 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const AutoParameterize auto_parameterize,
+              const std::shared_ptr<SQLResultCache>& result_cache);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -70,7 +76,7 @@ class SQLPipeline : public Noncopyable {
   // get_result_tables().back()
   std::shared_ptr<const Table> get_result_table();
 
-  // Executes all tasks, waits for them to finish, and returns the resulting tables
+  // Executes all tasks, waits for them to finish, and returns the resulting tables in the order of the statements
   const std::vector<std::shared_ptr<const Table>>& get_result_tables();
 
   // Returns the TransactionContext that was passed to the SQLPipelineStatement, or nullptr if none was passed in.
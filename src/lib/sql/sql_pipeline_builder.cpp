@@ -26,6 +26,11 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_prepared_statement_cache(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache) {
+  _result_cache = result_cache;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
     const std::shared_ptr<TransactionContext>& transaction_context) {
   _transaction_context = transaction_context;
@@ -41,12 +46,17 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::enable_auto_parameterization() {
+  _auto_parameterize = AutoParameterize::Yes;
+  return *this;
+}
+
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
   auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements,
-                              _cleanup_temporaries);
+                              _cleanup_temporaries, _auto_parameterize, _result_cache);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_strings().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -58,7 +68,7 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
   return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
-          optimizer, _prepared_statements,  _cleanup_temporaries};
+          optimizer, _prepared_statements,  _cleanup_temporaries, _auto_parameterize, _result_cache};
 }
 
 }  // namespace opossum
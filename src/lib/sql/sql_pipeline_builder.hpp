@@ -28,6 +28,8 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
  *  - No JIT operators
+ *  - No auto-parameterization of literals
+ *  - No result cache
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -41,6 +43,7 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_lqp_translator(const std::shared_ptr<LQPTranslator>& lqp_translator);
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_prepared_statement_cache(const std::shared_ptr<PreparedStatementCache>& prepared_statements);
+  SQLPipelineBuilder& with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
   /**
@@ -53,6 +56,12 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /*
+   * Replace the literals of SELECT statements with parameters so that statements which only differ in their literals
+   * share a cached query plan (see parameterize_sql_literals() and SQLPipelineStatement::get_query_plan())
+   */
+  SQLPipelineBuilder& enable_auto_parameterization();
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -69,7 +78,9 @@ class SQLPipelineBuilder final {
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
+  std::shared_ptr<SQLResultCache> _result_cache;
   CleanupTemporaries _cleanup_temporaries{true};
+  AutoParameterize _auto_parameterize{false};
 };
 
 }  // namespace opossum
@@ -25,7 +25,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const AutoParameterize auto_parameterize,
+                                           const std::shared_ptr<SQLResultCache>& result_cache)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -35,6 +37,7 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
       _prepared_statements(prepared_statements),
+      _result_cache(result_cache),
       _cleanup_temporaries(cleanup_temporaries) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
@@ -43,6 +46,10 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
               "Transaction context without MVCC enabled makes no sense");
+
+  if (auto_parameterize == AutoParameterize::Yes) {
+    _parameterized_sql = parameterize_sql_literals(_sql_string);
+  }
 }
 
 const std::string& SQLPipelineStatement::get_sql_string() { return _sql_string; }
@@ -79,25 +86,45 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_unoptimized_lo
 
   const auto* statement = parsed_sql->getStatement(0);
 
-  SQLTranslator sql_translator{_use_mvcc};
-
   std::vector<std::shared_ptr<AbstractLQPNode>> lqp_roots;
 
-  if (const auto prepared_statement = dynamic_cast<const hsql::PrepareStatement*>(statement)) {
-    // If this is as PreparedStatement, we want to translate the actual query and not the PREPARE FROM ... part.
-    // However, that part is not yet parsed, so we need to parse the raw string from the PreparedStatement.
-    Assert(_prepared_statements, "Cannot prepare statement without prepared statement cache.");
+  if (_parameterized_sql) {
+    // Translate the normalized SQL string, the values of its parameters are bound in get_query_plan(). If the
+    // placeholders ended up in a place where the translator cannot handle them, we fall back to the original statement.
+    try {
+      hsql::SQLParserResult parser_result;
+      hsql::SQLParser::parseSQLString(_parameterized_sql->sql, &parser_result);
+      Assert(parser_result.isValid() && parser_result.size() == 1, "Auto-parameterized statement is invalid");
+
+      SQLTranslator sql_translator{_use_mvcc};
+      lqp_roots = sql_translator.translate_parser_result(parser_result);
+      _parameter_ids = sql_translator.value_placeholders();
+      Assert(_parameter_ids.size() == _parameterized_sql->values.size(), "Unexpected number of value placeholders");
+    } catch (const std::exception&) {
+      _parameterized_sql.reset();
+      lqp_roots.clear();
+    }
+  }
 
-    hsql::SQLParserResult parser_result;
-    hsql::SQLParser::parseSQLString(prepared_statement->query, &parser_result);
-    AssertInput(parser_result.isValid(), create_sql_parser_error_message(prepared_statement->query, parser_result));
+  if (!_parameterized_sql) {
+    SQLTranslator sql_translator{_use_mvcc};
 
-    lqp_roots = sql_translator.translate_parser_result(parser_result);
-  } else {
-    lqp_roots = sql_translator.translate_parser_result(*parsed_sql);
-  }
+    if (const auto prepared_statement = dynamic_cast<const hsql::PrepareStatement*>(statement)) {
+      // If this is as PreparedStatement, we want to translate the actual query and not the PREPARE FROM ... part.
+      // However, that part is not yet parsed, so we need to parse the raw string from the PreparedStatement.
+      Assert(_prepared_statements, "Cannot prepare statement without prepared statement cache.");
+
+      hsql::SQLParserResult parser_result;
+      hsql::SQLParser::parseSQLString(prepared_statement->query, &parser_result);
+      AssertInput(parser_result.isValid(), create_sql_parser_error_message(prepared_statement->query, parser_result));
 
-  _parameter_ids = sql_translator.value_placeholders();
+      lqp_roots = sql_translator.translate_parser_result(parser_result);
+    } else {
+      lqp_roots = sql_translator.translate_parser_result(*parsed_sql);
+    }
+
+    _parameter_ids = sql_translator.value_placeholders();
+  }
 
   DebugAssert(lqp_roots.size() == 1, "LQP translation returned no or more than one LQP root for a single statement.");
   _unoptimized_logical_plan = lqp_roots.front();
@@ -156,7 +183,18 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     }
   };
 
-  if (const auto cached_plan = SQLQueryCache<SQLQueryPlan>::get().try_get(_sql_string)) {
+  // Auto-parameterized statements share the plan cached for their normalized SQL string
+  const auto lookup_key = _parameterized_sql ? _parameterized_sql->sql : _sql_string;
+  auto cached_plan = SQLQueryCache<SQLQueryPlan>::get().try_get(lookup_key);
+
+  // If the normalized statement could not be translated before, the plan was cached for the original SQL string. It
+  // has the literals built in, so no values are bound to it.
+  if (!cached_plan && _parameterized_sql) {
+    cached_plan = SQLQueryCache<SQLQueryPlan>::get().try_get(_sql_string);
+    if (cached_plan) _parameterized_sql.reset();
+  }
+
+  if (cached_plan) {
     // Handle query plan if statement has been cached
     auto& plan = *cached_plan;
 
@@ -164,6 +202,7 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     assert_same_mvcc_mode(plan);
 
     _query_plan->append_plan(plan.deep_copy());
+    _parameter_ids = plan.parameter_ids();
     _metrics->query_plan_cache_hit = true;
     done = std::chrono::high_resolution_clock::now();
   } else if (const auto* execute_statement = dynamic_cast<const hsql::ExecuteStatement*>(statement)) {
@@ -222,9 +261,29 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     _prepared_statements->set(prepared_statement->name, *_query_plan);
   }
 
-  // Cache newly created plan for the according sql statement (only if not already cached)
+  // Cache newly created plan for the according sql statement (only if not already cached). If the translation fell
+  // back to the original statement, the plan has its literals built in and must not be shared via the normalized SQL.
   if (!_metrics->query_plan_cache_hit) {
-    SQLQueryCache<SQLQueryPlan>::get().set(_sql_string, *_query_plan);
+    const auto cache_key = _parameterized_sql ? _parameterized_sql->sql : _sql_string;
+    SQLQueryCache<SQLQueryPlan>::get().set(cache_key, *_query_plan);
+  }
+
+  if (_parameterized_sql) {
+    // The cached plan has to stay unbound, so a newly created plan is replaced with a copy before binding the values
+    if (!_metrics->query_plan_cache_hit) {
+      _query_plan = std::make_shared<SQLQueryPlan>(_query_plan->deep_copy());
+      if (_use_mvcc == UseMvcc::Yes) _query_plan->set_transaction_context(_transaction_context);
+    }
+
+    Assert(_parameter_ids.size() == _parameterized_sql->values.size(),
+           "Cached plan does not match the auto-parameterized statement");
+
+    std::unordered_map<ParameterID, AllTypeVariant> parameters;
+    for (auto value_placeholder_id = ValuePlaceholderID{0}; value_placeholder_id < _parameterized_sql->values.size();
+         ++value_placeholder_id) {
+      parameters.emplace(_parameter_ids.at(value_placeholder_id), _parameterized_sql->values[value_placeholder_id]);
+    }
+    _query_plan->tree_roots().front()->set_parameters(parameters);
   }
 
   _metrics->compile_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
@@ -246,11 +305,52 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
   return _tasks;
 }
 
+void SQLPipelineStatement::schedule_tasks() {
+  if (_result_table || !_query_has_output || _uses_result_cache()) return;
+
+  const auto& tasks = get_tasks();
+  if (tasks.front()->is_scheduled()) return;
+
+  // A PREPARE x FROM ... command only creates the plan, but does not execute it
+  if (get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtPrepare)) return;
+
+  CurrentScheduler::schedule_tasks(tasks);
+}
+
 const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   if (_result_table || !_query_has_output) {
     return _result_table;
   }
 
+  const auto use_result_cache = _uses_result_cache();
+  auto result_cache_table_states = std::vector<SQLResultCacheTableState>{};
+  auto result_cache_parameter_values = std::vector<AllTypeVariant>{};
+
+  if (use_result_cache) {
+    if (!_transaction_context) _transaction_context = TransactionManager::get().new_transaction_context();
+
+    const auto started = std::chrono::high_resolution_clock::now();
+
+    // The values are taken after translating, which might fall back from the auto-parameterized statement
+    const auto& lqp = get_optimized_logical_plan();
+    if (_parameterized_sql) result_cache_parameter_values = _parameterized_sql->values;
+
+    const auto cached_result =
+        _result_cache->try_get(lqp, result_cache_parameter_values, _transaction_context->snapshot_commit_id());
+    if (cached_result) {
+      _transaction_context->commit();
+      _result_table = cached_result;
+      _metrics->result_cache_hit = true;
+
+      const auto done = std::chrono::high_resolution_clock::now();
+      _metrics->execution_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
+      return _result_table;
+    }
+
+    // Captured before the execution, so that modifications committed in the meantime invalidate the cached result
+    result_cache_table_states = SQLResultCache::capture_table_states(get_optimized_logical_plan());
+  }
+
   const auto& tasks = get_tasks();
 
   const auto started = std::chrono::high_resolution_clock::now();
@@ -266,7 +366,8 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  if (!tasks.front()->is_scheduled()) CurrentScheduler::schedule_tasks(tasks);
+  CurrentScheduler::wait_for_tasks(tasks);
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -279,6 +380,11 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
 
+  if (use_result_cache && _result_table) {
+    _result_cache->set(get_optimized_logical_plan(), result_cache_parameter_values, result_cache_table_states,
+                       _transaction_context->snapshot_commit_id(), _result_table);
+  }
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->translate_time_micros.count(),
                 _metrics->optimize_time_micros.count(), _metrics->compile_time_micros.count(),
                 _metrics->execution_time_micros.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -286,6 +392,14 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   return _result_table;
 }
 
+bool SQLPipelineStatement::_uses_result_cache() {
+  // Statements in a user's transaction might see their own uncommitted modifications, so only auto-committed
+  // statements use the result cache
+  return _result_cache && _use_mvcc == UseMvcc::Yes && _auto_commit &&
+         get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect) &&
+         SQLResultCache::is_cacheable(get_optimized_logical_plan());
+}
+
 const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_context() const {
   return _transaction_context;
 }
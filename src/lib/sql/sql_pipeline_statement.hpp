@@ -1,13 +1,16 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
+#include "sql/parameterize_sql_literals.hpp"
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -22,6 +25,7 @@ struct SQLPipelineStatementMetrics {
   std::chrono::microseconds execution_time_micros{};
 
   bool query_plan_cache_hit = false;
+  bool result_cache_hit = false;
 };
 
 /**
@@ -38,6 +42,14 @@ struct SQLPipelineStatementMetrics {
  *
  * E.g: calling sql_pipeline_statement.get_result_table() will result in the following "call stack"
  * get_result_table -> get_tasks -> get_query_plan -> get_optimized_logical_plan -> get_parsed_sql
+ *
+ * With AutoParameterize::Yes, the literals of SELECT statements are replaced with parameters (see
+ * parameterize_sql_literals()). The plan is translated and optimized for the normalized SQL string and cached under it,
+ * so that statements only differing in their literals get a deep copy of the cached plan with their own values bound,
+ * just like an EXECUTE of a prepared statement.
+ *
+ * If a SQLResultCache is passed, auto-committed SELECT statements look up their result by the optimized LQP (which is
+ * created even if the query plan is cached) and are only executed if there is no valid cached result.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -47,7 +59,8 @@ class SQLPipelineStatement : public Noncopyable {
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                       const CleanupTemporaries cleanup_temporaries);
+                       const CleanupTemporaries cleanup_temporaries, const AutoParameterize auto_parameterize,
+                       const std::shared_ptr<SQLResultCache>& result_cache);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -67,7 +80,13 @@ class SQLPipelineStatement : public Noncopyable {
   // Returns all task sets that need to be executed for this query.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
-  // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Schedules all tasks without waiting for them, so that the SQLPipeline can execute the tasks of independent
+  // statements concurrently. get_result_table() then only waits for them. Statements that use the result cache are not
+  // scheduled ahead, as they might not need to be executed at all.
+  void schedule_tasks();
+
+  // Executes all tasks (unless they were scheduled by schedule_tasks()), waits for them to finish, and returns the
+  // resulting table.
   const std::shared_ptr<const Table>& get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
@@ -77,6 +96,8 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
  private:
+  bool _uses_result_cache();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -106,6 +127,11 @@ class SQLPipelineStatement : public Noncopyable {
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
   std::unordered_map<ValuePlaceholderID, ParameterID> _parameter_ids;
 
+  // Set if the statement was auto-parameterized, i.e., the plans are created for the normalized SQL string
+  std::optional<ParameterizedSQL> _parameterized_sql;
+
+  std::shared_ptr<SQLResultCache> _result_cache;
+
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
 };
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -16,68 +19,198 @@ namespace opossum {
 
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
+// The cache is split into at most this many shards...
+inline constexpr size_t MaxCacheShardCount = 16;
+// ...but every shard holds at least this many entries, so that small caches keep the exact eviction order of their
+// strategy
+inline constexpr size_t MinCacheShardCapacity = 64;
+
+// Counters of an SQLQueryCache, collected since its creation or the last call of clear()
+struct SQLQueryCacheMetrics {
+  uint64_t hits{0};
+  uint64_t misses{0};
+  uint64_t evictions{0};
+
+  // Number of accesses that had to wait for the lock of their shard
+  uint64_t contentions{0};
+};
+
 // Cache that stores instances of SQLParserResult.
 // Per-default, uses the GDFS cache as underlying storage.
+//
+// The underlying caches are not thread-safe, so the keys are hash-partitioned into shards that each have their own
+// cache (with its own eviction strategy and a share of the capacity) and their own mutex. This way, concurrent
+// queries only contend if their keys fall into the same shard.
 template <typename Value, typename Key = std::string>
 class SQLQueryCache : public Singleton<SQLQueryCache<Value, Key>> {
  public:
-  explicit SQLQueryCache(size_t capacity = DefaultCacheCapacity)
-      : _cache(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+  explicit SQLQueryCache(size_t capacity = DefaultCacheCapacity) {
+    replace_cache_impl<GDFSCache<Key, Value>>(capacity);
+  }
 
   virtual ~SQLQueryCache() {}
 
   // Adds or refreshes the cache entry [query, value].
   void set(const Key& query, const Value& value) {
-    if (_cache->capacity() == 0) return;
+    if (_capacity == 0) return;
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    _cache->set(query, value);
+    auto& shard = _shard(query);
+    const auto lock = _lock(shard);
+
+    // All strategies evict exactly one entry when a new entry is added to a full cache
+    if (!shard.cache->has(query) && shard.cache->size() >= shard.cache->capacity()) {
+      _evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+    shard.cache->set(query, value);
   }
 
   // Tries to fetch the cache entry for the query into the result object.
   // Returns true if the entry was found, false otherwise.
   std::optional<Value> try_get(const Key& query) {
-    if (_cache->capacity() == 0) return {};
+    if (_capacity == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_cache->has(query)) {
+    auto& shard = _shard(query);
+    const auto lock = _lock(shard);
+    if (!shard.cache->has(query)) {
+      _misses.fetch_add(1, std::memory_order_relaxed);
       return {};
     }
-    return _cache->get(query);
+    _hits.fetch_add(1, std::memory_order_relaxed);
+    return shard.cache->get(query);
   }
 
   // Checks whether an entry for the query exists.
-  bool has(const Key& query) const { return _cache->has(query); }
+  bool has(const Key& query) const {
+    const auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache->has(query);
+  }
 
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _cache->get(query);
+    auto& shard = _shard(query);
+    const auto lock = _lock(shard);
+    return shard.cache->get(query);
+  }
+
+  // Purges all entries from the cache and resets the metrics.
+  void clear() {
+    for (auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->cache->clear();
+    }
+
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+    _contentions = 0;
+  }
+
+  // Distributes the new capacity among the existing shards. If the capacity calls for a different number of shards,
+  // the shards are replaced like in replace_cache_impl(), which drops all entries. In that case, this must not be
+  // called while the cache is in use.
+  void resize(size_t capacity) {
+    if (_shard_count(capacity) != _shards.size()) {
+      _evictions.fetch_add(size(), std::memory_order_relaxed);
+      _create_shards(capacity);
+      return;
+    }
+
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      auto& shard = *_shards[shard_id];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+
+      const auto size_before = shard.cache->size();
+      shard.cache->resize(_shard_capacity(capacity, _shards.size(), shard_id));
+      _evictions.fetch_add(size_before - shard.cache->size(), std::memory_order_relaxed);
+    }
+    _capacity = capacity;
   }
 
-  // Purges all entries from the cache.
-  void clear() { _cache->clear(); }
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      size += shard->cache->size();
+    }
+    return size;
+  }
 
-  void resize(size_t capacity) { _cache->resize(capacity); }
+  size_t capacity() const { return _capacity; }
 
-  size_t size() const { return _cache->size(); }
+  size_t shard_count() const { return _shards.size(); }
 
-  // Returns a reference to the underlying cache.
-  AbstractCache<Key, Value>& cache() { return *_cache; }
+  SQLQueryCacheMetrics metrics() const {
+    auto metrics = SQLQueryCacheMetrics{};
+    metrics.hits = _hits.load(std::memory_order_relaxed);
+    metrics.misses = _misses.load(std::memory_order_relaxed);
+    metrics.evictions = _evictions.load(std::memory_order_relaxed);
+    metrics.contentions = _contentions.load(std::memory_order_relaxed);
+    return metrics;
+  }
 
-  // Replaces the underlying cache by creating a new object
-  // of the given cache type.
+  // Replaces the underlying caches by creating new objects of the given cache type. The number of shards is derived
+  // from the capacity. This must not be called while the cache is in use.
   template <class cache_t>
   void replace_cache_impl(size_t capacity) {
-    _cache = std::make_unique<cache_t>(capacity);
+    _create_cache = [](const size_t shard_capacity) -> std::unique_ptr<AbstractCache<Key, Value>> {
+      return std::make_unique<cache_t>(shard_capacity);
+    };
+    _create_shards(capacity);
   }
 
  protected:
-  // Underlying cache strategy.
-  std::unique_ptr<AbstractCache<Key, Value>> _cache;
+  struct Shard {
+    mutable std::mutex mutex;
+
+    // Underlying cache strategy.
+    std::unique_ptr<AbstractCache<Key, Value>> cache;
+  };
+
+  Shard& _shard(const Key& query) { return *_shards[std::hash<Key>{}(query) % _shards.size()]; }
+  const Shard& _shard(const Key& query) const { return *_shards[std::hash<Key>{}(query) % _shards.size()]; }
+
+  // Every shard holds at least MinCacheShardCapacity entries, unless there is only one shard
+  static size_t _shard_count(const size_t capacity) {
+    return std::clamp(capacity / MinCacheShardCapacity, size_t{1}, MaxCacheShardCount);
+  }
+
+  void _create_shards(const size_t capacity) {
+    const auto shard_count = _shard_count(capacity);
+
+    _shards.clear();
+    for (auto shard_id = size_t{0}; shard_id < shard_count; ++shard_id) {
+      _shards.emplace_back(std::make_unique<Shard>());
+      _shards.back()->cache = _create_cache(_shard_capacity(capacity, shard_count, shard_id));
+    }
+    _capacity = capacity;
+  }
+
+  // The shards' capacities differ by at most one and sum up to the total capacity
+  static size_t _shard_capacity(const size_t capacity, const size_t shard_count, const size_t shard_id) {
+    return capacity / shard_count + (shard_id < capacity % shard_count ? 1 : 0);
+  }
+
+  std::unique_lock<std::mutex> _lock(Shard& shard) {
+    auto lock = std::unique_lock<std::mutex>{shard.mutex, std::try_to_lock};
+    if (!lock.owns_lock()) {
+      _contentions.fetch_add(1, std::memory_order_relaxed);
+      lock.lock();
+    }
+    return lock;
+  }
+
+  // Creates the cache of a shard with the given capacity, set by replace_cache_impl()
+  std::function<std::unique_ptr<AbstractCache<Key, Value>>(size_t)> _create_cache;
+
+  std::vector<std::unique_ptr<Shard>> _shards;
+  std::atomic<size_t> _capacity{0};
 
-  std::mutex _mutex;
+  std::atomic<uint64_t> _hits{0};
+  std::atomic<uint64_t> _misses{0};
+  std::atomic<uint64_t> _evictions{0};
+  std::atomic<uint64_t> _contentions{0};
 };
 
 }  // namespace opossum
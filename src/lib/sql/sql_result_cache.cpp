@@ -0,0 +1,151 @@
+#include "sql_result_cache.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_select_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Calls the visitor for every node of the LQP and of the LQPs of its subqueries
+void visit_lqp_and_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp,
+                              const std::function<void(const std::shared_ptr<AbstractLQPNode>&)>& visitor) {
+  visit_lqp(lqp, [&](const auto& node) {
+    visitor(node);
+
+    for (auto& expression : node->node_expressions()) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::LQPSelect) {
+          visit_lqp_and_subqueries(std::static_pointer_cast<LQPSelectExpression>(sub_expression)->lqp, visitor);
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+// Only used to find the cache entry, which then is compared with the LQP
+size_t lqp_hash(const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<AllTypeVariant>& parameter_values) {
+  auto hash = size_t{0};
+  visit_lqp(lqp, [&](const auto& node) {
+    boost::hash_combine(hash, static_cast<size_t>(node->type));
+    boost::hash_combine(hash, node->description());
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& value : parameter_values) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+}  // namespace
+
+SQLResultCache::SQLResultCache(size_t capacity) : _cache(capacity) {}
+
+bool SQLResultCache::is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto cacheable = true;
+  visit_lqp_and_subqueries(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::CreateView:
+      case LQPNodeType::Delete:
+      case LQPNodeType::DropView:
+      case LQPNodeType::Insert:
+      case LQPNodeType::Mock:
+      case LQPNodeType::ShowColumns:
+      case LQPNodeType::ShowTables:
+      case LQPNodeType::Update:
+        cacheable = false;
+        break;
+      default:
+        break;
+    }
+  });
+  if (!cacheable) return false;
+
+  // Without validation, the result would contain uncommitted and deleted rows
+  auto validated = lqp_is_validated(lqp);
+  visit_lqp_and_subqueries(lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions()) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::LQPSelect) {
+          validated &= lqp_is_validated(std::static_pointer_cast<LQPSelectExpression>(sub_expression)->lqp);
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+  });
+  return validated;
+}
+
+std::vector<SQLResultCacheTableState> SQLResultCache::capture_table_states(
+    const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto table_states = std::vector<SQLResultCacheTableState>{};
+  visit_lqp_and_subqueries(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::StoredTable) return;
+
+    const auto& table_name = std::static_pointer_cast<StoredTableNode>(node)->table_name;
+    const auto table = StorageManager::get().get_table(table_name);
+    table_states.push_back(
+        {table_name, table, table->chunk_count(), table->row_count(), table->last_modification_commit_id()});
+  });
+  return table_states;
+}
+
+std::shared_ptr<const Table> SQLResultCache::try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                     const std::vector<AllTypeVariant>& parameter_values,
+                                                     const CommitID snapshot_commit_id) {
+  const auto entry = _cache.try_get(lqp_hash(lqp, parameter_values));
+  if (!entry || entry->parameter_values != parameter_values || *entry->lqp != *lqp) return nullptr;
+
+  const auto& storage_manager = StorageManager::get();
+  for (const auto& table_state : entry->table_states) {
+    // The table was dropped or replaced by another one with the same name
+    const auto table = table_state.table.lock();
+    if (!table || !storage_manager.has_table(table_state.table_name) ||
+        storage_manager.get_table(table_state.table_name) != table) {
+      return nullptr;
+    }
+
+    // The table was modified since the result was computed, or the snapshot does not contain the last modification
+    if (table->chunk_count() != table_state.chunk_count || table->row_count() != table_state.row_count ||
+        table->last_modification_commit_id() != table_state.last_modification_commit_id ||
+        snapshot_commit_id < table_state.last_modification_commit_id) {
+      return nullptr;
+    }
+  }
+
+  return entry->result;
+}
+
+void SQLResultCache::set(const std::shared_ptr<AbstractLQPNode>& lqp,
+                         const std::vector<AllTypeVariant>& parameter_values,
+                         const std::vector<SQLResultCacheTableState>& table_states, const CommitID snapshot_commit_id,
+                         const std::shared_ptr<const Table>& result) {
+  // If a table was modified after the snapshot was taken, the captured state does not match the result
+  for (const auto& table_state : table_states) {
+    if (table_state.last_modification_commit_id > snapshot_commit_id) return;
+  }
+
+  _cache.set(lqp_hash(lqp, parameter_values), {lqp, parameter_values, table_states, result});
+}
+
+size_t SQLResultCache::size() const { return _cache.size(); }
+
+void SQLResultCache::clear() { _cache.clear(); }
+
+}  // namespace opossum
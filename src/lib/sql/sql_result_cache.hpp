@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+// The state of a table that a cached result was computed from
+struct SQLResultCacheTableState {
+  std::string table_name;
+  std::weak_ptr<const Table> table;
+  ChunkID chunk_count;
+  uint64_t row_count;
+  CommitID last_modification_commit_id;
+};
+
+struct SQLResultCacheEntry {
+  std::shared_ptr<AbstractLQPNode> lqp;
+  std::vector<AllTypeVariant> parameter_values;
+  std::vector<SQLResultCacheTableState> table_states;
+  std::shared_ptr<const Table> result;
+};
+
+/**
+ * Caches the results of read-only statements, keyed by their optimized LQP and the values of their (auto-generated)
+ * parameters, so that repeated queries over rarely changing tables are not executed again.
+ *
+ * A cached result was computed for one snapshot. It is valid for another snapshot if no committed modification of
+ * the referenced tables lies between the two. Therefore, the state of the tables is captured before execution and the
+ * result is only cached if the snapshot already contained all modifications. Later, the result is only returned if
+ * the tables are still in the same state and the requesting snapshot contains all of their modifications, too. Insert
+ * and Delete raise Table::last_modification_commit_id() on commit, which invalidates the entries of that table. Chunks
+ * appended outside of transactions (e.g., by COPY) change the chunk and row counts and invalidate the entries as well.
+ *
+ * Only validated LQPs are cached, and the SQLPipelineStatement only uses the cache for auto-committed SELECT
+ * statements, which cannot see uncommitted modifications of their own transaction.
+ */
+class SQLResultCache {
+ public:
+  explicit SQLResultCache(size_t capacity = DefaultCacheCapacity);
+
+  // Returns false for LQPs that modify data or are not validated, whose results must not be cached
+  static bool is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Captures the current state of all tables referenced by the LQP (including subqueries). Call this before executing
+  // the LQP.
+  static std::vector<SQLResultCacheTableState> capture_table_states(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Returns nullptr if there is no result for the LQP and parameters that is valid for the snapshot
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                       const std::vector<AllTypeVariant>& parameter_values,
+                                       const CommitID snapshot_commit_id);
+
+  // Caches the result if it was computed for a snapshot that includes all modifications of the captured tables
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<AllTypeVariant>& parameter_values,
+           const std::vector<SQLResultCacheTableState>& table_states, const CommitID snapshot_commit_id,
+           const std::shared_ptr<const Table>& result);
+
+  size_t size() const;
+  void clear();
+
+ protected:
+  SQLQueryCache<SQLResultCacheEntry, size_t> _cache;
+};
+
+}  // namespace opossum
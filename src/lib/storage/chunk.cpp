@@ -30,6 +30,8 @@ Chunk::Chunk(const Segments& segments, const std::shared_ptr<MvccData>& mvcc_dat
 #endif
 
   if (alloc) _alloc = *alloc;
+
+  _reserved_row_count = size();
 }
 
 bool Chunk::is_mutable() const { return _is_mutable; }
@@ -56,6 +58,21 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   for (; segment_it != _segments.end(); segment_it++, value_it++) {
     (*segment_it)->append(*value_it);
   }
+
+  ++_reserved_row_count;
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count, const ChunkOffset capacity) {
+  DebugAssert(is_mutable(), "Can't reserve rows in immutable Chunk");
+
+  auto begin = _reserved_row_count.load();
+  auto reserved_row_count = ChunkOffset{0};
+  do {
+    reserved_row_count = begin < capacity ? std::min(row_count, capacity - begin) : 0u;
+    if (reserved_row_count == 0) break;
+  } while (!_reserved_row_count.compare_exchange_weak(begin, begin + reserved_row_count));
+
+  return {begin, reserved_row_count};
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
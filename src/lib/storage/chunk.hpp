@@ -11,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "index/segment_index_type.hpp"
@@ -65,6 +66,13 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  /**
+   * Reserves up to `row_count` rows at the end of the chunk, which holds at most `capacity` rows, for an Insert that
+   * grows the segments and writes the rows afterwards. Concurrent reservations get disjoint rows without locking.
+   * Returns the offset of the first reserved row and the number of reserved rows, which is zero if the chunk is full.
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(const ChunkOffset row_count, const ChunkOffset capacity);
+
   /**
    * Atomically accesses and returns the segment at a given position
    *
@@ -158,6 +166,9 @@ class Chunk : private Noncopyable {
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
   bool _is_mutable = true;
+
+  // The number of rows that exist or were reserved by reserve_rows(). Kept in sync by append().
+  std::atomic<ChunkOffset> _reserved_row_count{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,120 @@
+#include "chunk_encoding_manager.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+const ChunkEncodingManager::Options& ChunkEncodingManager::options() const { return _options; }
+
+void ChunkEncodingManager::set_options(const Options& options) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _options = options;
+  if (_loop_thread) _loop_thread->set_loop_sleep_time(_options.interval);
+}
+
+void ChunkEncodingManager::set_chunk_encoding_spec(const std::string& table_name,
+                                                   const ChunkEncodingSpec& chunk_encoding_spec) {
+  const auto& storage_manager = StorageManager::get();
+  Assert(!storage_manager.has_table(table_name) ||
+             storage_manager.get_table(table_name)->column_count() == chunk_encoding_spec.size(),
+         "Number of segment encoding specs must match the table's column count.");
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _chunk_encoding_specs[table_name] = chunk_encoding_spec;
+}
+
+ChunkEncodingSpec ChunkEncodingManager::chunk_encoding_spec(const std::string& table_name) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto spec_iter = _chunk_encoding_specs.find(table_name);
+  if (spec_iter != _chunk_encoding_specs.end()) return spec_iter->second;
+
+  const auto column_count = StorageManager::get().get_table(table_name)->column_count();
+  return ChunkEncodingSpec{column_count, _options.default_segment_encoding_spec};
+}
+
+void ChunkEncodingManager::resume() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_loop_thread) return;
+
+  _loop_thread =
+      std::make_unique<PausableLoopThread>(_options.interval, [this](size_t) { encode_completed_chunks(); });
+}
+
+void ChunkEncodingManager::pause() {
+  auto loop_thread = std::unique_ptr<PausableLoopThread>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    loop_thread = std::move(_loop_thread);
+  }
+
+  // Waits for the current iteration to finish
+  loop_thread.reset();
+}
+
+size_t ChunkEncodingManager::encode_completed_chunks() {
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto encoded_chunk_count = size_t{0};
+
+  const auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    const auto table = storage_manager.get_table(table_name);
+
+    // Without MVCC data, the chunks cannot be checked for uncommitted inserts
+    if (table->has_mvcc() == UseMvcc::No) continue;
+
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk->is_mutable() || !ChunkCompressionTask::chunk_is_completed(chunk, table->max_chunk_size())) continue;
+
+      // Chunks of ValueSegments are not necessarily marked immutable, e.g., if they were loaded from a file
+      auto all_value_segments = true;
+      for (const auto& segment : chunk->segments()) {
+        all_value_segments &= std::dynamic_pointer_cast<const BaseValueSegment>(segment) != nullptr;
+      }
+      if (all_value_segments) chunk_ids.emplace_back(chunk_id);
+    }
+
+    if (chunk_ids.empty()) continue;
+
+    auto encoding_advisor = std::optional<EncodingAdvisor>{};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_options.encoding_advisor_options && !_chunk_encoding_specs.count(table_name)) {
+        encoding_advisor.emplace(*_options.encoding_advisor_options);
+      }
+    }
+
+    if (encoding_advisor) {
+      // The advised encodings differ per chunk
+      const auto data_types = table->column_data_types();
+      for (const auto chunk_id : chunk_ids) {
+        const auto advised_spec = encoding_advisor->advise(table->get_chunk(chunk_id), data_types);
+        tasks.emplace_back(std::make_shared<ChunkCompressionTask>(table_name, std::vector<ChunkID>{chunk_id},
+                                                                  advised_spec, SchedulePriority::Lowest));
+      }
+    } else {
+      tasks.emplace_back(std::make_shared<ChunkCompressionTask>(table_name, chunk_ids, chunk_encoding_spec(table_name),
+                                                                SchedulePriority::Lowest));
+    }
+    encoded_chunk_count += chunk_ids.size();
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  return encoded_chunk_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * The ChunkEncodingManager is a singleton that encodes the completed chunks of all stored tables in the background.
+ * Chunks filled by Inserts would otherwise remain ValueSegments forever, without the faster scans, ChunkStatistics,
+ * and pruning that encoded chunks allow for.
+ *
+ * Periodically, it looks for mutable chunks that are completed, i.e., full and without uncommitted inserts (see
+ * ChunkCompressionTask), and encodes them with ChunkCompressionTasks at the lowest SchedulePriority, so that they are
+ * only executed when the workers are otherwise idle. Each table is encoded with the ChunkEncodingSpec that was set for
+ * it. Otherwise, if EncodingAdvisor options are given, the EncodingAdvisor picks the encodings for each chunk, or else
+ * the default SegmentEncodingSpec of the Options is used.
+ *
+ * The ChunkEncodingManager is initialized in a paused state and needs to be `resumed` to start its operation. It needs
+ * to be paused before the StorageManager is reset or destroyed.
+ */
+class ChunkEncodingManager : public Singleton<ChunkEncodingManager> {
+ public:
+  struct Options {
+    // The time interval at which the stored tables are checked for completed chunks
+    std::chrono::milliseconds interval = std::chrono::seconds(1);
+
+    // Used for the tables that no ChunkEncodingSpec was set for
+    SegmentEncodingSpec default_segment_encoding_spec;
+
+    // If set, used instead of the default SegmentEncodingSpec to pick the encodings of each chunk
+    std::optional<EncodingAdvisor::Options> encoding_advisor_options;
+  };
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  // The spec has to have one SegmentEncodingSpec per column of the table. It is kept if the table is dropped.
+  void set_chunk_encoding_spec(const std::string& table_name, const ChunkEncodingSpec& chunk_encoding_spec);
+
+  // Returns the ChunkEncodingSpec set for the table, or one built from the default SegmentEncodingSpec
+  ChunkEncodingSpec chunk_encoding_spec(const std::string& table_name) const;
+
+  void resume();
+  void pause();
+
+  /**
+   * Encodes the completed chunks of all stored tables and waits until they are encoded. Called periodically while the
+   * ChunkEncodingManager is resumed. Returns the number of encoded chunks.
+   */
+  size_t encode_completed_chunks();
+
+  ChunkEncodingManager(ChunkEncodingManager&&) = delete;
+
+ protected:
+  ChunkEncodingManager() = default;
+
+  friend class Singleton;
+
+  Options _options;
+  std::unordered_map<std::string, ChunkEncodingSpec> _chunk_encoding_specs;
+
+  // Guards the options and specs, which are set by other threads than the one encoding the chunks
+  mutable std::mutex _mutex;
+
+  // Exists while the ChunkEncodingManager is resumed
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -5,6 +5,7 @@
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 
 #include "storage/frame_of_reference/frame_of_reference_iterable.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
@@ -54,6 +55,11 @@ auto create_iterable_from_segment(const FrameOfReferenceSegment<T>& segment) {
   return erase_type_from_iterable_if_debug(FrameOfReferenceIterable<T>{segment});
 }
 
+template <typename T>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment) {
+  return erase_type_from_iterable_if_debug(FSSTSegmentIterable<T>{segment});
+}
+
 /**
  * This function must be forward-declared because ReferenceSegmentIterable
  * includes this file leading to a circular dependency
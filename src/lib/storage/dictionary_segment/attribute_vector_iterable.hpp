@@ -36,6 +36,21 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
     });
   }
 
+  // The iterators are created at begin_offset right away
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    resolve_compressed_vector_type(_attribute_vector, [&](const auto& vector) {
+      using ZsIteratorType = decltype(vector.cbegin());
+
+      auto begin = Iterator<ZsIteratorType>{_null_value_id, vector.iterator_at(begin_offset), begin_offset};
+      auto end = Iterator<ZsIteratorType>{_null_value_id, vector.iterator_at(end_offset), end_offset};
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _attribute_vector.size(); }
+
  private:
   const BaseCompressedVector& _attribute_vector;
   const ValueID _null_value_id;
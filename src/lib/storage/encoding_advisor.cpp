@@ -0,0 +1,276 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Parameters of the scan cost model, relative to reading one value of an unencoded int segment
+constexpr auto SCAN_COST_PER_BYTE = 0.25f;
+constexpr auto SCAN_COST_PER_RUN = 2.0f;
+
+// The cost of decoding one row, in addition to reading its bytes
+float decoding_cost_per_row(const SegmentEncodingSpec& spec) {
+  const auto simd_bp128 = spec.vector_compression_type == VectorCompressionType::SimdBp128;
+
+  switch (spec.encoding_type) {
+    case EncodingType::Unencoded:
+      return 0.0f;
+    case EncodingType::Dictionary:
+    case EncodingType::FixedStringDictionary:
+      // Scans compare value ids, the dictionary is only searched once
+      return simd_bp128 ? 1.5f : 0.5f;
+    case EncodingType::FrameOfReference:
+      // Every value has to be decompressed and added to its block's minimum
+      return simd_bp128 ? 2.0f : 1.0f;
+    case EncodingType::RunLength:
+      // Scaled by the number of runs instead
+      return 0.0f;
+    case EncodingType::FSST:
+      // Only equality is evaluated on the codes, other predicates decompress every string
+      return simd_bp128 ? 4.5f : 4.0f;
+  }
+  Fail("Unknown EncodingType.");
+}
+
+// Memory allocated by the std::strings that is not included in estimate_memory_usage(). Strings longer than the small
+// string buffer are stored on the heap.
+template <typename Strings>
+size_t string_heap_usage(const Strings& strings) {
+  const auto small_string_capacity = std::string{}.capacity();
+
+  auto heap_usage = size_t{0};
+  for (const auto& string : strings) {
+    if (string.size() > small_string_capacity) heap_usage += string.capacity() + 1;
+  }
+  return heap_usage;
+}
+
+// estimate_memory_usage() plus the memory allocated by std::strings
+size_t memory_usage(const BaseSegment& segment) {
+  auto memory_usage = segment.estimate_memory_usage();
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<std::string>*>(&segment)) {
+    memory_usage += string_heap_usage(value_segment->values());
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<std::string>*>(&segment)) {
+    memory_usage += string_heap_usage(*dictionary_segment->dictionary());
+  } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<std::string>*>(&segment)) {
+    memory_usage += string_heap_usage(*run_length_segment->values());
+  }
+  return memory_usage;
+}
+
+struct Sample {
+  std::shared_ptr<const BaseValueSegment> segment;
+
+  // Number of runs of equal values (or NULLs) within the sampled blocks
+  size_t run_count{0};
+};
+
+/**
+ * Copies `block_count` evenly distributed, contiguous blocks of rows into a new ValueSegment, or returns the segment
+ * itself if it is not larger than the sample.
+ */
+template <typename T>
+Sample take_sample(const std::shared_ptr<const ValueSegment<T>>& segment, const ChunkOffset sample_size,
+                   const ChunkOffset block_count) {
+  const auto& values = segment->values();
+  const auto nullable = segment->is_nullable();
+  const auto size = static_cast<ChunkOffset>(segment->size());
+
+  auto sample = Sample{};
+  auto sample_values = std::vector<T>{};
+  auto sample_null_values = std::vector<bool>{};
+  sample_values.reserve(std::min(size, sample_size));
+
+  const auto add_block = [&](const ChunkOffset begin, const ChunkOffset end, const bool copy) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      const auto is_null = nullable && segment->null_values()[chunk_offset];
+      const auto& value = values[chunk_offset];
+
+      if (chunk_offset == begin) {
+        ++sample.run_count;
+      } else {
+        const auto previous_is_null = nullable && segment->null_values()[chunk_offset - 1];
+        if (is_null != previous_is_null || (!is_null && !(value == values[chunk_offset - 1]))) ++sample.run_count;
+      }
+
+      if (copy) {
+        sample_values.emplace_back(value);
+        if (nullable) sample_null_values.emplace_back(is_null);
+      }
+    }
+  };
+
+  if (size <= sample_size) {
+    add_block(ChunkOffset{0}, size, false);
+    sample.segment = segment;
+    return sample;
+  }
+
+  const auto block_size = (sample_size + block_count - 1) / block_count;
+  const auto stride = size / block_count;
+  for (auto block_id = ChunkOffset{0}; block_id < block_count; ++block_id) {
+    const auto begin = static_cast<ChunkOffset>(block_id * stride);
+    add_block(begin, std::min(static_cast<ChunkOffset>(begin + block_size), size), true);
+  }
+
+  if (nullable) {
+    sample.segment = std::make_shared<ValueSegment<T>>(sample_values, sample_null_values);
+  } else {
+    sample.segment = std::make_shared<ValueSegment<T>>(sample_values);
+  }
+  return sample;
+}
+
+// All combinations of encoding type and vector compression that support the data type, including Unencoded
+std::vector<SegmentEncodingSpec> candidate_specs(const DataType data_type) {
+  auto specs = std::vector<SegmentEncodingSpec>{SegmentEncodingSpec{EncodingType::Unencoded}};
+
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength,
+                                   EncodingType::FixedStringDictionary, EncodingType::FrameOfReference,
+                                   EncodingType::FSST}) {
+    const auto encoder = create_encoder(encoding_type);
+    if (!encoder->supports(data_type)) continue;
+
+    if (encoder->uses_vector_compression()) {
+      specs.emplace_back(encoding_type, VectorCompressionType::FixedSizeByteAligned);
+      specs.emplace_back(encoding_type, VectorCompressionType::SimdBp128);
+    } else {
+      specs.emplace_back(encoding_type);
+    }
+  }
+
+  return specs;
+}
+
+}  // namespace
+
+EncodingAdvisor::EncodingAdvisor() : EncodingAdvisor(Options{}) {}
+
+EncodingAdvisor::EncodingAdvisor(const Options& options) : _options(options) {
+  Assert(_options.sample_size > 0 && _options.sample_block_count > 0, "Sample must not be empty.");
+  Assert(_options.sample_block_count <= _options.sample_size, "Sample blocks must not be empty.");
+}
+
+const EncodingAdvisor::Options& EncodingAdvisor::options() const { return _options; }
+
+std::vector<EncodingCandidate> EncodingAdvisor::estimate_candidates(
+    DataType data_type, const std::shared_ptr<const BaseValueSegment>& segment) const {
+  auto sample = Sample{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment);
+    Assert(value_segment, "Segment must be a ValueSegment of the given data type.");
+    sample = take_sample(value_segment, _options.sample_size, _options.sample_block_count);
+  });
+
+  const auto sample_row_count = sample.segment->size();
+  auto candidates = std::vector<EncodingCandidate>{};
+  if (sample_row_count == 0) return candidates;
+
+  const auto scale = static_cast<float>(segment->size()) / static_cast<float>(sample_row_count);
+  const auto runs_per_row = static_cast<float>(sample.run_count) / static_cast<float>(sample_row_count);
+
+  for (const auto& spec : candidate_specs(data_type)) {
+    auto sample_memory_usage = size_t{0};
+    if (spec.encoding_type == EncodingType::Unencoded) {
+      sample_memory_usage = memory_usage(*sample.segment);
+    } else {
+      sample_memory_usage =
+          memory_usage(*encode_segment(spec.encoding_type, data_type, sample.segment, spec.vector_compression_type));
+    }
+
+    const auto bytes_per_row = static_cast<float>(sample_memory_usage) / static_cast<float>(sample_row_count);
+    auto scan_cost_per_row = decoding_cost_per_row(spec) + bytes_per_row * SCAN_COST_PER_BYTE;
+    if (spec.encoding_type == EncodingType::RunLength) scan_cost_per_row += runs_per_row * SCAN_COST_PER_RUN;
+
+    const auto estimated_memory_usage = static_cast<size_t>(static_cast<float>(sample_memory_usage) * scale);
+    const auto estimated_scan_cost = scan_cost_per_row * static_cast<float>(segment->size());
+    candidates.emplace_back(EncodingCandidate{spec, estimated_memory_usage, estimated_scan_cost});
+  }
+
+  return candidates;
+}
+
+SegmentEncodingSpec EncodingAdvisor::advise(DataType data_type,
+                                            const std::shared_ptr<const BaseValueSegment>& segment) const {
+  const auto candidates = estimate_candidates(data_type, segment);
+
+  // Empty segments are encoded with the default encoding
+  if (candidates.empty()) return SegmentEncodingSpec{};
+
+  return _pick(candidates).segment_encoding_spec;
+}
+
+ChunkEncodingSpec EncodingAdvisor::advise(const std::shared_ptr<const Chunk>& chunk,
+                                          const std::vector<DataType>& data_types) const {
+  Assert(chunk->column_count() == data_types.size(), "Number of data types must match the chunk's column count.");
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(data_types.size());
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_id));
+    Assert(value_segment, "All segments of the chunk need to be ValueSegments.");
+
+    chunk_encoding_spec.emplace_back(advise(data_types[column_id], value_segment));
+  }
+
+  return chunk_encoding_spec;
+}
+
+std::vector<ChunkEncodingSpec> EncodingAdvisor::advise(const std::shared_ptr<const Table>& table) const {
+  auto chunk_encoding_specs = std::vector<ChunkEncodingSpec>{};
+  chunk_encoding_specs.reserve(table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    chunk_encoding_specs.emplace_back(advise(table->get_chunk(chunk_id), table->column_data_types()));
+  }
+
+  return chunk_encoding_specs;
+}
+
+const EncodingCandidate& EncodingAdvisor::_pick(const std::vector<EncodingCandidate>& candidates) const {
+  const auto memory_usage = [](const EncodingCandidate& candidate) {
+    return static_cast<float>(candidate.estimated_memory_usage);
+  };
+  const auto scan_cost = [](const EncodingCandidate& candidate) { return candidate.estimated_scan_cost; };
+
+  const auto pick = [&](const auto& primary, const auto& secondary) -> const EncodingCandidate& {
+    const auto best = std::min_element(candidates.cbegin(), candidates.cend(), [&](const auto& lhs, const auto& rhs) {
+      return primary(lhs) < primary(rhs);
+    });
+    const auto threshold = primary(*best) * (1.0f + _options.tolerance);
+
+    auto picked = best;
+    for (auto iter = candidates.cbegin(); iter != candidates.cend(); ++iter) {
+      if (primary(*iter) <= threshold && secondary(*iter) < secondary(*picked)) picked = iter;
+    }
+    return *picked;
+  };
+
+  switch (_options.goal) {
+    case EncodingOptimizationGoal::MemoryUsage:
+      return pick(memory_usage, scan_cost);
+    case EncodingOptimizationGoal::ScanPerformance:
+      return pick(scan_cost, memory_usage);
+  }
+  Fail("Unknown EncodingOptimizationGoal.");
+}
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseValueSegment;
+class Chunk;
+class Table;
+
+enum class EncodingOptimizationGoal { MemoryUsage, ScanPerformance };
+
+// The estimates for one combination of encoding type and vector compression
+struct EncodingCandidate {
+  SegmentEncodingSpec segment_encoding_spec;
+
+  // Extrapolated from the sample to the full segment
+  size_t estimated_memory_usage;
+
+  // Relative cost of scanning the full segment, in units of reading one value of an unencoded int segment
+  float estimated_scan_cost;
+};
+
+/**
+ * The EncodingAdvisor picks a SegmentEncodingSpec per segment instead of one for all segments of a table. Sorted IDs,
+ * low-cardinality flags, and long strings, for example, are best served by different encodings.
+ *
+ * For a ValueSegment, it takes a sample of evenly distributed, contiguous blocks of rows (contiguous, so that runs of
+ * equal values are preserved for RunLength) and encodes the sample with every combination of encoding type and
+ * vector compression that supports the segment's data type. The memory usage of the encoded sample is extrapolated
+ * to the full segment. The scan cost is estimated by a simple model: a fixed cost per row for decoding, which depends
+ * on the encoding and vector compression, plus a cost per byte read. RunLength segments are scanned run by run and
+ * their decoding cost scales with the number of runs instead.
+ *
+ * Depending on the optimization goal, the candidate with the lowest memory usage or with the lowest scan cost is
+ * picked. Among the candidates within `tolerance` of the best one, the one that is best for the other goal wins, so
+ * that, e.g., a slightly larger segment is preferred if it is scanned a lot faster.
+ */
+class EncodingAdvisor {
+ public:
+  struct Options {
+    EncodingOptimizationGoal goal = EncodingOptimizationGoal::MemoryUsage;
+
+    // The number of rows that are encoded per segment
+    ChunkOffset sample_size = 4'096;
+
+    // The number of contiguous blocks that the sample is taken from
+    ChunkOffset sample_block_count = 8;
+
+    // Relative deviation from the best candidate within which the other goal decides
+    float tolerance = 0.1f;
+  };
+
+  EncodingAdvisor();
+  explicit EncodingAdvisor(const Options& options);
+
+  const Options& options() const;
+
+  // Returns the estimates for all combinations of encoding type and vector compression that support the data type,
+  // including Unencoded
+  std::vector<EncodingCandidate> estimate_candidates(DataType data_type,
+                                                     const std::shared_ptr<const BaseValueSegment>& segment) const;
+
+  SegmentEncodingSpec advise(DataType data_type, const std::shared_ptr<const BaseValueSegment>& segment) const;
+
+  // All segments of the chunk need to be ValueSegments
+  ChunkEncodingSpec advise(const std::shared_ptr<const Chunk>& chunk, const std::vector<DataType>& data_types) const;
+
+  // Returns one ChunkEncodingSpec per chunk, to be passed to ChunkEncoder::encode_all_chunks()
+  std::vector<ChunkEncodingSpec> advise(const std::shared_ptr<const Table>& table) const;
+
+ protected:
+  const EncodingCandidate& _pick(const std::vector<EncodingCandidate>& candidates) const;
+
+  const Options _options;
+};
+
+}  // namespace opossum
@@ -20,7 +20,7 @@ class FrameOfReferenceIterable : public PointAccessibleSegmentIterable<FrameOfRe
       using OffsetValueIteratorT = decltype(offset_values.cbegin());
 
       auto begin = Iterator<OffsetValueIteratorT>{_segment.block_minima().cbegin(), offset_values.cbegin(),
-                                                  _segment.null_values().cbegin()};
+                                                  _segment.null_values().cbegin(), ChunkOffset{0u}};
 
       auto end = Iterator<OffsetValueIteratorT>{offset_values.cend()};
 
@@ -43,6 +43,25 @@ class FrameOfReferenceIterable : public PointAccessibleSegmentIterable<FrameOfRe
     });
   }
 
+  // The iterators are created at begin_offset right away
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueIteratorT = decltype(offset_values.cbegin());
+
+      static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
+
+      auto begin = Iterator<OffsetValueIteratorT>{_segment.block_minima().cbegin() + begin_offset / block_size,
+                                                  offset_values.iterator_at(begin_offset),
+                                                  _segment.null_values().cbegin() + begin_offset, begin_offset};
+
+      auto end = Iterator<OffsetValueIteratorT>{offset_values.iterator_at(end_offset)};
+
+      functor(begin, end);
+    });
+  }
+
   size_t _on_size() const { return _segment.size(); }
 
  private:
@@ -58,15 +77,15 @@ class FrameOfReferenceIterable : public PointAccessibleSegmentIterable<FrameOfRe
    public:
     // Begin Iterator
     explicit Iterator(ReferenceFrameIterator block_minimum_it, OffsetValueIteratorT offset_value_it,
-                      NullValueIterator null_value_it)
+                      NullValueIterator null_value_it, const ChunkOffset chunk_offset)
         : _block_minimum_it{block_minimum_it},
           _offset_value_it{offset_value_it},
           _null_value_it{null_value_it},
-          _index_within_frame{0u},
-          _chunk_offset{0u} {}
+          _index_within_frame{chunk_offset % FrameOfReferenceSegment<T>::block_size},
+          _chunk_offset{chunk_offset} {}
 
     // End iterator
-    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{{}, offset_value_it, {}} {}
+    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{{}, offset_value_it, {}, ChunkOffset{0u}} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
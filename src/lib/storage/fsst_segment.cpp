@@ -0,0 +1,101 @@
+#include "fsst_segment.hpp"
+
+#include <string>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+FSSTSegment<T, U>::FSSTSegment(pmr_vector<uint8_t> compressed_values,
+                               std::unique_ptr<const BaseCompressedVector> end_offsets, pmr_vector<bool> null_values,
+                               const FSSTSymbolTable& symbol_table)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _compressed_values{std::move(compressed_values)},
+      _end_offsets{std::move(end_offsets)},
+      _null_values{std::move(null_values)},
+      _symbol_table{symbol_table},
+      _decoder{_end_offsets->create_base_decoder()} {}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& FSSTSegment<T, U>::compressed_values() const {
+  return _compressed_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& FSSTSegment<T, U>::end_offsets() const {
+  return *_end_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& FSSTSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const FSSTSymbolTable& FSSTSegment<T, U>::symbol_table() const {
+  return _symbol_table;
+}
+
+template <typename T, typename U>
+const AllTypeVariant FSSTSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> FSSTSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  const auto begin = chunk_offset == 0 ? uint32_t{0} : _decoder->get(chunk_offset - 1);
+  const auto end = _decoder->get(chunk_offset);
+  return _symbol_table.decompress(_compressed_values.data() + begin, _compressed_values.data() + end);
+}
+
+template <typename T, typename U>
+size_t FSSTSegment<T, U>::size() const {
+  return _end_offsets->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> FSSTSegment<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_compressed_values = pmr_vector<uint8_t>{_compressed_values, alloc};
+  auto new_end_offsets = _end_offsets->copy_using_allocator(alloc);
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+
+  return std::allocate_shared<FSSTSegment>(alloc, std::move(new_compressed_values), std::move(new_end_offsets),
+                                           std::move(new_null_values), _symbol_table);
+}
+
+template <typename T, typename U>
+size_t FSSTSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  // The symbol table is part of the segment object
+  return sizeof(*this) + _compressed_values.size() + _end_offsets->data_size() + _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType FSSTSegment<T, U>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T, typename U>
+CompressedVectorType FSSTSegment<T, U>::compressed_vector_type() const {
+  return _end_offsets->type();
+}
+
+template class FSSTSegment<std::string>;
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <memory>
+#include <type_traits>
+
+#include "base_encoded_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing FSST string compression
+ *
+ * Each string is compressed using a symbol table (see FSSTSymbolTable) that is built from a sample of the segment.
+ * Other than a dictionary, FSST also compresses segments with many distinct strings, such as comments or URLs.
+ *
+ * The codes of all strings are stored one after the other. To randomly access a string, the end offset of its codes
+ * is stored per string, compressed using vector compression. The codes of the string at chunk_offset are
+ * [end_offsets[chunk_offset - 1], end_offsets[chunk_offset]), or start at 0 for the first string.
+ *
+ * NULLs are stored as empty strings and marked in an additional boolean vector.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
+                          enum_c<EncodingType, EncodingType::FSST>, hana::type_c<T>)>>
+class FSSTSegment : public BaseEncodedSegment {
+ public:
+  explicit FSSTSegment(pmr_vector<uint8_t> compressed_values, std::unique_ptr<const BaseCompressedVector> end_offsets,
+                       pmr_vector<bool> null_values, const FSSTSymbolTable& symbol_table);
+
+  const pmr_vector<uint8_t>& compressed_values() const;
+  const BaseCompressedVector& end_offsets() const;
+  const pmr_vector<bool>& null_values() const;
+  const FSSTSymbolTable& symbol_table() const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  CompressedVectorType compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<uint8_t> _compressed_values;
+  const std::unique_ptr<const BaseCompressedVector> _end_offsets;
+  const pmr_vector<bool> _null_values;
+  const FSSTSymbolTable _symbol_table;
+  std::unique_ptr<BaseVectorDecompressor> _decoder;
+};
+
+}  // namespace opossum
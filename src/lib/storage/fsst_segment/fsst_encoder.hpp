@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  // The symbol table is built from a sample of about this many bytes, as in the FSST paper
+  static constexpr auto sample_size = size_t{16'384};
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = value_segment->values().get_allocator();
+    const auto size = value_segment->size();
+
+    const auto symbol_table = FSSTSymbolTable::build(_take_sample(*value_segment));
+
+    // holds the codes of all values
+    auto compressed_values = pmr_vector<uint8_t>{alloc};
+
+    // holds the end of each value's codes, used as input for the vector compression
+    auto end_offsets = pmr_vector<uint32_t>{alloc};
+    end_offsets.reserve(size);
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      for (; segment_it != segment_end; ++segment_it) {
+        const auto segment_value = *segment_it;
+
+        if (!segment_value.is_null()) {
+          symbol_table.compress(segment_value.value(), compressed_values);
+        }
+        null_values.push_back(segment_value.is_null());
+
+        Assert(compressed_values.size() <= std::numeric_limits<uint32_t>::max(),
+               "Compressed values must be addressable by uint32_t offsets.");
+        end_offsets.push_back(static_cast<uint32_t>(compressed_values.size()));
+      }
+    });
+
+    compressed_values.shrink_to_fit();
+
+    const auto max_end_offset = static_cast<uint32_t>(compressed_values.size());
+    auto encoded_end_offsets = compress_vector(end_offsets, vector_compression_type(), alloc, {max_end_offset});
+
+    return std::allocate_shared<FSSTSegment<T>>(alloc, std::move(compressed_values), std::move(encoded_end_offsets),
+                                                std::move(null_values), symbol_table);
+  }
+
+ private:
+  // Takes evenly distributed values from the segment, of about sample_size bytes in total
+  template <typename T>
+  std::vector<std::string> _take_sample(const ValueSegment<T>& value_segment) {
+    const auto& values = value_segment.values();
+
+    auto total_size = size_t{0};
+    for (const auto& value : values) {
+      total_size += value.size();
+    }
+    const auto stride = std::max(total_size / sample_size, size_t{1});
+
+    auto sample = std::vector<std::string>{};
+    for (auto chunk_offset = size_t{0}; chunk_offset < values.size(); chunk_offset += stride) {
+      if (value_segment.is_nullable() && value_segment.null_values()[chunk_offset]) continue;
+      sample.emplace_back(values[chunk_offset]);
+    }
+    return sample;
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/fsst_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T>> {
+ public:
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.end_offsets(), [&](const auto& end_offsets) {
+      using EndOffsetIteratorT = decltype(end_offsets.cbegin());
+
+      auto begin = Iterator<EndOffsetIteratorT>{&_segment.compressed_values(), &_segment.symbol_table(),
+                                                end_offsets.cbegin(), _segment.null_values().cbegin(), 0u,
+                                                ChunkOffset{0u}};
+
+      auto end = Iterator<EndOffsetIteratorT>{end_offsets.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.end_offsets(), [&](const auto& vector) {
+      auto decoder = vector.create_decoder();
+      using EndOffsetDecompressorT = std::decay_t<decltype(*decoder)>;
+
+      auto begin = PointAccessIterator<EndOffsetDecompressorT>{&_segment.compressed_values(), &_segment.symbol_table(),
+                                                               &_segment.null_values(), decoder.get(),
+                                                               mapped_chunk_offsets.cbegin()};
+
+      auto end = PointAccessIterator<EndOffsetDecompressorT>{mapped_chunk_offsets.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  // The iterators are created at begin_offset right away. The codes of the value at begin_offset start at the end
+  // offset of the previous value.
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.end_offsets(), [&](const auto& end_offsets) {
+      using EndOffsetIteratorT = decltype(end_offsets.cbegin());
+
+      auto end_offset_it = end_offsets.iterator_at(begin_offset == 0u ? 0u : begin_offset - 1u);
+      auto codes_begin_offset = uint32_t{0u};
+      if (begin_offset > 0u) {
+        codes_begin_offset = *end_offset_it;
+        ++end_offset_it;
+      }
+
+      auto begin = Iterator<EndOffsetIteratorT>{&_segment.compressed_values(),
+                                                &_segment.symbol_table(),
+                                                end_offset_it,
+                                                _segment.null_values().cbegin() + begin_offset,
+                                                codes_begin_offset,
+                                                begin_offset};
+
+      auto end = Iterator<EndOffsetIteratorT>{end_offsets.iterator_at(end_offset)};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+ private:
+  template <typename EndOffsetIteratorT>
+  class Iterator : public BaseSegmentIterator<Iterator<EndOffsetIteratorT>, SegmentIteratorValue<T>> {
+   public:
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(const pmr_vector<uint8_t>* compressed_values, const FSSTSymbolTable* symbol_table,
+                      EndOffsetIteratorT end_offset_it, NullValueIterator null_value_it, const uint32_t begin_offset,
+                      const ChunkOffset chunk_offset)
+        : _compressed_values{compressed_values},
+          _symbol_table{symbol_table},
+          _end_offset_it{end_offset_it},
+          _null_value_it{null_value_it},
+          _begin_offset{begin_offset},
+          _chunk_offset{chunk_offset} {}
+
+    // End iterator
+    explicit Iterator(EndOffsetIteratorT end_offset_it)
+        : Iterator{nullptr, nullptr, end_offset_it, {}, 0u, ChunkOffset{0u}} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      _begin_offset = *_end_offset_it;
+      ++_end_offset_it;
+      ++_null_value_it;
+      ++_chunk_offset;
+    }
+
+    bool equal(const Iterator& other) const { return _end_offset_it == other._end_offset_it; }
+
+    SegmentIteratorValue<T> dereference() const {
+      if (*_null_value_it) return SegmentIteratorValue<T>{T{}, true, _chunk_offset};
+
+      const auto* codes = _compressed_values->data();
+      const auto value = _symbol_table->decompress(codes + _begin_offset, codes + *_end_offset_it);
+      return SegmentIteratorValue<T>{value, false, _chunk_offset};
+    }
+
+   private:
+    const pmr_vector<uint8_t>* _compressed_values;
+    const FSSTSymbolTable* _symbol_table;
+    EndOffsetIteratorT _end_offset_it;
+    NullValueIterator _null_value_it;
+    uint32_t _begin_offset;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename EndOffsetDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator<EndOffsetDecompressorT>, SegmentIteratorValue<T>> {
+   public:
+    // Begin Iterator
+    PointAccessIterator(const pmr_vector<uint8_t>* compressed_values, const FSSTSymbolTable* symbol_table,
+                        const pmr_vector<bool>* null_values, EndOffsetDecompressorT* end_offset_decoder,
+                        ChunkOffsetsIterator chunk_offsets_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator<EndOffsetDecompressorT>,
+                                         SegmentIteratorValue<T>>{chunk_offsets_it},
+          _compressed_values{compressed_values},
+          _symbol_table{symbol_table},
+          _null_values{null_values},
+          _end_offset_decoder{end_offset_decoder} {}
+
+    // End Iterator
+    explicit PointAccessIterator(ChunkOffsetsIterator chunk_offsets_it)
+        : PointAccessIterator{nullptr, nullptr, nullptr, nullptr, chunk_offsets_it} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentIteratorValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto chunk_offset = chunk_offsets.into_referenced;
+
+      if ((*_null_values)[chunk_offset]) return SegmentIteratorValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      const auto begin_offset = chunk_offset == 0 ? uint32_t{0} : _end_offset_decoder->get(chunk_offset - 1);
+      const auto end_offset = _end_offset_decoder->get(chunk_offset);
+      const auto* codes = _compressed_values->data();
+      const auto value = _symbol_table->decompress(codes + begin_offset, codes + end_offset);
+
+      return SegmentIteratorValue<T>{value, false, chunk_offsets.into_referencing};
+    }
+
+   private:
+    const pmr_vector<uint8_t>* _compressed_values;
+    const FSSTSymbolTable* _symbol_table;
+    const pmr_vector<bool>* _null_values;
+    EndOffsetDecompressorT* _end_offset_decoder;
+  };
+};
+
+}  // namespace opossum
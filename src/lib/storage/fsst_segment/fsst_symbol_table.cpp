@@ -0,0 +1,165 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The number of times the table is refined when it is built
+constexpr auto GENERATION_COUNT = 5;
+
+}  // namespace
+
+FSSTSymbolTable::FSSTSymbolTable() = default;
+
+FSSTSymbolTable::FSSTSymbolTable(const std::vector<std::string>& symbols) : _symbol_count{symbols.size()} {
+  Assert(symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols.");
+
+  auto sorted_symbols = symbols;
+  std::sort(sorted_symbols.begin(), sorted_symbols.end(), [](const auto& left, const auto& right) {
+    if (left.front() != right.front()) {
+      return static_cast<uint8_t>(left.front()) < static_cast<uint8_t>(right.front());
+    }
+    if (left.size() != right.size()) return left.size() > right.size();
+    return left < right;
+  });
+
+  for (auto code = size_t{0}; code < sorted_symbols.size(); ++code) {
+    const auto& symbol = sorted_symbols[code];
+    Assert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_SIZE, "Symbols must have one to eight bytes.");
+    DebugAssert(code == 0 || symbol != sorted_symbols[code - 1], "Symbols must be unique.");
+
+    std::memcpy(&_symbols[code], symbol.data(), symbol.size());
+    _symbol_sizes[code] = static_cast<uint8_t>(symbol.size());
+  }
+
+  // Count the symbols per first byte, then turn the counts into the first code of each byte
+  for (const auto& symbol : sorted_symbols) {
+    ++_first_codes[static_cast<uint8_t>(symbol.front()) + 1];
+  }
+  for (auto byte = size_t{1}; byte < _first_codes.size(); ++byte) {
+    _first_codes[byte] += _first_codes[byte - 1];
+  }
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string>& sample) {
+  auto symbol_table = FSSTSymbolTable{};
+
+  for (auto generation = 0; generation < GENERATION_COUNT; ++generation) {
+    // The number of bytes that each candidate covers when compressing the sample
+    auto gains = std::unordered_map<std::string, size_t>{};
+
+    for (const auto& string : sample) {
+      const auto* position = string.data();
+      const auto* const end = position + string.size();
+      auto previous_symbol = std::string{};
+
+      while (position < end) {
+        // Escaped bytes are candidates, too
+        const auto symbol_size = std::max(symbol_table._find_longest_symbol(position, end).second, size_t{1});
+        auto symbol = std::string{position, symbol_size};
+
+        gains[symbol] += symbol_size;
+        if (!previous_symbol.empty() && previous_symbol.size() + symbol_size <= MAX_SYMBOL_SIZE) {
+          gains[previous_symbol + symbol] += previous_symbol.size() + symbol_size;
+        }
+
+        previous_symbol = std::move(symbol);
+        position += symbol_size;
+      }
+    }
+
+    auto candidates = std::vector<std::pair<std::string, size_t>>{gains.cbegin(), gains.cend()};
+    const auto symbol_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+
+    // Ties are broken by the symbol, so that the table does not depend on the order of the hash map
+    std::partial_sort(candidates.begin(), candidates.begin() + symbol_count, candidates.end(),
+                      [](const auto& left, const auto& right) {
+                        if (left.second != right.second) return left.second > right.second;
+                        return left.first < right.first;
+                      });
+
+    auto symbols = std::vector<std::string>{};
+    symbols.reserve(symbol_count);
+    for (auto index = size_t{0}; index < symbol_count; ++index) {
+      symbols.emplace_back(std::move(candidates[index].first));
+    }
+
+    symbol_table = FSSTSymbolTable{symbols};
+  }
+
+  return symbol_table;
+}
+
+void FSSTSymbolTable::compress(const std::string& string, pmr_vector<uint8_t>& compressed) const {
+  const auto* position = string.data();
+  const auto* const end = position + string.size();
+
+  while (position < end) {
+    const auto [code, symbol_size] = _find_longest_symbol(position, end);
+
+    if (symbol_size == 0) {
+      compressed.push_back(ESCAPE_CODE);
+      compressed.push_back(static_cast<uint8_t>(*position));
+      ++position;
+    } else {
+      compressed.push_back(code);
+      position += symbol_size;
+    }
+  }
+}
+
+void FSSTSymbolTable::decompress(const uint8_t* begin, const uint8_t* end, std::string& string) const {
+  string.clear();
+
+  for (const auto* code_it = begin; code_it < end; ++code_it) {
+    const auto code = *code_it;
+
+    if (code == ESCAPE_CODE) {
+      ++code_it;
+      DebugAssert(code_it < end, "Escape code must be followed by a byte.");
+      string.push_back(static_cast<char>(*code_it));
+    } else {
+      DebugAssert(code < _symbol_count, "Invalid code.");
+      string.append(reinterpret_cast<const char*>(&_symbols[code]), _symbol_sizes[code]);
+    }
+  }
+}
+
+std::string FSSTSymbolTable::decompress(const uint8_t* begin, const uint8_t* end) const {
+  auto string = std::string{};
+  decompress(begin, end, string);
+  return string;
+}
+
+size_t FSSTSymbolTable::symbol_count() const { return _symbol_count; }
+
+std::string FSSTSymbolTable::symbol(const uint8_t code) const {
+  DebugAssert(code < _symbol_count, "Invalid code.");
+  return std::string{reinterpret_cast<const char*>(&_symbols[code]), _symbol_sizes[code]};
+}
+
+std::pair<uint8_t, size_t> FSSTSymbolTable::_find_longest_symbol(const char* begin, const char* end) const {
+  const auto first_byte = static_cast<uint8_t>(*begin);
+  const auto remaining_size = static_cast<size_t>(end - begin);
+
+  // Symbols with the same first byte are sorted by decreasing size, so the first one that matches is the longest
+  for (auto code = _first_codes[first_byte]; code < _first_codes[first_byte + 1]; ++code) {
+    const auto symbol_size = _symbol_sizes[code];
+    if (symbol_size <= remaining_size && std::memcmp(begin, &_symbols[code], symbol_size) == 0) {
+      return {code, symbol_size};
+    }
+  }
+
+  return {ESCAPE_CODE, 0};
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Symbol table of the FSST (Fast Static Symbol Table) string compression
+ *
+ * A symbol is a string of one to eight bytes. Strings are compressed by replacing their longest prefix that is a
+ * symbol with the symbol's one-byte code, and so on for the rest of the string. Bytes that do not start any symbol are
+ * written as the escape code followed by the byte itself.
+ *
+ * As the compression of a string only depends on the symbol table, two strings are equal if and only if their codes
+ * are, which allows comparing strings for equality without decompressing them.
+ *
+ * See Boncz et al., "FSST: Fast Random Access String Compression", VLDB 2020.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_SIZE = size_t{8};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // Creates a table without symbols, which escapes every byte
+  FSSTSymbolTable();
+
+  explicit FSSTSymbolTable(const std::vector<std::string>& symbols);
+
+  /**
+   * Builds the table from the symbols that cover the most bytes of the sample. As in the FSST paper, the table is
+   * refined over several generations: the sample is compressed with the table of the previous generation, and the
+   * symbols used as well as the concatenations of adjacent symbols become the candidates of the next table.
+   */
+  static FSSTSymbolTable build(const std::vector<std::string>& sample);
+
+  // Appends the codes of the string to compressed
+  void compress(const std::string& string, pmr_vector<uint8_t>& compressed) const;
+
+  // Replaces the content of string with the decompressed codes [begin, end)
+  void decompress(const uint8_t* begin, const uint8_t* end, std::string& string) const;
+  std::string decompress(const uint8_t* begin, const uint8_t* end) const;
+
+  size_t symbol_count() const;
+  std::string symbol(const uint8_t code) const;
+
+ private:
+  // Returns the code and size of the longest symbol that the bytes [begin, end) start with, or a size of 0 if none
+  std::pair<uint8_t, size_t> _find_longest_symbol(const char* begin, const char* end) const;
+
+  // The bytes of each symbol, padded with zeros
+  std::array<uint64_t, MAX_SYMBOL_COUNT> _symbols{};
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _symbol_sizes{};
+  size_t _symbol_count{0};
+
+  // Codes are assigned in the order of the symbols' first bytes and, for the same first byte, of decreasing size. The
+  // symbols starting with byte b have the codes [_first_codes[b], _first_codes[b + 1]).
+  std::array<uint8_t, 257> _first_codes{};
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #include "mvcc_data.hpp"
 
+#include <mutex>
+#include <optional>
 #include <shared_mutex>
 
 #include "utils/assert.hpp"
@@ -17,10 +19,20 @@ void MvccData::shrink() {
 }
 
 void MvccData::grow_by(size_t delta, CommitID begin_cid) {
-  _size += delta;
-  tids.grow_to_at_least(_size);
-  begin_cids.grow_to_at_least(_size, begin_cid);
-  end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
+  const auto size = _size += delta;
+  tids.grow_to_at_least(size);
+  begin_cids.grow_to_at_least(size, begin_cid);
+  end_cids.grow_to_at_least(size, MAX_COMMIT_ID);
+}
+
+void MvccData::grow_to_at_least(size_t size, CommitID begin_cid) {
+  tids.grow_to_at_least(size);
+  begin_cids.grow_to_at_least(size, begin_cid);
+  end_cids.grow_to_at_least(size, MAX_COMMIT_ID);
+
+  auto current_size = _size.load();
+  while (current_size < size && !_size.compare_exchange_weak(current_size, size)) {
+  }
 }
 
 void MvccData::print(std::ostream& stream) const {
@@ -37,4 +49,25 @@ void MvccData::print(std::ostream& stream) const {
   stream << std::endl;
 }
 
+std::optional<MvccData::VisibilitySummary> MvccData::visibility_summary() const {
+  std::lock_guard<std::mutex> lock(_visibility_summary_mutex);
+  return _visibility_summary;
+}
+
+uint64_t MvccData::visibility_summary_generation() const { return _visibility_summary_generation.load(); }
+
+void MvccData::set_visibility_summary(const VisibilitySummary& visibility_summary, const uint64_t generation) const {
+  std::lock_guard<std::mutex> lock(_visibility_summary_mutex);
+  if (_visibility_summary_generation.load() != generation) return;
+  _visibility_summary = visibility_summary;
+}
+
+void MvccData::invalidate_visibility_summary() {
+  // Increment the generation first so that a concurrent set_visibility_summary() either fails or is overwritten below
+  ++_visibility_summary_generation;
+
+  std::lock_guard<std::mutex> lock(_visibility_summary_mutex);
+  _visibility_summary.reset();
+}
+
 }  // namespace opossum
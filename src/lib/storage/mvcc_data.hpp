@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <mutex>
+#include <optional>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 
 #include "types.hpp"
@@ -40,8 +42,44 @@ struct MvccData {
    */
   void grow_by(size_t delta, CommitID begin_cid);
 
+  /**
+   * Grows mvcc data to at least the given size. Unlike grow_by(), this can be called concurrently, e.g., by Inserts
+   * that write different rows of a chunk (see Chunk::reserve_rows()).
+   *
+   * @param begin_cid value all new begin_cids will be set to
+   */
+  void grow_to_at_least(size_t size, CommitID begin_cid);
+
   void print(std::ostream& stream = std::cout) const;
 
+  /**
+   * If none of the first `row_count` rows is locked, deleted or uncommitted, all of them are visible to every
+   * transaction whose snapshot commit id is at least `max_begin_cid`. Validate stores such a summary after checking all
+   * rows of a chunk and uses it to skip the per-row checks for this chunk afterwards.
+   */
+  struct VisibilitySummary {
+    ChunkOffset row_count;
+    CommitID max_begin_cid;
+  };
+
+  std::optional<VisibilitySummary> visibility_summary() const;
+
+  /**
+   * Returns the generation of the visibility summary. It has to be retrieved before the rows are checked and passed to
+   * set_visibility_summary(), so that a summary is discarded if rows were invalidated in the meantime.
+   */
+  uint64_t visibility_summary_generation() const;
+  void set_visibility_summary(const VisibilitySummary& visibility_summary, const uint64_t generation) const;
+
+  /**
+   * Has to be called after rows are locked or invalidated (i.e., in Delete), as the summary might not hold anymore. If
+   * it was called before, a concurrent Validate could obtain the new generation, check the rows before they are locked,
+   * and store a summary that is stale. Called afterwards, such a Validate either sees the locked rows or obtained the
+   * old generation, so its summary is discarded. Rows that are appended do not need to invalidate the summary as it
+   * only covers `row_count` rows.
+   */
+  void invalidate_visibility_summary();
+
  private:
   /**
    * @brief Mutex used to manage access to MVCC data
@@ -52,7 +90,12 @@ struct MvccData {
    */
   std::shared_mutex _mutex;
 
-  size_t _size{0};
+  std::atomic<size_t> _size{0};
+
+  // The visibility summary is a cache that is filled by (read-only) Validates, hence mutable
+  mutable std::mutex _visibility_summary_mutex;
+  mutable std::optional<VisibilitySummary> _visibility_summary;
+  std::atomic<uint64_t> _visibility_summary_generation{0};
 };
 
 }  // namespace opossum
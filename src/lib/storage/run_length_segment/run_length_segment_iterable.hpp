@@ -33,6 +33,24 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
     functor(begin, end);
   }
 
+  // The iterators start in the run containing begin_offset, which is found using a binary search
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    const auto create_iterator = [&](const ChunkOffset position) {
+      const auto& end_positions = *_segment.end_positions();
+      const auto end_position_it = std::lower_bound(end_positions.cbegin(), end_positions.cend(), position);
+      const auto run_index = std::distance(end_positions.cbegin(), end_position_it);
+
+      return Iterator{_segment.values()->cbegin() + run_index, _segment.null_values()->cbegin() + run_index,
+                      end_position_it, position};
+    };
+
+    auto begin = create_iterator(begin_offset);
+    auto end = create_iterator(end_offset);
+    functor(begin, end);
+  }
+
   size_t _on_size() const { return _segment.size(); }
 
  private:
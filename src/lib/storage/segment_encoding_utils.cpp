@@ -5,6 +5,7 @@
 
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/frame_of_reference/frame_of_reference_encoder.hpp"
+#include "storage/fsst_segment/fsst_encoder.hpp"
 #include "storage/run_length_segment/run_length_encoder.hpp"
 
 #include "storage/base_value_segment.hpp"
@@ -24,7 +25,8 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseSegment
     {EncodingType::Dictionary, std::make_shared<DictionaryEncoder<EncodingType::Dictionary>>()},
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
-    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()}};
+    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
+    {EncodingType::FSST, std::make_shared<FSSTEncoder>()}};
 
 }  // namespace
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iterator>
 #include <type_traits>
 
 #include "storage/segment_iterables/base_segment_iterators.hpp"
@@ -141,6 +142,9 @@ class SegmentIterable {
  * reference segment (see chunk_offset_mapping.hpp). When such a list is
  * passed, the used iterators only iterate over the chunk offsets that
  * were included in the pos_list; everything else is skipped.
+ *
+ * Alternatively, a contiguous range of positions [begin_offset, end_offset) can be passed, which is iterated over
+ * using the sequential iterators and does not require a ChunkOffsetsList.
  */
 template <typename Derived>
 class PointAccessibleSegmentIterable : public SegmentIterable<Derived> {
@@ -156,6 +160,12 @@ class PointAccessibleSegmentIterable : public SegmentIterable<Derived> {
     }
   }
 
+  template <typename Functor>
+  void with_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset, const Functor& functor) const {
+    DebugAssert(begin_offset <= end_offset && end_offset <= _self()._on_size(), "Invalid range of positions");
+    _self()._on_with_range_iterators(begin_offset, end_offset, functor);
+  }
+
   using SegmentIterable<Derived>::for_each;  // needed because of “name hiding”
 
   template <typename Functor>
@@ -167,6 +177,27 @@ class PointAccessibleSegmentIterable : public SegmentIterable<Derived> {
     });
   }
 
+  /**
+   * Skips the sequential iterators ahead to begin_offset. Iterables whose sequential iterators can be created at any
+   * position override this.
+   */
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    const auto size = _self()._on_size();
+    _self()._on_with_iterators([&](auto it, auto end) {
+      std::advance(it, begin_offset);
+      if (end_offset == size) {
+        functor(it, end);
+        return;
+      }
+
+      auto range_end = it;
+      std::advance(range_end, end_offset - begin_offset);
+      functor(it, range_end);
+    });
+  }
+
  private:
   const Derived& _self() const { return static_cast<const Derived&>(*this); }
 };
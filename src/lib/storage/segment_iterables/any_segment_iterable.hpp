@@ -90,6 +90,20 @@ class AnySegmentIterable : public PointAccessibleSegmentIterable<AnySegmentItera
     });
   }
 
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    _iterable._on_with_range_iterators(begin_offset, end_offset, [&functor](auto it, auto end) {
+      using SegmentIteratorValueT = typename std::iterator_traits<decltype(it)>::value_type;
+      using DataTypeT = typename SegmentIteratorValueT::Type;
+
+      auto any_it = AnySegmentIterator<DataTypeT>{it};
+      auto any_end = AnySegmentIterator<DataTypeT>{end};
+
+      functor(any_it, any_end);
+    });
+  }
+
   size_t _on_size() const { return _iterable._on_size(); }
 
  private:
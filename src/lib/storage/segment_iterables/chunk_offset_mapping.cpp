@@ -1,11 +1,15 @@
 #include "chunk_offset_mapping.hpp"
 
+#include <algorithm>
+
 namespace opossum {
 
-ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list) {
+ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list, const ChunkOffset begin_offset,
+                                                 const ChunkOffset end_offset) {
   auto chunk_offsets_by_chunk_id = ChunkOffsetsByChunkID{};
 
-  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < pos_list.size(); ++chunk_offset) {
+  const auto range_end = std::min(static_cast<size_t>(end_offset), pos_list.size());
+  for (auto chunk_offset = begin_offset; chunk_offset < range_end; ++chunk_offset) {
     const auto row_id = pos_list[chunk_offset];
     if (row_id.is_null()) continue;
 
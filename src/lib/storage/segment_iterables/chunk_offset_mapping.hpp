@@ -25,6 +25,10 @@ using ChunkOffsetsList = std::vector<ChunkOffsetMapping>;
 using ChunkOffsetsIterator = ChunkOffsetsList::const_iterator;
 using ChunkOffsetsByChunkID = std::unordered_map<ChunkID, ChunkOffsetsList>;
 
-ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list);
+/**
+ * Splits the positions [begin_offset, end_offset) of the pos_list by the chunk they reference
+ */
+ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list, const ChunkOffset begin_offset = 0,
+                                                 const ChunkOffset end_offset = INVALID_CHUNK_OFFSET);
 
 }  // namespace opossum
@@ -191,6 +191,95 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
+Table::RowReservation Table::reserve_rows(const ChunkOffset row_count) {
+  DebugAssert(row_count > 0, "Expected at least one row to reserve");
+
+  // Fast path: Reserve the rows in the current chunk without locking
+  if (const auto insert_chunk = std::atomic_load(&_insert_chunk); insert_chunk && insert_chunk->chunk->is_mutable()) {
+    const auto [begin, reserved_row_count] = insert_chunk->chunk->reserve_rows(row_count, _max_chunk_size);
+    if (reserved_row_count > 0) {
+      return {insert_chunk->chunk_id, insert_chunk->chunk, begin, reserved_row_count, false};
+    }
+  }
+
+  // Slow path: The chunk is full, was compressed, or chunks were appended by someone else (e.g., COPY). Another Insert
+  // might have appended a new chunk in the meantime, so the last chunk is checked first.
+  auto scoped_lock = acquire_append_mutex();
+
+  auto appended_chunk = false;
+  while (true) {
+    if (!_chunks.empty() && _chunks.back()->is_mutable()) {
+      const auto chunk_id = ChunkID{chunk_count() - 1};
+      const auto& chunk = _chunks.back();
+
+      const auto [begin, reserved_row_count] = chunk->reserve_rows(row_count, _max_chunk_size);
+      if (reserved_row_count > 0) {
+        const auto insert_chunk = std::atomic_load(&_insert_chunk);
+        if (!insert_chunk || insert_chunk->chunk != chunk) {
+          std::atomic_store(&_insert_chunk, std::make_shared<const InsertChunk>(InsertChunk{chunk_id, chunk}));
+        }
+
+        return {chunk_id, chunk, begin, reserved_row_count, appended_chunk};
+      }
+    }
+
+    if (!_prepared_mutable_chunk) {
+      scoped_lock.unlock();
+      prepare_mutable_chunk();
+      scoped_lock.lock();
+      continue;
+    }
+
+    append_chunk(_prepared_mutable_chunk);
+    _prepared_mutable_chunk = nullptr;
+    appended_chunk = true;
+  }
+}
+
+void Table::prepare_mutable_chunk() {
+  {
+    auto scoped_lock = acquire_append_mutex();
+    if (_prepared_mutable_chunk) return;
+  }
+
+  // Tables with unbounded chunks would pre-allocate way too much memory
+  const auto capacity = _max_chunk_size != Chunk::MAX_SIZE ? _max_chunk_size : ChunkOffset{0};
+
+  Segments segments;
+  for (const auto& column_definition : _column_definitions) {
+    resolve_data_type(column_definition.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto segment = std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable);
+      segment->values().reserve(capacity);
+      if (column_definition.nullable) segment->null_values().reserve(capacity);
+      segments.push_back(segment);
+    });
+  }
+
+  auto mvcc_data = std::shared_ptr<MvccData>{};
+  if (_use_mvcc == UseMvcc::Yes) {
+    mvcc_data = std::make_shared<MvccData>(0);
+    mvcc_data->tids.reserve(capacity);
+    mvcc_data->begin_cids.reserve(capacity);
+    mvcc_data->end_cids.reserve(capacity);
+  }
+
+  const auto chunk = std::make_shared<Chunk>(segments, mvcc_data);
+
+  auto scoped_lock = acquire_append_mutex();
+  if (!_prepared_mutable_chunk) _prepared_mutable_chunk = chunk;
+}
+
+CommitID Table::last_modification_commit_id() const { return _last_modification_commit_id; }
+
+void Table::raise_last_modification_commit_id(const CommitID commit_id) {
+  auto current_commit_id = _last_modification_commit_id.load();
+  while (current_commit_id < commit_id &&
+         !_last_modification_commit_id.compare_exchange_weak(current_commit_id, commit_id)) {
+  }
+}
+
 std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 
 size_t Table::estimate_memory_usage() const {
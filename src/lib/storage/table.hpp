@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -140,6 +141,49 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
+  /**
+   * @defgroup Reserving rows for Inserts
+   * @{
+   */
+
+  struct RowReservation {
+    ChunkID chunk_id;
+    std::shared_ptr<Chunk> chunk;
+    ChunkOffset begin;
+    ChunkOffset row_count;
+
+    // Whether the chunk was appended for this reservation. The caller should then prepare the next one.
+    bool appended_chunk;
+  };
+
+  /**
+   * Reserves up to `row_count` rows at the end of the table. Fewer rows are reserved if the last chunk runs full, so an
+   * Insert calls this until all of its rows are reserved. The MVCC data and segments are not grown, see Insert.
+   *
+   * The rows are reserved in the last chunk with an atomic counter (see Chunk::reserve_rows()), so that concurrent
+   * Inserts do not serialize on the append mutex. It is only acquired for appending a new chunk once the last one is
+   * full. That chunk is created by prepare_mutable_chunk() beforehand if possible, so that allocating its segments
+   * does not happen while the mutex is held.
+   */
+  RowReservation reserve_rows(const ChunkOffset row_count);
+
+  /**
+   * Creates the mutable chunk that reserve_rows() appends next, unless it exists already. Its segments and MVCC data
+   * are pre-allocated for max_chunk_size() rows (unless the table uses Chunk::MAX_SIZE), so that Inserts do not need
+   * to reallocate them while growing. Meant to be called in the background.
+   */
+  void prepare_mutable_chunk();
+
+  /** @} */
+
+  /**
+   * The CommitID of the latest committed Insert or Delete (and thus Update) on this table. It is raised before the
+   * CommitID becomes visible to new transactions, so it allows detecting whether a result computed for an older
+   * snapshot is still valid (see SQLResultCache).
+   */
+  CommitID last_modification_commit_id() const;
+  void raise_last_modification_commit_id(const CommitID commit_id);
+
   void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
 
   std::shared_ptr<TableStatistics> table_statistics() { return _table_statistics; }
@@ -171,6 +215,18 @@ class Table : private Noncopyable {
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+
+  // The last chunk while Inserts reserve rows in it, see reserve_rows(). Accessed with std::atomic_load() and
+  // std::atomic_store(), so that it can be read without acquiring the append mutex.
+  struct InsertChunk {
+    ChunkID chunk_id;
+    std::shared_ptr<Chunk> chunk;
+  };
+  std::shared_ptr<const InsertChunk> _insert_chunk;
+
+  // Guarded by the append mutex
+  std::shared_ptr<Chunk> _prepared_mutable_chunk;
   std::vector<IndexInfo> _indexes;
+  std::atomic<CommitID> _last_modification_commit_id{0};
 };
 }  // namespace opossum
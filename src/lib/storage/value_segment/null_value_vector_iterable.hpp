@@ -30,6 +30,16 @@ class NullValueVectorIterable : public PointAccessibleSegmentIterable<NullValueV
     functor(begin, end);
   }
 
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    auto begin = Iterator{_null_values.cbegin(), _null_values.cbegin() + begin_offset};
+    auto end = Iterator{_null_values.cbegin(), _null_values.cbegin() + end_offset};
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _null_values.size(); }
+
  private:
   const pmr_concurrent_vector<bool>& _null_values;
 
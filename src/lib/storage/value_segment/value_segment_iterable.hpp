@@ -40,6 +40,25 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
     }
   }
 
+  // The iterators are created at begin_offset right away
+  template <typename Functor>
+  void _on_with_range_iterators(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const Functor& functor) const {
+    const auto values_begin = _segment.values().cbegin();
+
+    if (_segment.is_nullable()) {
+      const auto null_values_begin = _segment.null_values().cbegin();
+      auto begin = Iterator{values_begin, values_begin + begin_offset, null_values_begin + begin_offset};
+      auto end = Iterator{values_begin, values_begin + end_offset, null_values_begin + end_offset};
+      functor(begin, end);
+      return;
+    }
+
+    auto begin = NonNullIterator{values_begin, values_begin + begin_offset};
+    auto end = NonNullIterator{values_begin, values_begin + end_offset};
+    functor(begin, end);
+  }
+
   size_t _on_size() const { return _segment.size(); }
 
  private:
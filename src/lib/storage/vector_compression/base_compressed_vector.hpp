@@ -87,6 +87,12 @@ class CompressedVector : public BaseCompressedVector {
    */
   auto end() const { return _self().on_end(); }
   auto cend() const { return end(); }
+
+  /**
+   * @brief Returns an iterator to the element at index without decoding the elements before it
+   * @return a constant input iterator returning uint32_t
+   */
+  auto iterator_at(const size_t index) const { return _self().on_iterator_at(index); }
   /**@}*/
 
  public:
@@ -1,5 +1,7 @@
 #include "simd_bp128_iterator.hpp"
 
+#include <numeric>
+
 namespace opossum {
 
 SimdBp128Iterator::SimdBp128Iterator(const pmr_vector<uint128_t>* data, size_t size, size_t absolute_index)
@@ -9,8 +11,15 @@ SimdBp128Iterator::SimdBp128Iterator(const pmr_vector<uint128_t>* data, size_t s
       _absolute_index{absolute_index},
       _current_meta_block{std::make_unique<std::array<uint32_t, Packing::meta_block_size>>()},
       _current_meta_block_index{0u} {
-  if (data) {
+  if (data && absolute_index < size) {
+    // Only the meta infos of the preceding meta blocks are read to find the meta block of absolute_index
+    for (auto meta_block_index = size_t{0}; meta_block_index < absolute_index / Packing::meta_block_size;
+         ++meta_block_index) {
+      _skip_meta_block();
+    }
+
     _unpack_next_meta_block();
+    _current_meta_block_index = absolute_index % Packing::meta_block_size;
   }
 }
 
@@ -32,6 +41,11 @@ void SimdBp128Iterator::_unpack_next_meta_block() {
   _current_meta_block_index = 0u;
 }
 
+void SimdBp128Iterator::_skip_meta_block() {
+  _read_meta_info();
+  _data_index += std::accumulate(_current_meta_info.cbegin(), _current_meta_info.cend(), size_t{0});
+}
+
 void SimdBp128Iterator::_read_meta_info() {
   Packing::read_meta_info(_data->data() + _data_index++, _current_meta_info.data());
 }
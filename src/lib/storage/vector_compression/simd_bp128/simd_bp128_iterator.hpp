@@ -41,6 +41,7 @@ class SimdBp128Iterator : public BaseCompressedVectorIterator<SimdBp128Iterator>
 
  private:
   void _unpack_next_meta_block();
+  void _skip_meta_block();
 
   void _read_meta_info();
   void _unpack_block(uint8_t meta_info_index);
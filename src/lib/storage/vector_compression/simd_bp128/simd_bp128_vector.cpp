@@ -21,6 +21,10 @@ SimdBp128Iterator SimdBp128Vector::on_begin() const { return SimdBp128Iterator{&
 
 SimdBp128Iterator SimdBp128Vector::on_end() const { return SimdBp128Iterator{nullptr, _size, _size}; }
 
+SimdBp128Iterator SimdBp128Vector::on_iterator_at(const size_t index) const {
+  return SimdBp128Iterator{&_data, _size, index};
+}
+
 std::unique_ptr<const BaseCompressedVector> SimdBp128Vector::on_copy_using_allocator(
     const PolymorphicAllocator<size_t>& alloc) const {
   auto data_copy = pmr_vector<uint128_t>{_data, alloc};
@@ -35,6 +35,7 @@ class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
 
   SimdBp128Iterator on_begin() const;
   SimdBp128Iterator on_end() const;
+  SimdBp128Iterator on_iterator_at(const size_t index) const;
 
   std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
 
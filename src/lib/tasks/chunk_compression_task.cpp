@@ -16,8 +16,12 @@ namespace opossum {
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
     : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const ChunkEncodingSpec& chunk_encoding_spec, SchedulePriority priority)
+    : AbstractTask{priority},
+      _table_name{table_name},
+      _chunk_ids{chunk_ids},
+      _chunk_encoding_spec{chunk_encoding_spec} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
@@ -29,14 +33,19 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
-    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    if (_chunk_encoding_spec.empty()) {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), _chunk_encoding_spec);
+    }
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<const Chunk>& chunk,
+                                              const uint32_t max_chunk_size) {
   if (chunk->size() != max_chunk_size) return false;
 
   auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -33,21 +34,25 @@ class Chunk;
 class ChunkCompressionTask : public AbstractTask {
  public:
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
 
- protected:
-  void _on_execute() override;
+  // Without a ChunkEncodingSpec, the chunks are encoded using the default SegmentEncodingSpec
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const ChunkEncodingSpec& chunk_encoding_spec = {},
+                                SchedulePriority priority = SchedulePriority::Default);
 
- private:
   /**
    * @brief Checks if a chunks is completed
    *
    * See class comment for further explanation
    */
-  bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<const Chunk>& chunk, const uint32_t max_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const ChunkEncodingSpec _chunk_encoding_spec;
 };
 }  // namespace opossum
@@ -2,6 +2,8 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <regex>
+
 #include "sql/sql_pipeline_builder.hpp"
 
 namespace opossum {
@@ -9,11 +11,31 @@ namespace opossum {
 void CreatePipelineTask::_on_execute() {
   auto result = std::make_unique<CreatePipelineResult>();
 
+  if (_allow_server_commands) {
+    auto copy_to_query = std::string{};
+    result->copy = _parse_copy_command(copy_to_query);
+
+    if (result->copy && result->copy->from_stdin) return _promise.set_value(std::move(result));
+    if (result->copy) {
+      try {
+        result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{copy_to_query}.create_pipeline());
+      } catch (const std::exception& exception) {
+        return _promise.set_exception(boost::current_exception());
+      }
+      return _promise.set_value(std::move(result));
+    }
+  }
+
   try {
-    result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
+    // Simple queries (which are the ones that allow server commands) are auto-parameterized, so that recurring queries
+    // only differing in their literals reuse the cached plans. The queries of the extended protocol bring their own
+    // parameters.
+    auto builder = SQLPipelineBuilder{_sql};
+    if (_allow_server_commands) builder.enable_auto_parameterization();
+    result->sql_pipeline = std::make_shared<SQLPipeline>(builder.create_pipeline());
   } catch (const std::exception& exception) {
     // Try LOAD file_name table_name
-    if (_allow_load_table && _is_load_table()) {
+    if (_allow_server_commands && _is_load_table()) {
       result->load_table = std::make_pair(_file_name, _table_name);
     } else {
       // Setting the exception this way ensures that the details are preserved in the futures
@@ -46,4 +68,44 @@ bool CreatePipelineTask::_is_load_table() {
   return true;
 }
 
+std::optional<CopyCommand> CreatePipelineTask::_parse_copy_command(std::string& copy_to_query) const {
+  if (!boost::istarts_with(boost::trim_left_copy(_sql), "copy")) return std::nullopt;
+
+  // COPY <table> FROM STDIN or COPY <table or (query)> TO STDOUT, optionally followed by the format as
+  // [WITH] (FORMAT <format>) or as [WITH] <format>. Last character is always a \0-byte.
+  static const auto copy_regex = std::regex{
+      R"(\s*COPY\s+(\w+|\((.*)\))\s+(FROM\s+STDIN|TO\s+STDOUT)(?:\s+WITH)?)"
+      R"((?:\s*\(\s*FORMAT\s+(\w+)\s*\)|\s+(\w+))?\s*;?\s*\0?)",
+      std::regex::icase};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(_sql, match, copy_regex)) return std::nullopt;
+
+  auto copy_command = CopyCommand{};
+  copy_command.from_stdin = boost::istarts_with(match.str(3), "from");
+
+  const auto format = boost::to_lower_copy(match[4].matched ? match.str(4) : match.str(5));
+  if (format.empty() || format == "text") {
+    copy_command.format = CopyFormat::Text;
+  } else if (format == "csv") {
+    copy_command.format = CopyFormat::Csv;
+  } else if (format == "binary") {
+    copy_command.format = CopyFormat::Binary;
+  } else {
+    return std::nullopt;
+  }
+
+  if (match[2].matched) {
+    // Queries can only be copied to the client
+    if (copy_command.from_stdin) return std::nullopt;
+    copy_to_query = match.str(2);
+  } else if (copy_command.from_stdin) {
+    copy_command.table_name = match.str(1);
+  } else {
+    copy_to_query = "SELECT * FROM " + match.str(1);
+  }
+
+  return copy_command;
+}
+
 }  // namespace opossum
@@ -3,14 +3,26 @@
 #include <boost/thread/future.hpp>
 
 #include "abstract_server_task.hpp"
+#include "server/types.hpp"
 
 namespace opossum {
 
 class SQLPipeline;
 
+struct CopyCommand {
+  // True for COPY <table> FROM STDIN, false for COPY <table or (query)> TO STDOUT
+  bool from_stdin;
+
+  // Only set for COPY ... FROM STDIN. For COPY ... TO STDOUT, the sql_pipeline of the result selects the data.
+  std::string table_name;
+
+  CopyFormat format;
+};
+
 struct CreatePipelineResult {
   std::shared_ptr<SQLPipeline> sql_pipeline;
   std::optional<std::pair<std::string, std::string>> load_table;
+  std::optional<CopyCommand> copy;
 };
 
 // This task is used to parse an SQL string from a client and wrap it in an SQLPipeline. It is a separate task and not
@@ -18,8 +30,8 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_server_commands = false)
+      : _sql(sql), _allow_server_commands(allow_server_commands) {}
 
  protected:
   void _on_execute() override;
@@ -29,8 +41,14 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   // interpret it as a LOAD <file-name> <table-name> command. If this doesn't work, we pass on the parse error.
   bool _is_load_table();
 
+  // COPY <table> FROM STDIN and COPY <table or (query)> TO STDOUT are not supported by the SQL parser, so they are
+  // detected here. The data is then transferred using the COPY sub-protocol of the session. Returns std::nullopt if
+  // the SQL string is not a COPY command, for COPY ... TO STDOUT, the query is written to copy_to_query.
+  std::optional<CopyCommand> _parse_copy_command(std::string& copy_to_query) const;
+
   const std::string _sql;
-  const bool _allow_load_table;
+  // LOAD and COPY are only allowed in the simple query protocol
+  const bool _allow_server_commands;
 
   std::string _file_name;
   std::string _table_name;
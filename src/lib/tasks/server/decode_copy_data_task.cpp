@@ -0,0 +1,20 @@
+#include "decode_copy_data_task.hpp"
+
+#include "server/copy_decoder.hpp"
+
+namespace opossum {
+
+void DecodeCopyDataTask::_on_execute() {
+  try {
+    if (_is_last) {
+      _decoder->finish();
+    } else {
+      _decoder->decode();
+    }
+    _promise.set_value(_decoder->row_count());
+  } catch (const std::exception& exception) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "abstract_server_task.hpp"
+
+namespace opossum {
+
+class CopyDecoder;
+
+// This task is used to decode the data of a COPY ... FROM STDIN command that the session has collected in the decoder.
+// If is_last is set, the decoder is finished, i.e., the last chunk is appended to the table. Returns the number of rows
+// decoded so far.
+class DecodeCopyDataTask : public AbstractServerTask<uint64_t> {
+ public:
+  DecodeCopyDataTask(std::shared_ptr<CopyDecoder> decoder, const bool is_last)
+      : _decoder(std::move(decoder)), _is_last(is_last) {}
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<CopyDecoder> _decoder;
+  const bool _is_last;
+};
+
+}  // namespace opossum
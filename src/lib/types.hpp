@@ -198,6 +198,7 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 enum class CleanupTemporaries : bool { Yes = true, No = false };
+enum class AutoParameterize : bool { Yes = true, No = false };
 
 class Noncopyable {
  protected:
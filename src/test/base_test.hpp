@@ -9,6 +9,7 @@
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "storage/chunk_encoding_manager.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/numa_placement_manager.hpp"
 #include "storage/segment_encoding_utils.hpp"
@@ -61,6 +62,9 @@ class BaseTestWithParam
   }
 
   ~BaseTestWithParam() {
+    // Stop encoding chunks in the background before the scheduler and the tables are reset
+    ChunkEncodingManager::get().pause();
+
     // Reset scheduler first so that all tasks are done before we kill the StorageManager
     CurrentScheduler::set(nullptr);
 
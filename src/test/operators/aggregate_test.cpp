@@ -588,4 +588,58 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, HighCardinalityGroupByOverMultiplePreAggregationJobs) {
+  // Every group occurs once in each of the four pre-aggregation jobs, so that all groups have to be merged
+  const auto group_count = static_cast<int32_t>(Aggregate::ROWS_PER_PRE_AGGREGATION_JOB);
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}},
+                                       TableType::Data, 8'192);
+  for (auto row = int32_t{0}; row < 4 * group_count; ++row) {
+    table->append({row % group_count, row});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                             {ColumnID{1}, AggregateFunction::Min},
+                                             {ColumnID{1}, AggregateFunction::Max},
+                                             {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto output = aggregate->get_output();
+  ASSERT_EQ(output->row_count(), static_cast<uint64_t>(group_count));
+
+  const auto& chunk = *output->get_chunk(ChunkID{0});
+  const auto values = [&](const ColumnID column_id, auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    return std::static_pointer_cast<const ValueSegment<ColumnDataType>>(chunk.get_segment(column_id))->values();
+  };
+  const auto a_values = values(ColumnID{0}, hana::type_c<int32_t>);
+  const auto sum_values = values(ColumnID{1}, hana::type_c<int64_t>);
+  const auto min_values = values(ColumnID{2}, hana::type_c<int32_t>);
+  const auto max_values = values(ColumnID{3}, hana::type_c<int32_t>);
+  const auto count_values = values(ColumnID{4}, hana::type_c<int64_t>);
+
+  auto seen_groups = std::vector<bool>(group_count);
+  for (auto row = size_t{0}; row < output->row_count(); ++row) {
+    const auto a = a_values[row];
+    ASSERT_FALSE(seen_groups[a]);
+    seen_groups[a] = true;
+
+    EXPECT_EQ(sum_values[row], 4 * int64_t{a} + 6 * int64_t{group_count});
+    EXPECT_EQ(min_values[row], a);
+    EXPECT_EQ(max_values[row], a + 3 * group_count);
+    EXPECT_EQ(count_values[row], 4);
+  }
+
+  // Grouping without aggregates (i.e., DISTINCT) is merged the same way
+  auto distinct = std::make_shared<Aggregate>(table_wrapper, std::vector<AggregateColumnDefinition>{},
+                                              std::vector<ColumnID>{ColumnID{0}});
+  distinct->execute();
+  EXPECT_EQ(distinct->get_output()->row_count(), static_cast<uint64_t>(group_count));
+}
+
 }  // namespace opossum
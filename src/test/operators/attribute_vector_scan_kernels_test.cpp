@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "constant_mappings.hpp"
+#include "operators/table_scan/attribute_vector_scan_kernels.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AttributeVectorScanKernelsTest : public BaseTestWithParam<VectorCompressionType> {
+ protected:
+  // Not a multiple of the bitmask or SimdBp128 meta block sizes, so that the remaining values are scanned, too
+  static constexpr auto size = size_t{5'000};
+
+  pmr_vector<uint32_t> generate_value_ids(const uint32_t max_value_id) {
+    auto value_ids = pmr_vector<uint32_t>(size);
+    for (auto index = size_t{0}; index < size; ++index) {
+      value_ids[index] = static_cast<uint32_t>((index * 7'919) % (max_value_id + 1));
+    }
+    return value_ids;
+  }
+
+  // Compares the kernel with a straightforward loop
+  void check_range(const pmr_vector<uint32_t>& value_ids, const uint32_t max_value_id, const ValueID begin_value_id,
+                   const ValueID end_value_id, const std::optional<ValueID>& excluded_value_id,
+                   const ChunkOffset begin_offset = ChunkOffset{0}, const ChunkOffset end_offset = ChunkOffset{size}) {
+    const auto vector = compress_vector(value_ids, GetParam(), {}, {max_value_id});
+
+    auto expected_matches = PosList{};
+    for (auto index = size_t{begin_offset}; index < end_offset; ++index) {
+      const auto value_id = value_ids[index];
+      if (value_id >= begin_value_id && value_id < end_value_id &&
+          (!excluded_value_id || value_id != *excluded_value_id)) {
+        expected_matches.emplace_back(RowID{ChunkID{3}, static_cast<ChunkOffset>(index)});
+      }
+    }
+
+    auto matches = PosList{};
+    scan_value_id_range(*vector, begin_offset, end_offset, begin_value_id, end_value_id, excluded_value_id,
+                        ChunkID{3}, matches);
+
+    EXPECT_EQ(matches, expected_matches) << "Range [" << begin_value_id << ", " << end_value_id << ") of max "
+                                         << max_value_id << " at [" << begin_offset << ", " << end_offset << ")";
+  }
+};
+
+auto attribute_vector_scan_kernels_test_formatter = [](const ::testing::TestParamInfo<VectorCompressionType> info) {
+  auto string = vector_compression_type_to_string.left.at(info.param);
+  string.erase(std::remove_if(string.begin(), string.end(), [](char c) { return !std::isalnum(c); }), string.end());
+  return string;
+};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, AttributeVectorScanKernelsTest,
+                        ::testing::Values(VectorCompressionType::SimdBp128,
+                                          VectorCompressionType::FixedSizeByteAligned),
+                        attribute_vector_scan_kernels_test_formatter);
+
+TEST_P(AttributeVectorScanKernelsTest, Ranges) {
+  // Maximum value ids that require one, two, and four bytes with FixedSizeByteAligned
+  for (const auto max_value_id : {uint32_t{200}, uint32_t{60'000}, uint32_t{100'000}}) {
+    const auto value_ids = generate_value_ids(max_value_id);
+    const auto max = ValueID{max_value_id};
+    const auto middle = ValueID{max_value_id / 2};
+
+    // Equals
+    check_range(value_ids, max_value_id, middle, ValueID{middle + 1}, std::nullopt);
+    // LessThan, GreaterThanEquals
+    check_range(value_ids, max_value_id, ValueID{0}, middle, std::nullopt);
+    check_range(value_ids, max_value_id, middle, max, std::nullopt);
+    // NotEquals, excluding the largest value id as NULL
+    check_range(value_ids, max_value_id, ValueID{0}, max, middle);
+    // Excluded value id outside of the range
+    check_range(value_ids, max_value_id, ValueID{0}, middle, ValueID{middle + 1});
+    // Empty and full ranges
+    check_range(value_ids, max_value_id, middle, middle, std::nullopt);
+    check_range(value_ids, max_value_id, ValueID{0}, max, std::nullopt);
+  }
+}
+
+TEST_P(AttributeVectorScanKernelsTest, Subranges) {
+  const auto max_value_id = uint32_t{200};
+  const auto value_ids = generate_value_ids(max_value_id);
+
+  // Ranges of positions within one block, across blocks, and up to the end of the vector
+  for (const auto& [begin_offset, end_offset] : std::vector<std::pair<ChunkOffset, ChunkOffset>>{
+           {0, 0}, {1, 63}, {100, 200}, {2'000, 2'100}, {2'048, 4'096}, {3'000, size}}) {
+    check_range(value_ids, max_value_id, ValueID{10}, ValueID{150}, ValueID{20}, begin_offset, end_offset);
+    check_range(value_ids, max_value_id, ValueID{0}, ValueID{max_value_id}, std::nullopt, begin_offset, end_offset);
+  }
+}
+
+TEST_P(AttributeVectorScanKernelsTest, RangePerBlock) {
+  const auto value_ids = generate_value_ids(1'000);
+  const auto vector = compress_vector(value_ids, GetParam(), {}, {1'000u});
+
+  // Block 0 is skipped, all values of block 1 match, and block 2 matches a subrange minus one value
+  const auto range_for_block = [](const size_t block_index) -> std::optional<CompressedVectorValueRange> {
+    if (block_index == 0) return std::nullopt;
+    if (block_index == 1) return CompressedVectorValueRange{0, 1'000, std::nullopt};
+    return CompressedVectorValueRange{100, 500, 300};
+  };
+
+  auto expected_matches = PosList{};
+  for (auto index = size_t{1'000}; index < size; ++index) {
+    const auto block_index = index / COMPRESSED_VECTOR_SCAN_BLOCK_SIZE;
+    const auto value_id = value_ids[index];
+    if (block_index == 1 || (block_index == 2 && value_id >= 100 && value_id <= 500 && value_id != 300)) {
+      expected_matches.emplace_back(RowID{ChunkID{3}, static_cast<ChunkOffset>(index)});
+    }
+  }
+
+  auto matches = PosList{};
+  scan_compressed_vector(*vector, ChunkOffset{1'000}, ChunkOffset{size}, range_for_block, ChunkID{3}, matches);
+  EXPECT_EQ(matches, expected_matches);
+}
+
+TEST_P(AttributeVectorScanKernelsTest, AppendsToMatches) {
+  const auto value_ids = pmr_vector<uint32_t>(100, 1u);
+  const auto vector = compress_vector(value_ids, GetParam(), {}, {1u});
+
+  auto matches = PosList{RowID{ChunkID{0}, ChunkOffset{0}}};
+  scan_value_id_range(*vector, ChunkOffset{0}, ChunkOffset{100}, ValueID{1}, ValueID{2}, std::nullopt, ChunkID{1},
+                      matches);
+
+  ASSERT_EQ(matches.size(), 101u);
+  EXPECT_EQ(matches.front(), (RowID{ChunkID{0}, ChunkOffset{0}}));
+  EXPECT_EQ(matches.back(), (RowID{ChunkID{1}, ChunkOffset{99}}));
+}
+
+}  // namespace opossum
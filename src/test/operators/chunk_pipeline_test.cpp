@@ -0,0 +1,173 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/chunk_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsChunkPipelineTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(
+        load_table("src/test/tables/aggregateoperator/groupby_int_2gb_2agg/input.tbl", 2));
+    _table_wrapper->execute();
+
+    _table_wrapper_null = std::make_shared<TableWrapper>(
+        load_table("src/test/tables/aggregateoperator/groupby_string_1gb_1agg/input_null.tbl", 3));
+    _table_wrapper_null->execute();
+
+    _a = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "a");
+    _b = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "b");
+    _c = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "c");
+    _d = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "d");
+  }
+
+  // Executes the same operators as the pipeline one after another, as a reference
+  std::shared_ptr<const Table> execute_operators(const std::shared_ptr<AbstractOperator>& input,
+                                                 const std::vector<OperatorScanPredicate>& predicates,
+                                                 const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                                                 const std::vector<AggregateColumnDefinition>& aggregates,
+                                                 const std::vector<ColumnID>& groupby_column_ids) {
+    auto op = input;
+    for (const auto& predicate : predicates) {
+      op = std::make_shared<TableScan>(op, predicate);
+      op->execute();
+    }
+
+    if (!expressions.empty()) {
+      op = std::make_shared<Projection>(op, expressions);
+      op->execute();
+    }
+
+    if (!aggregates.empty() || !groupby_column_ids.empty()) {
+      op = std::make_shared<Aggregate>(op, aggregates, groupby_column_ids);
+      op->execute();
+    }
+
+    return op->get_output();
+  }
+
+  void test_pipeline(const std::shared_ptr<AbstractOperator>& input,
+                     const std::vector<OperatorScanPredicate>& predicates,
+                     const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                     const std::vector<AggregateColumnDefinition>& aggregates = {},
+                     const std::vector<ColumnID>& groupby_column_ids = {}) {
+    const auto pipeline = std::make_shared<ChunkPipeline>(input, predicates, expressions, aggregates,
+                                                          groupby_column_ids);
+    pipeline->execute();
+
+    const auto expected = execute_operators(input, predicates, expressions, aggregates, groupby_column_ids);
+    EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(), expected);
+  }
+
+ protected:
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_null;
+  std::shared_ptr<PQPColumnExpression> _a, _b, _c, _d;
+};
+
+TEST_F(OperatorsChunkPipelineTest, OperatorName) {
+  const auto pipeline = std::make_shared<ChunkPipeline>(_table_wrapper, std::vector<OperatorScanPredicate>{},
+                                                        expression_vector(_a));
+  EXPECT_EQ(pipeline->name(), "ChunkPipeline");
+}
+
+TEST_F(OperatorsChunkPipelineTest, ScanAndProjection) {
+  test_pipeline(_table_wrapper, {{ColumnID{2}, PredicateCondition::GreaterThan, 20}},
+                expression_vector(_a, add_(_c, 1), mul_(_b, _d)));
+}
+
+TEST_F(OperatorsChunkPipelineTest, MultipleScans) {
+  test_pipeline(_table_wrapper,
+                {{ColumnID{2}, PredicateCondition::GreaterThan, 20}, {ColumnID{3}, PredicateCondition::LessThan, 30.0}},
+                expression_vector(_c, _a));
+}
+
+TEST_F(OperatorsChunkPipelineTest, ScanWithoutMatches) {
+  test_pipeline(_table_wrapper, {{ColumnID{2}, PredicateCondition::LessThan, 0}}, expression_vector(_a));
+  test_pipeline(_table_wrapper, {{ColumnID{2}, PredicateCondition::LessThan, 0}}, {},
+                {{ColumnID{2}, AggregateFunction::Sum}, {std::nullopt, AggregateFunction::Count}});
+  test_pipeline(_table_wrapper, {{ColumnID{2}, PredicateCondition::LessThan, 0}}, {},
+                {{ColumnID{2}, AggregateFunction::Sum}}, {ColumnID{0}});
+}
+
+TEST_F(OperatorsChunkPipelineTest, AllAggregateFunctions) {
+  for (const auto function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum,
+                              AggregateFunction::Avg, AggregateFunction::Count, AggregateFunction::CountDistinct}) {
+    test_pipeline(_table_wrapper, {{ColumnID{2}, PredicateCondition::GreaterThan, 10}}, {},
+                  {{ColumnID{2}, function}, {ColumnID{3}, function}}, {ColumnID{0}, ColumnID{1}});
+  }
+}
+
+TEST_F(OperatorsChunkPipelineTest, ProjectionAndAggregate) {
+  test_pipeline(_table_wrapper, {{ColumnID{0}, PredicateCondition::NotEquals, 123}},
+                expression_vector(_a, add_(_c, _a)),
+                {{ColumnID{1}, AggregateFunction::Sum}, {std::nullopt, AggregateFunction::Count}}, {ColumnID{0}});
+}
+
+TEST_F(OperatorsChunkPipelineTest, AggregateWithoutGroupBy) {
+  test_pipeline(_table_wrapper, {{ColumnID{2}, PredicateCondition::GreaterThan, 10}}, {},
+                {{ColumnID{2}, AggregateFunction::Max}, {ColumnID{3}, AggregateFunction::Avg}});
+}
+
+TEST_F(OperatorsChunkPipelineTest, NullValues) {
+  test_pipeline(_table_wrapper_null, {{ColumnID{0}, PredicateCondition::NotEquals, std::string{"aa"}}}, {},
+                {{ColumnID{1}, AggregateFunction::Sum},
+                 {ColumnID{1}, AggregateFunction::Count},
+                 {ColumnID{0}, AggregateFunction::Min}},
+                {ColumnID{0}});
+  test_pipeline(_table_wrapper_null, {{ColumnID{1}, PredicateCondition::IsNull}}, {},
+                {{std::nullopt, AggregateFunction::Count}}, {ColumnID{0}});
+}
+
+TEST_F(OperatorsChunkPipelineTest, ThreeGroupByColumnsWithNullValues) {
+  // Three group-by columns do not fit into a fixed-size AggregateKey
+  const auto table_wrapper = std::make_shared<TableWrapper>(
+      load_table("src/test/tables/aggregateoperator/groupby_int_3gb_0agg/input_null.tbl", 2));
+  table_wrapper->execute();
+
+  test_pipeline(table_wrapper, {}, {}, {{std::nullopt, AggregateFunction::Count}},
+                {ColumnID{0}, ColumnID{2}, ColumnID{3}});
+  test_pipeline(table_wrapper, {{ColumnID{1}, PredicateCondition::IsNotNull}}, {},
+                {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{2}, ColumnID{3}, ColumnID{0}});
+}
+
+TEST_F(OperatorsChunkPipelineTest, EncodedSegments) {
+  const auto table = load_table("src/test/tables/aggregateoperator/groupby_int_2gb_2agg/input.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  test_pipeline(table_wrapper, {{ColumnID{2}, PredicateCondition::GreaterThan, 10}}, expression_vector(_a, add_(_c, 1)),
+                {{ColumnID{1}, AggregateFunction::Avg}}, {ColumnID{0}});
+}
+
+TEST_F(OperatorsChunkPipelineTest, WithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  test_pipeline(_table_wrapper, {{ColumnID{2}, PredicateCondition::GreaterThan, 10}}, {},
+                {{ColumnID{3}, AggregateFunction::Sum}}, {ColumnID{0}});
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+}  // namespace opossum
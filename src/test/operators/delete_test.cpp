@@ -1,6 +1,8 @@
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -245,4 +247,50 @@ TEST_F(OperatorsDeleteTest, DeleteOwnInsert) {
   }
 }
 
+TEST_F(OperatorsDeleteTest, ConcurrentDeleteAndValidate) {
+  // Validates running concurrently to Deletes store visibility summaries. None of them may hide a committed Delete
+  // from later transactions.
+  constexpr auto row_count = 200;
+
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 20, UseMvcc::Yes);
+  for (auto value = 0; value < row_count; ++value) {
+    table->append({value});
+  }
+  StorageManager::get().add_table("concurrent", table);
+
+  const auto get_table = std::make_shared<GetTable>("concurrent");
+  get_table->execute();
+
+  const auto validated_row_count = [&]() {
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  auto done = std::atomic_bool{false};
+  auto validate_thread = std::thread{[&]() {
+    while (!done) validated_row_count();
+  }};
+
+  for (auto value = 0; value < row_count; ++value) {
+    const auto context = TransactionManager::get().new_transaction_context();
+
+    const auto table_scan =
+        std::make_shared<TableScan>(get_table, OperatorScanPredicate{ColumnID{0}, PredicateCondition::Equals, value});
+    table_scan->execute();
+
+    const auto delete_op = std::make_shared<Delete>("concurrent", table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    context->commit();
+
+    EXPECT_EQ(validated_row_count(), static_cast<uint64_t>(row_count - value - 1));
+  }
+
+  done = true;
+  validate_thread.join();
+}
+
 }  // namespace opossum
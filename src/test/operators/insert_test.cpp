@@ -1,5 +1,7 @@
+#include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
@@ -259,4 +261,52 @@ TEST_F(OperatorsInsertTest, InsertSingleNullFromDummyProjection) {
   EXPECT_TRUE(variant_is_null(null_val));
 }
 
+TEST_F(OperatorsInsertTest, ConcurrentInserts) {
+  const auto table = load_table("src/test/tables/int.tbl", 4u);
+  StorageManager::get().add_table("target", table);
+  StorageManager::get().add_table("source", load_table("src/test/tables/10_ints.tbl", 3u));
+
+  constexpr auto thread_count = 8u;
+  constexpr auto inserts_per_thread = 10u;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0u; thread_idx < thread_count; ++thread_idx) {
+    threads.emplace_back([&]() {
+      for (auto insert_idx = 0u; insert_idx < inserts_per_thread; ++insert_idx) {
+        const auto get_table = std::make_shared<GetTable>("source");
+        get_table->execute();
+
+        const auto insert = std::make_shared<Insert>("target", get_table);
+        const auto context = TransactionManager::get().new_transaction_context();
+        insert->set_transaction_context(context);
+        insert->execute();
+        context->commit();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(table->row_count(), 3u + thread_count * inserts_per_thread * 10u);
+
+  // All rows are committed and each inserted value appears once per Insert
+  auto value_counts = std::map<int32_t, size_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_LE(chunk->size(), 4u);
+
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_NE(mvcc_data->begin_cids[chunk_offset], MvccData::MAX_COMMIT_ID);
+      EXPECT_EQ(mvcc_data->tids[chunk_offset], 0u);
+      ++value_counts[boost::get<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset])];
+    }
+  }
+
+  const auto source_table = load_table("src/test/tables/10_ints.tbl");
+  for (auto row_idx = size_t{0}; row_idx < source_table->row_count(); ++row_idx) {
+    const auto value = source_table->get_value<int32_t>(ColumnID{0}, row_idx);
+    EXPECT_GE(value_counts[value], thread_count * inserts_per_thread);
+  }
+}
+
 }  // namespace opossum
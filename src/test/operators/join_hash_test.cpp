@@ -1,10 +1,14 @@
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/blocked_bloom_filter.hpp"
 #include "operators/join_hash/hash_traits.hpp"
+#include "operators/join_hash/open_addressing_hash_table.hpp"
 #include "operators/table_wrapper.hpp"
 #include "types.hpp"
 
@@ -124,4 +128,72 @@ TEST_F(JoinHashTest, OperatorName) {
   EXPECT_EQ(join->name(), "JoinHash");
 }
 
+TEST_F(JoinHashTest, OpenAddressingHashTable) {
+  auto hash_table = OpenAddressingHashTable<int32_t>{6};
+
+  // 1 and 2 share a hash, so that the table has to compare the values
+  hash_table.insert(1, 7, RowID{ChunkID{0}, ChunkOffset{0}});
+  hash_table.insert(2, 7, RowID{ChunkID{0}, ChunkOffset{1}});
+  hash_table.insert(1, 7, RowID{ChunkID{1}, ChunkOffset{0}});
+  hash_table.insert(3, 8, RowID{ChunkID{1}, ChunkOffset{1}});
+  hash_table.insert(1, 7, RowID{ChunkID{2}, ChunkOffset{0}});
+
+  EXPECT_EQ(hash_table.row_count(), 5u);
+  EXPECT_EQ(hash_table.distinct_value_count(), 3u);
+
+  EXPECT_TRUE(hash_table.contains(2, 7));
+  EXPECT_TRUE(hash_table.contains(3, 8));
+  EXPECT_FALSE(hash_table.contains(3, 7));
+  EXPECT_FALSE(hash_table.contains(4, 9));
+
+  auto matches = std::vector<RowID>{};
+  EXPECT_TRUE(hash_table.for_each_match(1, 7, [&](const RowID& row_id) { matches.emplace_back(row_id); }));
+  EXPECT_EQ(matches, std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{0}},
+                                         RowID{ChunkID{2}, ChunkOffset{0}}}));
+
+  matches.clear();
+  EXPECT_FALSE(hash_table.for_each_match(4, 7, [&](const RowID& row_id) { matches.emplace_back(row_id); }));
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(JoinHashTest, OpenAddressingHashTableWithCollidingStrings) {
+  // All values share the same hash and thus end up in one run of slots
+  auto hash_table = OpenAddressingHashTable<std::string>{100};
+  for (auto index = 0u; index < 100u; ++index) {
+    hash_table.insert("value" + std::to_string(index % 50), 42, RowID{ChunkID{0}, ChunkOffset{index}});
+  }
+
+  EXPECT_EQ(hash_table.distinct_value_count(), 50u);
+
+  auto matches = std::vector<RowID>{};
+  hash_table.for_each_match("value49", 42, [&](const RowID& row_id) { matches.emplace_back(row_id); });
+  EXPECT_EQ(matches, std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{49}}, RowID{ChunkID{0}, ChunkOffset{99}}}));
+  EXPECT_FALSE(hash_table.contains("value50", 42));
+}
+
+TEST_F(JoinHashTest, BlockedBloomFilter) {
+  auto bloom_filter = BlockedBloomFilter{1'000};
+  for (auto hash = uint32_t{0}; hash < 1'000; ++hash) {
+    bloom_filter.insert(hash * 7919);
+  }
+
+  // No false negatives
+  for (auto hash = uint32_t{0}; hash < 1'000; ++hash) {
+    EXPECT_TRUE(bloom_filter.may_contain(hash * 7919));
+  }
+
+  // Few false positives
+  auto false_positive_count = 0;
+  for (auto hash = uint32_t{1'000}; hash < 11'000; ++hash) {
+    if (bloom_filter.may_contain(hash * 7919)) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 1'000);
+}
+
+TEST_F(JoinHashTest, EmptyBlockedBloomFilter) {
+  const auto bloom_filter = BlockedBloomFilter{0};
+  EXPECT_FALSE(bloom_filter.may_contain(0));
+  EXPECT_FALSE(bloom_filter.may_contain(17));
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include <map>
 #include <memory>
 #include <numeric>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -8,14 +9,17 @@
 #include "gtest/gtest.h"
 
 #include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
 #include "operators/join_index.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -65,6 +69,10 @@ class JoinIndexTest : public BaseTest {
   }
 
   std::shared_ptr<TableWrapper> load_table_with_index(const std::string& filename, const size_t chunk_size) {
+    return std::make_shared<TableWrapper>(load_indexed_table(filename, chunk_size));
+  }
+
+  std::shared_ptr<Table> load_indexed_table(const std::string& filename, const size_t chunk_size) {
     auto table = load_table(filename, chunk_size);
 
     ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
@@ -79,7 +87,22 @@ class JoinIndexTest : public BaseTest {
       }
     }
 
-    return std::make_shared<TableWrapper>(table);
+    return table;
+  }
+
+  // int_float2 (see _table_wrapper_b) validated for a transaction that the first row is invisible for
+  std::shared_ptr<Validate> validate_int_float2_without_first_row() {
+    const auto table = load_indexed_table("src/test/tables/int_float2.tbl", 2);
+    table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->end_cids[0] = 1u;
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto transaction_context = std::make_shared<TransactionContext>(1u, 1u);
+    auto validate = std::make_shared<Validate>(table_wrapper);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate;
   }
 
   // builds and executes the given Join and checks correctness of the output
@@ -97,15 +120,37 @@ class JoinIndexTest : public BaseTest {
     join->execute();
 
     EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+
+    const auto& right_table = right->get_output();
+    const auto chunk_count = static_cast<size_t>(right_table->chunk_count());
+    auto chunks_with_index = size_t{0};
+    if (using_index) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto& chunk = *right_table->get_chunk(chunk_id);
+        if (right_table->type() == TableType::Data || references_single_chunk(chunk, column_ids.second)) {
+          ++chunks_with_index;
+        }
+      }
+    }
+
     const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join->performance_data());
-    if (using_index && right->get_output()->type() == TableType::Data) {
-      // We can't execute the index join on referencing tables
-      EXPECT_EQ(performance_data.chunks_scanned_with_index, static_cast<size_t>(right->get_output()->chunk_count()));
-      EXPECT_EQ(performance_data.chunks_scanned_without_index, 0);
-    } else {
-      EXPECT_EQ(performance_data.chunks_scanned_with_index, 0);
-      EXPECT_EQ(performance_data.chunks_scanned_without_index, static_cast<size_t>(right->get_output()->chunk_count()));
+    EXPECT_EQ(performance_data.chunks_scanned_with_index, chunks_with_index);
+    EXPECT_EQ(performance_data.chunks_scanned_without_index, chunk_count - chunks_with_index);
+  }
+
+  // The index join on a referencing table uses the index of the referenced chunk, which is only possible if the
+  // segment references each row of a single chunk at most once (e.g., in the output of a TableScan or Validate)
+  static bool references_single_chunk(const Chunk& chunk, const ColumnID column_id) {
+    const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty() || pos_list.front().chunk_id == INVALID_CHUNK_ID) return false;
+
+    auto referenced_chunk_offsets = std::set<ChunkOffset>{};
+    for (const auto& row_id : pos_list) {
+      if (row_id.chunk_id != pos_list.front().chunk_id) return false;
+      if (!referenced_chunk_offsets.emplace(row_id.chunk_offset).second) return false;
     }
+    return true;
   }
 
   std::shared_ptr<TableWrapper> _table_wrapper_a, _table_wrapper_a_no_index, _table_wrapper_b,
@@ -429,6 +474,27 @@ TYPED_TEST(JoinIndexTest, JoinLessThanOnDictAndDict) {
                          JoinMode::Inner, "src/test/tables/joinoperators/int_float_leq_dict.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, InnerJoinOnValidate) {
+  const auto validate_b = this->validate_int_float2_without_first_row();
+
+  this->test_join_output(this->_table_wrapper_a, validate_b, std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                         PredicateCondition::Equals, JoinMode::Inner,
+                         "src/test/tables/joinoperators/int_inner_join_validated.tbl", 1);
+}
+
+TYPED_TEST(JoinIndexTest, RightJoinOnValidate) {
+  const auto validate_b = this->validate_int_float2_without_first_row();
+
+  // Remove the only row of table a that matches int_float2's last row, which then has no join partner
+  auto scan_a = std::make_shared<TableScan>(this->_table_wrapper_a,
+                                            OperatorScanPredicate{ColumnID{0}, PredicateCondition::NotEquals, 123});
+  scan_a->execute();
+
+  this->test_join_output(scan_a, validate_b, std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                         PredicateCondition::Equals, JoinMode::Right,
+                         "src/test/tables/joinoperators/int_right_join_validated.tbl", 1);
+}
+
 TYPED_TEST(JoinIndexTest, JoinOnReferenceSegmentAndDict) {
   // scan that returns all rows
   auto scan_a = std::make_shared<TableScan>(
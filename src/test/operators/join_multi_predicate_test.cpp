@@ -0,0 +1,191 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/*
+This contains the tests for joins with secondary predicates, which are evaluated by the join operators themselves.
+The expected results are computed by joining on the primary predicate and scanning for the secondary ones.
+*/
+
+template <typename T>
+class JoinMultiPredicateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_left =
+        std::make_shared<TableWrapper>(load_table("src/test/tables/joinoperators/multi_predicate_left.tbl", 3));
+    _table_wrapper_right =
+        std::make_shared<TableWrapper>(load_table("src/test/tables/joinoperators/multi_predicate_right.tbl", 4));
+
+    auto table = load_table("src/test/tables/joinoperators/multi_predicate_right.tbl", 4);
+    ChunkEncoder::encode_all_chunks(table);
+    _table_wrapper_right_dict = std::make_shared<TableWrapper>(std::move(table));
+
+    _table_wrapper_left->execute();
+    _table_wrapper_right->execute();
+    _table_wrapper_right_dict->execute();
+  }
+
+  // Executes the join with the given predicates and compares it with the join on the primary predicate followed by
+  // a TableScan for each secondary predicate
+  void test_join_output(const std::shared_ptr<const AbstractOperator>& left,
+                        const std::shared_ptr<const AbstractOperator>& right, const OperatorJoinPredicate& primary,
+                        const std::vector<OperatorJoinPredicate>& secondary_predicates) {
+    auto join = std::make_shared<T>(left, right, JoinMode::Inner, primary.column_ids, primary.predicate_condition,
+                                    secondary_predicates);
+    join->execute();
+
+    std::shared_ptr<AbstractOperator> expected = std::make_shared<JoinNestedLoop>(
+        left, right, JoinMode::Inner, primary.column_ids, primary.predicate_condition);
+    expected->execute();
+
+    const auto left_column_count = left->get_output()->column_count();
+    for (const auto& secondary_predicate : secondary_predicates) {
+      const auto right_column_id = static_cast<ColumnID>(left_column_count + secondary_predicate.column_ids.second);
+      expected = std::make_shared<TableScan>(
+          expected, OperatorScanPredicate{secondary_predicate.column_ids.first,
+                                          secondary_predicate.predicate_condition, right_column_id});
+      expected->execute();
+    }
+
+    EXPECT_GT(expected->get_output()->row_count(), 0u);
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected->get_output());
+  }
+
+  // For join modes other than inner, whose results cannot be computed by scanning the primary join's output. Only
+  // JoinHash supports these modes with secondary predicates.
+  void test_join_output(const std::shared_ptr<const AbstractOperator>& left,
+                        const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                        const OperatorJoinPredicate& primary,
+                        const std::vector<OperatorJoinPredicate>& secondary_predicates, const std::string& file_name) {
+    if constexpr (std::is_same_v<T, JoinHash>) {
+      auto join = std::make_shared<T>(left, right, mode, primary.column_ids, primary.predicate_condition,
+                                      secondary_predicates);
+      join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), load_table(file_name));
+    } else {
+      EXPECT_THROW(std::make_shared<T>(left, right, mode, primary.column_ids, primary.predicate_condition,
+                                       secondary_predicates),
+                   std::logic_error);
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right, _table_wrapper_right_dict;
+};
+
+using JoinMultiPredicateTypes = ::testing::Types<JoinHash, JoinSortMerge>;
+TYPED_TEST_CASE(JoinMultiPredicateTest, JoinMultiPredicateTypes);
+
+TYPED_TEST(JoinMultiPredicateTest, TwoEqualsPredicates) {
+  this->test_join_output(this->_table_wrapper_left, this->_table_wrapper_right,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}});
+}
+
+TYPED_TEST(JoinMultiPredicateTest, EqualsAndRangePredicates) {
+  this->test_join_output(this->_table_wrapper_left, this->_table_wrapper_right,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThanEquals},
+                          {{ColumnID{2}, ColumnID{2}}, PredicateCondition::LessThan}});
+}
+
+TYPED_TEST(JoinMultiPredicateTest, NonEquiPrimaryPredicate) {
+  if constexpr (std::is_same_v<TypeParam, JoinSortMerge>) {
+    this->test_join_output(this->_table_wrapper_left, this->_table_wrapper_right,
+                           {{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan},
+                           {{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}});
+  }
+}
+
+TYPED_TEST(JoinMultiPredicateTest, ReferenceAndDictionaryInputs) {
+  auto scan = std::make_shared<TableScan>(this->_table_wrapper_left,
+                                          OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, 4});
+  scan->execute();
+
+  this->test_join_output(scan, this->_table_wrapper_right_dict,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{1}, ColumnID{1}}, PredicateCondition::NotEquals},
+                          {{ColumnID{2}, ColumnID{2}}, PredicateCondition::GreaterThan}});
+}
+
+TYPED_TEST(JoinMultiPredicateTest, SwappedInputs) {
+  // JoinHash builds the hash table on the smaller input, the right one, and flips the secondary predicates
+  auto scan = std::make_shared<TableScan>(this->_table_wrapper_right,
+                                          OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, 4});
+  scan->execute();
+
+  this->test_join_output(this->_table_wrapper_left, scan, {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThanEquals},
+                          {{ColumnID{2}, ColumnID{2}}, PredicateCondition::LessThan}});
+}
+
+TYPED_TEST(JoinMultiPredicateTest, LeftJoin) {
+  this->test_join_output(this->_table_wrapper_left, this->_table_wrapper_right, JoinMode::Left,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{2}, ColumnID{2}}, PredicateCondition::LessThan}},
+                         "src/test/tables/joinoperators/multi_predicate_left_join.tbl");
+}
+
+TYPED_TEST(JoinMultiPredicateTest, RightJoinWithLargerLeftInput) {
+  auto scan = std::make_shared<TableScan>(this->_table_wrapper_right,
+                                          OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, 4});
+  scan->execute();
+
+  this->test_join_output(this->_table_wrapper_left, scan, JoinMode::Right,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{2}, ColumnID{2}}, PredicateCondition::GreaterThan}},
+                         "src/test/tables/joinoperators/multi_predicate_right_join.tbl");
+}
+
+TYPED_TEST(JoinMultiPredicateTest, OuterJoin) {
+  // JoinHash does not support full outer joins at all, JoinSortMerge does not support them with secondary predicates
+  if constexpr (std::is_same_v<TypeParam, JoinSortMerge>) {
+    EXPECT_THROW(std::make_shared<JoinSortMerge>(
+                     this->_table_wrapper_left, this->_table_wrapper_right, JoinMode::Outer,
+                     ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                     std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}}),
+                 std::logic_error);
+  }
+}
+
+TYPED_TEST(JoinMultiPredicateTest, SemiJoin) {
+  this->test_join_output(this->_table_wrapper_left, this->_table_wrapper_right, JoinMode::Semi,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals},
+                          {{ColumnID{2}, ColumnID{2}}, PredicateCondition::LessThan}},
+                         "src/test/tables/joinoperators/multi_predicate_semi_join.tbl");
+}
+
+TYPED_TEST(JoinMultiPredicateTest, AntiJoin) {
+  this->test_join_output(this->_table_wrapper_left, this->_table_wrapper_right, JoinMode::Anti,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         {{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals},
+                          {{ColumnID{2}, ColumnID{2}}, PredicateCondition::LessThan}},
+                         "src/test/tables/joinoperators/multi_predicate_anti_join.tbl");
+}
+
+TYPED_TEST(JoinMultiPredicateTest, Description) {
+  auto join = std::make_shared<TypeParam>(
+      this->_table_wrapper_left, this->_table_wrapper_right, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::Equals,
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{2}}, PredicateCondition::LessThan}});
+
+  EXPECT_NE(join->description(DescriptionMode::SingleLine).find("a = a AND b < c"), std::string::npos);
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -13,6 +14,7 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -143,6 +145,108 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, MultipleColumnSortInOneOperator) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float2_sorted.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                       SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortInOneOperatorMixedOrder) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float2_sorted_mixed.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                       SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortWithStringsAndNulls) {
+  auto table = load_table("src/test/tables/string_int_float_with_null.tbl", 3);
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/string_int_float_with_null_sorted.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::DescendingNullsLast},
+                                        SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, SortOfMultipleRunsIsStable) {
+  // Create enough rows to have the keys sorted in several runs that need to be merged
+  const auto row_count = static_cast<int32_t>(Sort::ROWS_PER_SORT_RUN * 2 + 1'000);
+  const auto chunk_size = 50'000;
+
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+
+  for (auto chunk_begin = 0; chunk_begin < row_count; chunk_begin += chunk_size) {
+    auto values_a = pmr_concurrent_vector<int32_t>{};
+    auto values_b = pmr_concurrent_vector<int32_t>{};
+    for (auto row = chunk_begin; row < std::min(chunk_begin + chunk_size, row_count); ++row) {
+      values_a.push_back((row_count - row) % 1'000);
+      values_b.push_back(row);
+    }
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values_a)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(values_b))});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Ascending, chunk_size);
+  sort->execute();
+
+  const auto output = sort->get_output();
+  ASSERT_EQ(output->row_count(), static_cast<uint64_t>(row_count));
+
+  auto previous_a = std::numeric_limits<int32_t>::min();
+  auto previous_b = std::numeric_limits<int32_t>::min();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    const auto& values_a = std::static_pointer_cast<ValueSegment<int32_t>>(chunk->get_segment(ColumnID{0}))->values();
+    const auto& values_b = std::static_pointer_cast<ValueSegment<int32_t>>(chunk->get_segment(ColumnID{1}))->values();
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto a = values_a[chunk_offset];
+      const auto b = values_b[chunk_offset];
+      ASSERT_TRUE(a > previous_a || (a == previous_a && b > previous_b));
+      previous_a = a;
+      previous_b = b;
+    }
+  }
+}
+
+TEST_P(OperatorsSortTest, Description) {
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Descending},
+                                                        SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}});
+
+  EXPECT_EQ(sort->description(), "Sort {Column #1 Descending, Column #0 Ascending}");
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2);
 
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -10,6 +11,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "constant_mappings.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -17,6 +19,8 @@
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -669,4 +673,119 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(scan_c->predicate().value, AllParameterVariant{ParameterID{4}});
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnChunksLargerThanMorsel) {
+  // The first chunk is split into three morsels, the second one is scanned as a whole
+  const auto row_counts = std::vector<int32_t>{static_cast<int32_t>(TableScan::MORSEL_SIZE * 2 + 1'000), 1'000};
+
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::MAX_SIZE);
+
+  auto expected_less_than_count = uint64_t{0};
+  auto expected_between_count = uint64_t{0};
+  auto expected_null_count = uint64_t{0};
+  for (const auto row_count : row_counts) {
+    auto values_a = pmr_concurrent_vector<int32_t>{};
+    auto null_values_a = pmr_concurrent_vector<bool>{};
+    auto values_b = pmr_concurrent_vector<int32_t>{};
+    for (auto row = 0; row < row_count; ++row) {
+      values_a.push_back(row % 100);
+      null_values_a.push_back(row % 1'000 == 0);
+      values_b.push_back(row);
+
+      if (row % 1'000 == 0) {
+        ++expected_null_count;
+      } else if (row % 100 < 10) {
+        ++expected_less_than_count;
+        if (row % 100 >= 5) ++expected_between_count;
+      }
+    }
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values_a), std::move(null_values_a)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(values_b))});
+  }
+
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Matches have to be in the order of the input rows
+  const auto expect_ascending_rows = [](const std::shared_ptr<const Table>& result) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+      const auto segment = result->get_chunk(chunk_id)->get_segment(ColumnID{1});
+      const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+      EXPECT_TRUE(std::is_sorted(pos_list.begin(), pos_list.end()));
+    }
+  };
+
+  auto scan = std::make_shared<TableScan>(table_wrapper,
+                                          OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, 10});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), expected_less_than_count);
+  EXPECT_EQ(scan->get_output()->chunk_count(), 2u);
+  expect_ascending_rows(scan->get_output());
+
+  // The output of the first scan is a reference table with a chunk that is split into morsels as well
+  auto scan_on_references = std::make_shared<TableScan>(
+      scan, OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThanEquals, 5});
+  scan_on_references->execute();
+  EXPECT_EQ(scan_on_references->get_output()->row_count(), expected_between_count);
+  expect_ascending_rows(scan_on_references->get_output());
+
+  auto null_scan = std::make_shared<TableScan>(table_wrapper,
+                                               OperatorScanPredicate{ColumnID{0}, PredicateCondition::IsNull});
+  null_scan->execute();
+  EXPECT_EQ(null_scan->get_output()->row_count(), expected_null_count);
+  expect_ascending_rows(null_scan->get_output());
+}
+
+TEST_P(OperatorsTableScanTest, ScanOnClusteredSegment) {
+  // Sorted values in runs of 40 span many FrameOfReference blocks, of which most can be skipped. The chunk is larger
+  // than a morsel, so that the segment-specific scans are used on ranges of it.
+  const auto row_count = 40'000;
+  auto values = std::vector<int32_t>{};
+  auto null_values = std::vector<bool>{};
+  for (auto row = 0; row < row_count; ++row) {
+    values.push_back(row / 40);
+    null_values.push_back(row % 777 == 0);
+  }
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  table->append_chunk({std::make_shared<ValueSegment<int32_t>>(values, null_values)});
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto predicate_conditions =
+      std::vector<PredicateCondition>{PredicateCondition::Equals,   PredicateCondition::NotEquals,
+                                      PredicateCondition::LessThan, PredicateCondition::LessThanEquals,
+                                      PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+  const auto search_values = std::vector<int32_t>{std::numeric_limits<int32_t>::min(), -1, 0, 1, 499, 500, 998, 999,
+                                                  1'000, std::numeric_limits<int32_t>::max()};
+
+  for (const auto predicate_condition : predicate_conditions) {
+    for (const auto search_value : search_values) {
+      auto expected_row_count = uint64_t{0};
+      with_comparator(predicate_condition, [&](auto comparator) {
+        for (auto row = 0; row < row_count; ++row) {
+          if (!null_values[row] && comparator(values[row], search_value)) ++expected_row_count;
+        }
+      });
+
+      auto scan = std::make_shared<TableScan>(table_wrapper,
+                                              OperatorScanPredicate{ColumnID{0}, predicate_condition, search_value});
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), expected_row_count)
+          << predicate_condition_to_string.left.at(predicate_condition) << " " << search_value;
+
+      const auto result = scan->get_output();
+      for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+        const auto segment = result->get_chunk(chunk_id)->get_segment(ColumnID{0});
+        const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+        EXPECT_TRUE(std::is_sorted(pos_list.begin(), pos_list.end()));
+      }
+    }
+  }
+}
+
 }  // namespace opossum
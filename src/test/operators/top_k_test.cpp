@@ -0,0 +1,91 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float4.tbl", 2));
+    _table_wrapper->execute();
+
+    auto table_with_null = load_table("src/test/tables/string_int_float_with_null.tbl", 3);
+    ChunkEncoder::encode_all_chunks(table_with_null);
+    _table_wrapper_null_dict = std::make_shared<TableWrapper>(table_with_null);
+    _table_wrapper_null_dict->execute();
+  }
+
+  // Compares the TopK result with the one of a Sort followed by a Limit
+  void test_top_k(const std::shared_ptr<AbstractOperator>& input,
+                  const std::vector<SortColumnDefinition>& sort_definitions, const int64_t row_count) {
+    auto top_k = std::make_shared<TopK>(input, sort_definitions, to_expression(row_count), 2u);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, sort_definitions, 2u);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, to_expression(row_count));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_null_dict;
+};
+
+TEST_F(OperatorsTopKTest, SingleColumn) {
+  test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 3);
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumns) {
+  test_top_k(_table_wrapper,
+             {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+              SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+             4);
+}
+
+TEST_F(OperatorsTopKTest, StringsAndNulls) {
+  for (const auto row_count : {1, 3, 5}) {
+    test_top_k(_table_wrapper_null_dict,
+               {SortColumnDefinition{ColumnID{0}, OrderByMode::AscendingNullsLast},
+                SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+               row_count);
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceSegmentInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper,
+                                          OperatorScanPredicate{ColumnID{0}, PredicateCondition::NotEquals, 123});
+  scan->execute();
+
+  test_top_k(scan, {SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}}, 2);
+}
+
+TEST_F(OperatorsTopKTest, MoreRowsThanInput) {
+  test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}}, 100);
+}
+
+TEST_F(OperatorsTopKTest, ZeroRows) {
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{0}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_count(), 2u);
+}
+
+}  // namespace opossum
@@ -12,6 +12,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -81,4 +82,68 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, StoresVisibilitySummary) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto table = _table_wrapper->get_output();
+
+  // All rows of the first chunk are committed and none is deleted
+  const auto visibility_summary = table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->visibility_summary();
+  ASSERT_TRUE(visibility_summary);
+  EXPECT_EQ(visibility_summary->row_count, 2u);
+  EXPECT_EQ(visibility_summary->max_begin_cid, 0u);
+
+  // The second chunk contains a deleted row
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->visibility_summary());
+}
+
+TEST_F(OperatorsValidateTest, UsesVisibilitySummary) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 3u);
+
+  // Deleting a row without invalidating the summary (as Delete would) shows that the rows are not checked again
+  const auto table = std::const_pointer_cast<Table>(_table_wrapper->get_output());
+  set_record_invisible_for(*table, RowID{ChunkID{0}, 1u}, 2u);
+
+  auto validate_with_summary = std::make_shared<Validate>(_table_wrapper);
+  validate_with_summary->set_transaction_context(context);
+  validate_with_summary->execute();
+  EXPECT_EQ(validate_with_summary->get_output()->row_count(), 3u);
+
+  // Once the summary is invalidated, the rows are checked again
+  table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->invalidate_visibility_summary();
+  auto validate_without_summary = std::make_shared<Validate>(_table_wrapper);
+  validate_without_summary->set_transaction_context(context);
+  validate_without_summary->execute();
+  EXPECT_EQ(validate_without_summary->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorsValidateTest, ReusesPosListIfAllRowsAreVisible) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  auto table_scan = std::make_shared<TableScan>(
+      _table_wrapper, OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, 5});
+  table_scan->execute();
+
+  auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto get_pos_list = [](const auto& table) {
+    return std::static_pointer_cast<const ReferenceSegment>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+        ->pos_list();
+  };
+
+  EXPECT_EQ(validate->get_output()->row_count(), 2u);
+  EXPECT_EQ(get_pos_list(validate->get_output()), get_pos_list(table_scan->get_output()));
+}
+
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "concurrency/transaction_context.hpp"
+#include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/validate.hpp"
 #include "storage/storage_manager.hpp"
@@ -155,4 +156,24 @@ TEST_F(OperatorsValidateVisibilityTest, UncommittedInsertOrFutureInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 0u);
 }
 
+TEST_F(OperatorsValidateVisibilityTest, DeleteInvalidatesVisibilitySummary) {
+  auto context = std::make_shared<TransactionContext>(2, 2);
+
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 1u);
+  EXPECT_TRUE(t->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->visibility_summary());
+
+  auto delete_op = std::make_shared<Delete>(table_name, validate);
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+  EXPECT_FALSE(t->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->visibility_summary());
+
+  // The row is locked by our transaction and thus not visible to it anymore
+  auto validate_after_delete = std::make_shared<Validate>(gt);
+  validate_after_delete->set_transaction_context(context);
+  validate_after_delete->execute();
+  EXPECT_EQ(validate_after_delete->get_output()->row_count(), 0u);
+}
+
 }  // namespace opossum
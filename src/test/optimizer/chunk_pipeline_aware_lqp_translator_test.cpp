@@ -0,0 +1,132 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/chunk_pipeline_aware_lqp_translator.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "operators/chunk_pipeline.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ChunkPipelineAwareLQPTranslatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_int_int.tbl", 2));
+    StorageManager::get().add_table("table_b", load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2));
+
+    stored_table_node_a = StoredTableNode::make("table_a");
+    stored_table_node_b = StoredTableNode::make("table_b");
+
+    a_a = stored_table_node_a->get_column("a");
+    a_b = stored_table_node_a->get_column("b");
+    a_c = stored_table_node_a->get_column("c");
+    b_a = stored_table_node_b->get_column("a");
+    b_b = stored_table_node_b->get_column("b");
+  }
+
+  void TearDown() override { StorageManager::get().reset(); }
+
+  static std::shared_ptr<const Table> execute(const std::shared_ptr<AbstractOperator>& pqp) {
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::No));
+    return pqp->get_output();
+  }
+
+  // Translates the LQP with the ChunkPipelineAwareLQPTranslator and checks that the result matches the one of the
+  // LQPTranslator
+  std::shared_ptr<AbstractOperator> translate_and_compare(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto pqp = ChunkPipelineAwareLQPTranslator{}.translate_node(lqp);
+    EXPECT_TABLE_EQ_UNORDERED(execute(pqp), execute(LQPTranslator{}.translate_node(lqp)));
+    return pqp;
+  }
+
+  std::shared_ptr<StoredTableNode> stored_table_node_a, stored_table_node_b;
+  LQPColumnReference a_a, a_b, a_c, b_a, b_b;
+};
+
+TEST_F(ChunkPipelineAwareLQPTranslatorTest, ScanAndProjection) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(a_a, a_b), a_c),
+    PredicateNode::make(greater_than_(a_b, 3),
+      PredicateNode::make(less_than_(a_a, 10000),
+        stored_table_node_a)));
+  // clang-format on
+
+  const auto pqp = translate_and_compare(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::ChunkPipeline);
+
+  const auto& pipeline = static_cast<const ChunkPipeline&>(*pqp);
+  EXPECT_EQ(pipeline.predicates().size(), 2u);
+  EXPECT_EQ(pipeline.expressions().size(), 2u);
+  EXPECT_FALSE(pipeline.has_aggregate());
+  EXPECT_EQ(pipeline.input_left()->type(), OperatorType::GetTable);
+}
+
+TEST_F(ChunkPipelineAwareLQPTranslatorTest, ScanProjectionAndAggregate) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(b_a), expression_vector(sum_(add_(b_b, 1)), count_star_()),
+    ProjectionNode::make(expression_vector(b_a, add_(b_b, 1)),
+      PredicateNode::make(greater_than_(b_b, 0),
+        stored_table_node_b)));
+  // clang-format on
+
+  const auto pqp = translate_and_compare(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::ChunkPipeline);
+
+  const auto& pipeline = static_cast<const ChunkPipeline&>(*pqp);
+  EXPECT_EQ(pipeline.predicates().size(), 1u);
+  EXPECT_EQ(pipeline.expressions().size(), 2u);
+  EXPECT_EQ(pipeline.aggregates().size(), 2u);
+  EXPECT_EQ(pipeline.groupby_column_ids().size(), 1u);
+  EXPECT_EQ(pipeline.input_left()->type(), OperatorType::GetTable);
+}
+
+TEST_F(ChunkPipelineAwareLQPTranslatorTest, ScanAndAggregate) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(), expression_vector(min_(a_b), max_(a_c)),
+    PredicateNode::make(greater_than_(a_a, 100),
+      stored_table_node_a));
+  // clang-format on
+
+  const auto pqp = translate_and_compare(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::ChunkPipeline);
+  EXPECT_TRUE(static_cast<const ChunkPipeline&>(*pqp).expressions().empty());
+}
+
+TEST_F(ChunkPipelineAwareLQPTranslatorTest, ProjectionWithoutScanIsNotFused) {
+  const auto lqp = ProjectionNode::make(expression_vector(add_(a_a, a_b)), stored_table_node_a);
+
+  EXPECT_EQ(translate_and_compare(lqp)->type(), OperatorType::Projection);
+}
+
+TEST_F(ChunkPipelineAwareLQPTranslatorTest, SharedScansAreNotFused) {
+  // The PredicateNode is consumed by both ProjectionNodes, so its TableScan must not be fused into either of them
+  const auto predicate_node = PredicateNode::make(greater_than_(a_a, 100), stored_table_node_a);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(UnionMode::Positions,
+    ProjectionNode::make(expression_vector(a_a, a_b, a_c), predicate_node),
+    ProjectionNode::make(expression_vector(a_a, a_b, a_c), predicate_node));
+  // clang-format on
+
+  const auto pqp = ChunkPipelineAwareLQPTranslator{}.translate_node(lqp);
+  EXPECT_EQ(pqp->input_left()->type(), OperatorType::Projection);
+  EXPECT_EQ(pqp->input_right()->type(), OperatorType::Projection);
+}
+
+}  // namespace opossum
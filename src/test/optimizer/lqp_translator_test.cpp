@@ -25,10 +25,13 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/show_columns.hpp"
@@ -37,7 +40,9 @@
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
@@ -85,6 +90,17 @@ class LQPTranslatorTest : public ::testing::Test {
 
   void TearDown() override { StorageManager::reset(); }
 
+  // Adds a table with the int column "a" holding the values 0..row_count-1
+  static void add_int_table(const std::string& name, const int32_t row_count, const uint32_t chunk_size) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data,
+                                               chunk_size, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      table->append({value});
+    }
+    ChunkEncoder::encode_all_chunks(table);
+    StorageManager::get().add_table(name, table);
+  }
+
   const std::vector<ChunkID> get_included_chunk_ids(const std::shared_ptr<const IndexScan>& index_scan) {
     return index_scan->_included_chunk_ids;
   }
@@ -330,22 +346,18 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
-
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
-
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
-
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
+  ASSERT_TRUE(sort);
+  const auto& sort_definitions = sort->sort_definitions();
+  ASSERT_EQ(sort_definitions.size(), 3u);
+  EXPECT_EQ(sort_definitions[0].column, ColumnID{1});
+  EXPECT_EQ(sort_definitions[0].order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(sort_definitions[1].column, ColumnID{0});
+  EXPECT_EQ(sort_definitions[1].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_definitions[2].column, ColumnID{2});
+  EXPECT_EQ(sort_definitions[2].order_by_mode, OrderByMode::AscendingNullsLast);
+
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
   ASSERT_TRUE(projection_b);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
@@ -652,9 +664,9 @@ TEST_F(LQPTranslatorTest, MultipleNodesHierarchy) {
   const auto op = LQPTranslator{}.translate_node(join_node);
 
   /**
-   * Check PQP
+   * Check PQP. With only a few rows on either side, the JoinNestedLoop is the cheapest join operator.
    */
-  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
+  const auto join_op = std::dynamic_pointer_cast<const JoinNestedLoop>(op);
   ASSERT_TRUE(join_op);
 
   const auto predicate_op_left = std::dynamic_pointer_cast<const TableScan>(join_op->input_left());
@@ -674,6 +686,167 @@ TEST_F(LQPTranslatorTest, MultipleNodesHierarchy) {
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
 }
 
+TEST_F(LQPTranslatorTest, JoinHashForLargeInputs) {
+  add_int_table("large_a", 10'000, 1'000);
+  add_int_table("large_b", 10'000, 1'000);
+  const auto large_a_node = StoredTableNode::make("large_a");
+  const auto large_b_node = StoredTableNode::make("large_b");
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(large_a_node->get_column("a"),
+                                                                 large_b_node->get_column("a")),
+                                        large_a_node, large_b_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(op));
+}
+
+TEST_F(LQPTranslatorTest, JoinSortMergeForLargeNonEquiInputs) {
+  add_int_table("large_a", 10'000, 1'000);
+  add_int_table("large_b", 10'000, 1'000);
+  const auto large_a_node = StoredTableNode::make("large_a");
+  const auto large_b_node = StoredTableNode::make("large_b");
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, less_than_(large_a_node->get_column("a"),
+                                                                    large_b_node->get_column("a")),
+                                        large_a_node, large_b_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinSortMerge>(op));
+}
+
+TEST_F(LQPTranslatorTest, JoinNestedLoopForTinyInput) {
+  add_int_table("large", 10'000, 1'000);
+  const auto large_node = StoredTableNode::make("large");
+
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, large_node->get_column("a")), int_float_node, large_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinNestedLoop>(op));
+}
+
+TEST_F(LQPTranslatorTest, JoinIndexForIndexedRightInput) {
+  add_int_table("large", 10'000, 1'000);
+  const auto table = StorageManager::get().get_table("large");
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  const auto large_node = StoredTableNode::make("large");
+
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, large_node->get_column("a")), int_float_node, large_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  const auto join_index = std::dynamic_pointer_cast<const JoinIndex>(op);
+  ASSERT_TRUE(join_index);
+  EXPECT_EQ(join_index->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_index->mode(), JoinMode::Inner);
+}
+
+TEST_F(LQPTranslatorTest, JoinIndexForValidatedIndexedRightInput) {
+  add_int_table("large", 10'000, 1'000);
+  const auto table = StorageManager::get().get_table("large");
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  const auto large_node = StoredTableNode::make("large");
+
+  // With MVCC, the stored table is only accessed through a Validate. JoinIndex uses the indexes of the validated table.
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, large_node->get_column("a")),
+                                        int_float_node, ValidateNode::make(large_node));
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  const auto join_index = std::dynamic_pointer_cast<const JoinIndex>(op);
+  ASSERT_TRUE(join_index);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Validate>(join_index->input_right()));
+}
+
+TEST_F(LQPTranslatorTest, JoinHashForSemiJoin) {
+  add_int_table("large", 10'000, 1'000);
+  const auto large_node = StoredTableNode::make("large");
+
+  // Only the JoinHash supports semi joins, no matter how small the inputs are
+  const auto join_node =
+      JoinNode::make(JoinMode::Semi, equals_(int_float_a, large_node->get_column("a")), int_float_node, large_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(op));
+}
+
+TEST_F(LQPTranslatorTest, JoinWithSecondaryPredicates) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(less_than_(int_float_b, int_float2_b),
+    PredicateNode::make(equals_(int_float2_a, int_float_a),
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+        int_float_node,
+        int_float2_node)));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto join = std::dynamic_pointer_cast<const AbstractJoinOperator>(op);
+  ASSERT_TRUE(join);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(join) || std::dynamic_pointer_cast<const JoinSortMerge>(join));
+  EXPECT_EQ(join->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join->predicate_condition(), PredicateCondition::Equals);
+
+  // The secondary predicates are ordered from the topmost PredicateNode down, the operands of the second one are
+  // swapped to match the join inputs
+  ASSERT_EQ(join->secondary_predicates().size(), 2u);
+  EXPECT_EQ(join->secondary_predicates()[0].column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join->secondary_predicates()[0].predicate_condition, PredicateCondition::LessThan);
+  EXPECT_EQ(join->secondary_predicates()[1].column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join->secondary_predicates()[1].predicate_condition, PredicateCondition::Equals);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join->input_left()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join->input_right()));
+}
+
+TEST_F(LQPTranslatorTest, JoinWithSecondaryPredicatePrefersEqualsAsPrimary) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(int_float_a, int_float2_a),
+    JoinNode::make(JoinMode::Inner, greater_than_(int_float_b, int_float2_b),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto join = std::dynamic_pointer_cast<const AbstractJoinOperator>(op);
+  ASSERT_TRUE(join);
+  EXPECT_EQ(join->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join->predicate_condition(), PredicateCondition::Equals);
+  ASSERT_EQ(join->secondary_predicates().size(), 1u);
+  EXPECT_EQ(join->secondary_predicates()[0].column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join->secondary_predicates()[0].predicate_condition, PredicateCondition::GreaterThan);
+}
+
+TEST_F(LQPTranslatorTest, NoSecondaryPredicatesForOuterJoinOrSingleInputPredicate) {
+  // clang-format off
+  const auto outer_join_lqp =
+  PredicateNode::make(equals_(int_float_b, int_float2_b),
+    JoinNode::make(JoinMode::Left, equals_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto outer_join_op = LQPTranslator{}.translate_node(outer_join_lqp);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const TableScan>(outer_join_op));
+
+  // clang-format off
+  const auto single_input_lqp =
+  PredicateNode::make(greater_than_(int_float_b, 5),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto single_input_op = LQPTranslator{}.translate_node(single_input_lqp);
+  ASSERT_TRUE(std::dynamic_pointer_cast<const TableScan>(single_input_op));
+
+  const auto join = std::dynamic_pointer_cast<const AbstractJoinOperator>(single_input_op->input_left());
+  ASSERT_TRUE(join);
+  EXPECT_TRUE(join->secondary_predicates().empty());
+}
+
 TEST_F(LQPTranslatorTest, LimitNode) {
   /**
    * Build LQP and translate to PQP
@@ -692,6 +865,42 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, LimitNodeTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 2
+   */
+  const auto order_by_modes = std::vector{OrderByMode::Descending, OrderByMode::Ascending};
+
+  // clang-format off
+  const auto limit_node =
+  LimitNode::make(value_(2),
+    SortNode::make(expression_vector(int_float_b, int_float_a), order_by_modes,
+      int_float_node));
+  // clang-format on
+  limit_node->limit_type = LimitType::TopK;
+
+  /**
+   * Check PQP
+   */
+  const auto op = LQPTranslator{}.translate_node(limit_node);
+  const auto top_k = std::dynamic_pointer_cast<TopK>(op);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(2));
+
+  const auto& sort_definitions = top_k->sort_definitions();
+  ASSERT_EQ(sort_definitions.size(), 2u);
+  EXPECT_EQ(sort_definitions[0].column, ColumnID{1});
+  EXPECT_EQ(sort_definitions[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_definitions[1].column, ColumnID{0});
+  EXPECT_EQ(sort_definitions[1].order_by_mode, OrderByMode::Ascending);
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->input_left());
+  ASSERT_TRUE(get_table);
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
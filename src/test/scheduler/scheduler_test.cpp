@@ -1,4 +1,6 @@
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -10,6 +12,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -209,4 +212,50 @@ TEST_F(SchedulerTest, MultipleOperators) {
   EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
 }
 
+TEST_F(SchedulerTest, TaskQueueStatistics) {
+  auto queue = std::make_shared<TaskQueue>(NodeID{0});
+  EXPECT_FALSE(queue->has_parked_workers());
+  EXPECT_FALSE(queue->wake_parked_worker());
+
+  queue->push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Default));
+
+  // A worker does not park as long as there are tasks in its queue
+  queue->park_worker(std::chrono::seconds{10});
+  EXPECT_EQ(queue->statistics().num_parked_workers, 0u);
+
+  EXPECT_NE(queue->pull(), nullptr);
+  EXPECT_TRUE(queue->empty());
+
+  const auto statistics = queue->statistics();
+  EXPECT_EQ(statistics.num_dequeued_tasks, 1u);
+  EXPECT_EQ(statistics.total_queue_time, statistics.max_queue_time);
+}
+
+TEST_F(SchedulerTest, ParkedWorkersAreWokenUp) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Give the idle workers time to park
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  std::atomic_uint counter{0};
+  auto task = std::make_shared<JobTask>([&]() { ++counter; });
+  task->schedule(NodeID{1});
+  task->join();
+
+  EXPECT_EQ(counter, 1u);
+
+  auto num_dequeued_tasks = uint64_t{0};
+  auto num_parked_workers = uint64_t{0};
+  for (const auto& queue : CurrentScheduler::get()->queues()) {
+    num_dequeued_tasks += queue->statistics().num_dequeued_tasks;
+    num_parked_workers += queue->statistics().num_parked_workers;
+  }
+  EXPECT_EQ(num_dequeued_tasks, 1u);
+  EXPECT_GT(num_parked_workers, 0u);
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
 }  // namespace opossum
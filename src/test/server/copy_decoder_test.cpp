@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/copy_decoder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CopyDecoderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::Double);
+    column_definitions.emplace_back("c", DataType::String, true);
+
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+
+    _expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+    _expected_table->append({-123, 1.5, "foo"});
+    _expected_table->append({NULL_VALUE, 0.25, ""});
+    _expected_table->append({2147483647, -3.0, NULL_VALUE});
+  }
+
+  static ByteBuffer _bytes(const std::string& data) { return ByteBuffer(data.begin(), data.end()); }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(CopyDecoderTest, DecodeTextFormat) {
+  auto decoder = CopyDecoder{_table, CopyFormat::Text};
+  decoder.add_data(_bytes("-123\t1.5\tfoo\n\\N\t0.25\t\n2147483647\t-3\t\\N\n"));
+  decoder.finish();
+
+  EXPECT_EQ(decoder.row_count(), 3u);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyDecoderTest, DecodeTextFormatEscapes) {
+  auto decoder = CopyDecoder{_table, CopyFormat::Text};
+  decoder.add_data(_bytes("1\t2\ta\\tb\\\\c\\nd\r\n\\.\nignored after the end-of-data marker"));
+  decoder.finish();
+
+  ASSERT_EQ(_table->row_count(), 1u);
+  EXPECT_EQ(_table->get_value<std::string>(ColumnID{2}, 0u), "a\tb\\c\nd");
+}
+
+TEST_F(CopyDecoderTest, DecodeCsvFormat) {
+  auto decoder = CopyDecoder{_table, CopyFormat::Csv};
+  decoder.add_data(_bytes("-123,1.5,\"foo\"\n,0.25,\"\"\n2147483647,-3,"));
+  decoder.finish();
+
+  EXPECT_EQ(decoder.row_count(), 3u);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyDecoderTest, DecodeCsvFormatQuotes) {
+  auto decoder = CopyDecoder{_table, CopyFormat::Csv};
+  decoder.add_data(_bytes("1,2,\"a,\"\"b\"\"\nc\"\n"));
+  decoder.finish();
+
+  ASSERT_EQ(_table->row_count(), 1u);
+  EXPECT_EQ(_table->get_value<std::string>(ColumnID{2}, 0u), "a,\"b\"\nc");
+}
+
+TEST_F(CopyDecoderTest, DecodeBinaryFormat) {
+  // Header, two rows, and the trailer
+  const auto data = ByteBuffer{'P', 'G', 'C', 'O', 'P', 'Y', '\n', '\xff', '\r', '\n', 0,  // Signature
+                               0, 0, 0, 0, 0, 0, 0, 0,                                      // Flags, extension
+                               0, 3,                                                        // First row
+                               0, 0, 0, 4, '\xff', '\xff', '\xff', '\x85',                  // -123
+                               0, 0, 0, 8, '\x3f', '\xf8', 0, 0, 0, 0, 0, 0,                // 1.5
+                               0, 0, 0, 3, 'f', 'o', 'o',                                   // "foo"
+                               0, 3,                                                        // Second row
+                               '\xff', '\xff', '\xff', '\xff',                              // NULL
+                               0, 0, 0, 8, '\x3f', '\xd0', 0, 0, 0, 0, 0, 0,                // 0.25
+                               0, 0, 0, 0,                                                  // ""
+                               '\xff', '\xff'};                                             // Trailer
+
+  // The data arrives in small pieces that split the rows
+  auto decoder = CopyDecoder{_table, CopyFormat::Binary};
+  for (auto begin = data.begin(); begin < data.end(); begin += std::min(data.end() - begin, ptrdiff_t{5})) {
+    decoder.add_data(ByteBuffer(begin, begin + std::min(data.end() - begin, ptrdiff_t{5})));
+    decoder.decode();
+  }
+  decoder.finish();
+
+  ASSERT_EQ(_table->row_count(), 2u);
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 0u), -123);
+  EXPECT_EQ(_table->get_value<double>(ColumnID{1}, 1u), 0.25);
+  EXPECT_EQ(_table->get_value<std::string>(ColumnID{2}, 1u), "");
+  EXPECT_TRUE(variant_is_null(_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})->operator[](1)));
+}
+
+TEST_F(CopyDecoderTest, AppendsFullChunks) {
+  auto decoder = CopyDecoder{_table, CopyFormat::Text};
+
+  // Full chunks are appended while decoding, the incomplete row is kept
+  decoder.add_data(_bytes("1\t1\ta\n2\t2\tb\n3\t3\tc\n4\t4"));
+  decoder.decode();
+  EXPECT_EQ(_table->chunk_count(), 1u);
+  EXPECT_EQ(decoder.row_count(), 3u);
+  EXPECT_EQ(decoder.buffered_size(), 3u);
+
+  decoder.add_data(_bytes("\td\n"));
+  decoder.finish();
+  EXPECT_EQ(_table->chunk_count(), 2u);
+  EXPECT_EQ(_table->row_count(), 4u);
+}
+
+TEST_F(CopyDecoderTest, RejectsInvalidData) {
+  {
+    auto decoder = CopyDecoder{_table, CopyFormat::Text};
+    decoder.add_data(_bytes("1\t2\n"));
+    EXPECT_THROW(decoder.decode(), std::logic_error);
+  }
+  {
+    auto decoder = CopyDecoder{_table, CopyFormat::Text};
+    decoder.add_data(_bytes("1\tx\ta\n"));
+    EXPECT_THROW(decoder.decode(), std::logic_error);
+  }
+  {
+    // Column b is not nullable
+    auto decoder = CopyDecoder{_table, CopyFormat::Csv};
+    decoder.add_data(_bytes("1,,a\n"));
+    EXPECT_THROW(decoder.decode(), std::logic_error);
+  }
+  {
+    auto decoder = CopyDecoder{_table, CopyFormat::Binary};
+    decoder.add_data(_bytes("PGCOPY\n\xff\r\n"));
+    EXPECT_THROW(decoder.finish(), std::logic_error);
+  }
+}
+
+}  // namespace opossum
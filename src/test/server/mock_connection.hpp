@@ -18,6 +18,9 @@ class MockConnection {
   MOCK_METHOD1(receive_sync_packet_body, boost::future<void>(uint32_t size));
   MOCK_METHOD1(receive_flush_packet_body, boost::future<void>(uint32_t size));
   MOCK_METHOD1(receive_execute_packet_body, boost::future<std::string>(uint32_t size));
+  MOCK_METHOD1(receive_copy_data_packet_body, boost::future<ByteBuffer>(uint32_t size));
+  MOCK_METHOD1(receive_copy_done_packet_body, boost::future<void>(uint32_t size));
+  MOCK_METHOD1(receive_copy_fail_packet_body, boost::future<std::string>(uint32_t size));
 
   MOCK_METHOD0(send_ssl_denied, boost::future<void>());
   MOCK_METHOD0(send_auth, boost::future<void>());
@@ -27,8 +30,11 @@ class MockConnection {
   MOCK_METHOD1(send_notice, boost::future<void>(const std::string& notice));
   MOCK_METHOD1(send_status_message, boost::future<void>(const NetworkMessageType& type));
   MOCK_METHOD1(send_row_description, boost::future<void>(const std::vector<ColumnDescription>& row_description));
-  MOCK_METHOD1(send_data_row, boost::future<void>(const std::vector<std::string>& row_strings));
+  MOCK_METHOD1(send_data_rows, boost::future<void>(const std::shared_ptr<OutputPacket>& data_rows));
   MOCK_METHOD1(send_command_complete, boost::future<void>(const std::string& message));
+  MOCK_METHOD2(send_copy_in_response, boost::future<void>(CopyFormat format, size_t column_count));
+  MOCK_METHOD2(send_copy_out_response, boost::future<void>(CopyFormat format, size_t column_count));
+  MOCK_METHOD1(send_copy_data, boost::future<void>(const std::shared_ptr<OutputPacket>& copy_data));
 };
 
 }  // namespace opossum
@@ -1,6 +1,9 @@
 
+#include <cstring>
+
 #include <base_test.hpp>
 #include <server/postgres_wire_handler.hpp>
+#include <utils/invalid_input_exception.hpp>
 
 namespace opossum {
 
@@ -67,4 +70,100 @@ TEST_F(PostgresWireHandlerTest, WriteString) {
   // string should be terminated
   ASSERT_EQ(_output_packet.data[value.length()], '\0');
 }
+
+TEST_F(PostgresWireHandlerTest, HandleParsePacket) {
+  postgres_wire_handler.write_string(_output_packet, "statement");
+  postgres_wire_handler.write_string(_output_packet, "SELECT * FROM foo WHERE a = ? AND b = ?");
+  postgres_wire_handler.write_value(_output_packet, htons(2u));
+  postgres_wire_handler.write_value(_output_packet, htonl(static_cast<uint32_t>(PostgresDataType::Int8)));
+  postgres_wire_handler.write_value(_output_packet, htonl(0u));
+  _input_packet.data = _output_packet.data;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto parse_packet = postgres_wire_handler.handle_parse_packet(_input_packet);
+
+  EXPECT_EQ(parse_packet.statement_name, "statement");
+  EXPECT_EQ(parse_packet.parameter_data_types,
+            (std::vector<uint32_t>{static_cast<uint32_t>(PostgresDataType::Int8), 0u}));
+}
+
+TEST_F(PostgresWireHandlerTest, HandleBindPacketWithBinaryParameters) {
+  postgres_wire_handler.write_string(_output_packet, "portal");
+  postgres_wire_handler.write_string(_output_packet, "statement");
+
+  // Parameter format codes
+  postgres_wire_handler.write_value(_output_packet, htons(4u));
+  postgres_wire_handler.write_value(_output_packet, htons(static_cast<uint16_t>(FormatCode::Text)));
+  postgres_wire_handler.write_value(_output_packet, htons(static_cast<uint16_t>(FormatCode::Binary)));
+  postgres_wire_handler.write_value(_output_packet, htons(static_cast<uint16_t>(FormatCode::Binary)));
+  postgres_wire_handler.write_value(_output_packet, htons(static_cast<uint16_t>(FormatCode::Binary)));
+
+  // Parameter values: a string, an int8, a float8, and NULL
+  postgres_wire_handler.write_value(_output_packet, htons(4u));
+  postgres_wire_handler.write_value(_output_packet, htonl(3u));
+  postgres_wire_handler.write_string(_output_packet, "foo", false);
+  postgres_wire_handler.write_value(_output_packet, htonl(8u));
+  postgres_wire_handler.write_value(_output_packet, htonl(1u));
+  postgres_wire_handler.write_value(_output_packet, htonl(2u));
+  postgres_wire_handler.write_value(_output_packet, htonl(8u));
+  const auto double_value = 2.5;
+  uint64_t double_bits;
+  std::memcpy(&double_bits, &double_value, sizeof(double_bits));
+  postgres_wire_handler.write_value(_output_packet, htonl(static_cast<uint32_t>(double_bits >> 32)));
+  postgres_wire_handler.write_value(_output_packet, htonl(static_cast<uint32_t>(double_bits)));
+  postgres_wire_handler.write_value(_output_packet, htonl(static_cast<uint32_t>(-1)));
+
+  // Result format codes
+  postgres_wire_handler.write_value(_output_packet, htons(1u));
+  postgres_wire_handler.write_value(_output_packet, htons(static_cast<uint16_t>(FormatCode::Binary)));
+
+  _input_packet.data = _output_packet.data;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto bind_packet = postgres_wire_handler.handle_bind_packet(_input_packet);
+
+  EXPECT_EQ(bind_packet.destination_portal, "portal");
+  EXPECT_EQ(bind_packet.statement_name, "statement");
+  EXPECT_EQ(bind_packet.result_format_codes, std::vector<FormatCode>{FormatCode::Binary});
+  ASSERT_EQ(bind_packet.parameter_values.size(), 4u);
+  EXPECT_FALSE(bind_packet.parameter_values[3]);
+
+  const auto parameter_data_types = std::vector<uint32_t>{
+      0u, static_cast<uint32_t>(PostgresDataType::Int8), static_cast<uint32_t>(PostgresDataType::Float8), 0u};
+  const auto parameters = postgres_wire_handler.read_bind_parameters(bind_packet, parameter_data_types);
+
+  ASSERT_EQ(parameters.size(), 4u);
+  EXPECT_EQ(parameters[0], AllTypeVariant{std::string{"foo"}});
+  EXPECT_EQ(parameters[1], AllTypeVariant{int64_t{(int64_t{1} << 32) + 2}});
+  EXPECT_EQ(parameters[2], AllTypeVariant{2.5});
+  EXPECT_TRUE(variant_is_null(parameters[3]));
+}
+
+TEST_F(PostgresWireHandlerTest, HandleBindPacketWithInvalidFormatCode) {
+  postgres_wire_handler.write_string(_output_packet, "portal");
+  postgres_wire_handler.write_string(_output_packet, "statement");
+
+  // Only 0 (text) and 1 (binary) are valid format codes
+  postgres_wire_handler.write_value(_output_packet, htons(1u));
+  postgres_wire_handler.write_value(_output_packet, htons(2u));
+
+  _input_packet.data = _output_packet.data;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  EXPECT_THROW(postgres_wire_handler.handle_bind_packet(_input_packet), InvalidInputException);
+}
+
+TEST_F(PostgresWireHandlerTest, ReadBinaryBindParameterWithoutType) {
+  BindPacket bind_packet;
+  bind_packet.parameter_values = {ByteBuffer{0, 0, 1, 0}, ByteBuffer{1, 2}};
+  bind_packet.parameter_format_codes = {FormatCode::Binary};
+
+  EXPECT_THROW(postgres_wire_handler.read_bind_parameters(bind_packet, {}), std::logic_error);
+
+  bind_packet.parameter_values.pop_back();
+  const auto parameters = postgres_wire_handler.read_bind_parameters(bind_packet, {});
+  ASSERT_EQ(parameters.size(), 1u);
+  EXPECT_EQ(parameters[0], AllTypeVariant{int32_t{256}});
+}
+
 }  // namespace opossum
@@ -0,0 +1,241 @@
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "server/postgres_wire_handler.hpp"
+#include "server/query_response_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class QueryResponseBuilderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::Double);
+    column_definitions.emplace_back("c", DataType::String);
+
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+    _table->append({-123, 1.5, "foo"});
+    _table->append({NULL_VALUE, 0.25, ""});
+    _table->append({2147483647, -3.0, "bar"});
+  }
+
+  // Builds the DataRow message of a row, a nullopt stands for NULL
+  static ByteBuffer _expected_data_row(const std::vector<std::optional<std::string>>& values) {
+    auto packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
+    PostgresWireHandler::write_value(*packet, htons(values.size()));
+
+    for (const auto& value : values) {
+      if (!value) {
+        PostgresWireHandler::write_value(*packet, htonl(static_cast<uint32_t>(-1)));
+        continue;
+      }
+
+      PostgresWireHandler::write_value(*packet, htonl(value->length()));
+      PostgresWireHandler::write_string(*packet, *value, false);
+    }
+
+    PostgresWireHandler::write_output_packet_size(*packet);
+    return packet->data;
+  }
+
+  ByteBuffer _expected_data_rows() {
+    auto expected = ByteBuffer{};
+    for (const auto& row : std::vector<ByteBuffer>{_expected_data_row({"-123", "1.5", "foo"}),
+                                                   _expected_data_row({std::nullopt, "0.25", ""}),
+                                                   _expected_data_row({"2147483647", "-3", "bar"})}) {
+      expected.insert(expected.end(), row.begin(), row.end());
+    }
+    return expected;
+  }
+
+  ByteBuffer _write_data_rows(const Table& table) {
+    auto packet = OutputPacket{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      QueryResponseBuilder::write_data_rows(packet, *table.get_chunk(chunk_id));
+    }
+    return packet.data;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(QueryResponseBuilderTest, WriteDataRowsOfValueSegments) {
+  EXPECT_EQ(_write_data_rows(*_table), _expected_data_rows());
+}
+
+TEST_F(QueryResponseBuilderTest, WriteDataRowsOfEncodedAndReferenceSegments) {
+  ChunkEncoder::encode_all_chunks(_table);
+  EXPECT_EQ(_write_data_rows(*_table), _expected_data_rows());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(
+      table_wrapper, OperatorScanPredicate{ColumnID{2}, PredicateCondition::NotEquals, std::string{"x"}});
+  table_scan->execute();
+  EXPECT_EQ(_write_data_rows(*table_scan->get_output()), _expected_data_rows());
+}
+
+TEST_F(QueryResponseBuilderTest, WriteDataRowsInBinaryFormat) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Long);
+  column_definitions.emplace_back("c", DataType::Float);
+  column_definitions.emplace_back("d", DataType::String);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append({-2, int64_t{1} << 40, 1.5f, "foo"});
+  table->append({NULL_VALUE, int64_t{3}, -2.0f, "bar"});
+
+  const auto format_codes = std::vector<FormatCode>{FormatCode::Binary};
+  // Message type, length, and column count followed by the length and the bytes of each value
+  const auto expected_data_rows = ByteBuffer{
+      'D', 0, 0, 0, 41, 0, 4,                      // First row
+      0, 0, 0, 4, '\xff', '\xff', '\xff', '\xfe',  // -2
+      0, 0, 0, 8, 0, 0, 1, 0, 0, 0, 0, 0,          // 2^40
+      0, 0, 0, 4, '\x3f', '\xc0', 0, 0,            // 1.5f
+      0, 0, 0, 3, 'f', 'o', 'o',                   // "foo"
+      'D', 0, 0, 0, 37, 0, 4,                      // Second row
+      '\xff', '\xff', '\xff', '\xff',              // NULL
+      0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 3,          // 3
+      0, 0, 0, 4, '\xc0', 0, 0, 0,                 // -2.0f
+      0, 0, 0, 3, 'b', 'a', 'r'};                  // "bar"
+
+  auto packet = OutputPacket{};
+  QueryResponseBuilder::write_data_rows(packet, *table->get_chunk(ChunkID{0}), format_codes);
+  EXPECT_EQ(packet.data, expected_data_rows);
+
+  const auto row_description = QueryResponseBuilder::build_row_description(table, format_codes);
+  ASSERT_EQ(row_description.size(), 4u);
+  for (const auto& column_description : row_description) {
+    EXPECT_EQ(column_description.format_code, FormatCode::Binary);
+  }
+  EXPECT_EQ(row_description[1].object_id, static_cast<uint32_t>(PostgresDataType::Int8));
+}
+
+TEST_F(QueryResponseBuilderTest, FormatCodePerColumn) {
+  const auto format_codes = std::vector<FormatCode>{FormatCode::Binary, FormatCode::Text, FormatCode::Text};
+
+  auto packet = OutputPacket{};
+  QueryResponseBuilder::write_data_rows(packet, *_table->get_chunk(ChunkID{0}), format_codes);
+
+  // Only the first column of the first row is sent in binary format: -123 as int4
+  const auto expected_begin = ByteBuffer{'D', 0, 0, 0, 28, 0, 3,                      // Message header
+                                         0, 0, 0, 4, '\xff', '\xff', '\xff', '\x85',  // -123
+                                         0, 0, 0, 3, '1', '.', '5'};                  // "1.5"
+  ASSERT_GE(packet.data.size(), expected_begin.size());
+  EXPECT_EQ(ByteBuffer(packet.data.begin(), packet.data.begin() + expected_begin.size()), expected_begin);
+
+  EXPECT_THROW(QueryResponseBuilder::write_data_rows(packet, *_table->get_chunk(ChunkID{0}),
+                                                     {FormatCode::Binary, FormatCode::Text}),
+               std::logic_error);
+}
+
+TEST_F(QueryResponseBuilderTest, WriteCopyDataInTextAndCsvFormat) {
+  _table->append({3, 0.5, "a\tb,\"c\"\\"});
+
+  // Every row is sent in its own CopyData message
+  const auto copy_data = [](const std::string& row) {
+    auto message = ByteBuffer{'d', 0, 0, 0, static_cast<char>(4 + row.size())};
+    message.insert(message.end(), row.begin(), row.end());
+    return message;
+  };
+
+  auto expected_text = ByteBuffer{};
+  auto expected_csv = ByteBuffer{};
+  for (const auto& [text_row, csv_row] : std::vector<std::pair<std::string, std::string>>{
+           {"2147483647\t-3\tbar\n", "2147483647,-3,bar\n"},
+           {"3\t0.5\ta\\tb,\"c\"\\\\\n", "3,0.5,\"a\tb,\"\"c\"\"\\\"\n"}}) {
+    const auto text_message = copy_data(text_row);
+    const auto csv_message = copy_data(csv_row);
+    expected_text.insert(expected_text.end(), text_message.begin(), text_message.end());
+    expected_csv.insert(expected_csv.end(), csv_message.begin(), csv_message.end());
+  }
+
+  auto text_packet = OutputPacket{};
+  QueryResponseBuilder::write_copy_data(text_packet, *_table->get_chunk(ChunkID{1}), CopyFormat::Text);
+  EXPECT_EQ(text_packet.data, expected_text);
+
+  auto csv_packet = OutputPacket{};
+  QueryResponseBuilder::write_copy_data(csv_packet, *_table->get_chunk(ChunkID{1}), CopyFormat::Csv);
+  EXPECT_EQ(csv_packet.data, expected_csv);
+
+  // NULLs are \N in the text format and empty in the CSV format, empty strings are quoted in the CSV format
+  auto null_packet = OutputPacket{};
+  QueryResponseBuilder::write_copy_data(null_packet, *_table->get_chunk(ChunkID{0}), CopyFormat::Text);
+  const auto null_text_row = copy_data("\\N\t0.25\t\n");
+  EXPECT_EQ(ByteBuffer(null_packet.data.end() - null_text_row.size(), null_packet.data.end()), null_text_row);
+
+  null_packet = OutputPacket{};
+  QueryResponseBuilder::write_copy_data(null_packet, *_table->get_chunk(ChunkID{0}), CopyFormat::Csv);
+  const auto null_csv_row = copy_data(",0.25,\"\"\n");
+  EXPECT_EQ(ByteBuffer(null_packet.data.end() - null_csv_row.size(), null_packet.data.end()), null_csv_row);
+}
+
+TEST_F(QueryResponseBuilderTest, SendCopyResponseInBinaryFormat) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append({-2});
+  table->append({NULL_VALUE});
+
+  std::vector<ByteBuffer> messages;
+  auto send_copy_data = [&](const std::shared_ptr<OutputPacket>& copy_data) {
+    messages.emplace_back(copy_data->data);
+    return boost::make_ready_future();
+  };
+
+  EXPECT_EQ(QueryResponseBuilder::send_copy_response(send_copy_data, *table, CopyFormat::Binary).get(), 2u);
+
+  // Header, both rows, and the trailer
+  ASSERT_EQ(messages.size(), 3u);
+  EXPECT_EQ(messages[0], (ByteBuffer{'d', 0, 0, 0, 23, 'P', 'G', 'C', 'O', 'P', 'Y', '\n', '\xff', '\r', '\n', 0,  //
+                                     0, 0, 0, 0, 0, 0, 0, 0}));
+  EXPECT_EQ(messages[1], (ByteBuffer{'d', 0, 0, 0, 14, 0, 1, 0, 0, 0, 4, '\xff', '\xff', '\xff', '\xfe',  // -2
+                                     'd', 0, 0, 0, 10, 0, 1, '\xff', '\xff', '\xff', '\xff'}));          // NULL
+  EXPECT_EQ(messages[2], (ByteBuffer{'d', 0, 0, 0, 6, '\xff', '\xff'}));
+}
+
+TEST_F(QueryResponseBuilderTest, SendQueryResponseInBatches) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  const auto chunk_count = 20u;
+  const auto chunk_size = 4'000;
+  for (auto chunk_index = 0u; chunk_index < chunk_count; ++chunk_index) {
+    auto values = std::vector<int32_t>(chunk_size, 12345);
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(values)});
+  }
+
+  std::vector<size_t> batch_sizes;
+  auto send_data_rows = [&](const std::shared_ptr<OutputPacket>& data_rows) {
+    batch_sizes.emplace_back(data_rows->data.size());
+    return boost::make_ready_future();
+  };
+
+  EXPECT_EQ(QueryResponseBuilder::send_query_response(send_data_rows, *table).get(), chunk_count * chunk_size);
+
+  // Multiple chunks are sent in one batch, every batch but the last one is full
+  ASSERT_GT(batch_sizes.size(), 1u);
+  EXPECT_LT(batch_sizes.size(), chunk_count);
+  for (auto batch_index = size_t{0}; batch_index + 1 < batch_sizes.size(); ++batch_index) {
+    EXPECT_GE(batch_sizes[batch_index], QueryResponseBuilder::DATA_ROWS_BATCH_SIZE);
+  }
+
+  // Type, length, column count, value length and five digits per row
+  const auto data_row_size = 1u + 4u + 2u + 4u + 5u;
+  EXPECT_EQ(std::accumulate(batch_sizes.begin(), batch_sizes.end(), size_t{0}),
+            chunk_count * chunk_size * data_row_size);
+}
+
+}  // namespace opossum
@@ -76,12 +76,21 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_rows(_)).WillByDefault(Invoke([](const std::shared_ptr<OutputPacket>&) {
       return boost::make_ready_future();
     }));
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
+    ON_CALL(*_connection, send_copy_in_response(_, _)).WillByDefault(Invoke([](CopyFormat, size_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_out_response(_, _)).WillByDefault(Invoke([](CopyFormat, size_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_data(_)).WillByDefault(Invoke([](const std::shared_ptr<OutputPacket>&) {
+      return boost::make_ready_future();
+    }));
   }
 
   std::shared_ptr<SQLPipeline> _create_working_sql_pipeline() {
@@ -229,8 +238,8 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   // It sends the result schema...
   EXPECT_CALL(*_connection, send_row_description(_));
 
-  // ... as well as the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // ... as well as the row data (all three rows fit into one batch)
+  EXPECT_CALL(*_connection, send_data_rows(_));
 
   // Finally, the session completes the command...
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -297,8 +306,8 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
 
-  // It sends the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // It sends the row data (all three rows fit into one batch)
+  EXPECT_CALL(*_connection, send_data_rows(_));
 
   // ... and completes the command
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -344,6 +353,67 @@ TEST_F(ServerSessionTest, SessionHandlesLoadTableRequestInSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionHandlesCopyFromStdinInSimpleQueryCommand) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::String);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  StorageManager::get().add_table("copy_target", table);
+
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY copy_target FROM STDIN;")))));
+
+  // The CreatePipelineTask detects the COPY command
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->copy = CopyCommand{true, "copy_target", CopyFormat::Text};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_connection, send_copy_in_response(CopyFormat::Text, 2u));
+
+  // The client sends the rows in two CopyData messages, which do not end with complete rows. The last row does not need
+  // to end with a newline.
+  RequestHeader copy_data_request{NetworkMessageType::CopyData, 9};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+  EXPECT_CALL(*_connection, receive_copy_data_packet_body(9))
+      .WillOnce(Return(ByMove(boost::make_ready_future(ByteBuffer{'1', '\t', 'f', 'o', 'o', '\n', '2', '\t', 'b'}))));
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+  EXPECT_CALL(*_connection, receive_copy_data_packet_body(9))
+      .WillOnce(Return(ByMove(boost::make_ready_future(ByteBuffer{'a', 'r', '\n', '3', '\t', 'b', '\\', 't', 'z'}))));
+
+  RequestHeader copy_done_request{NetworkMessageType::CopyDone, 0};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_done_request))));
+  EXPECT_CALL(*_connection, receive_copy_done_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  // Little data was sent, so it is only decoded once the client is done
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<DecodeCopyDataTask>>()))
+      .WillOnce(Invoke([](std::shared_ptr<DecodeCopyDataTask> task) {
+        task->execute();
+        return task->get_future();
+      }));
+
+  EXPECT_CALL(*_connection, send_command_complete("COPY 3"));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+
+  ASSERT_EQ(table->row_count(), 3u);
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{1}, 1u), "bar");
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{1}, 2u), "b\tz");
+}
+
 TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   InSequence s;
 
@@ -37,7 +37,8 @@ class ServerTestRunner : public BaseTest {
 
       cv->notify_one();
 
-      io_service.run();
+      // Use multiple io threads, so that the sessions of the parallel connections are actually processed in parallel
+      server.run(4);
     };
 
     _io_service = std::make_unique<boost::asio::io_service>();
@@ -0,0 +1,59 @@
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/parameterize_sql_literals.hpp"
+
+namespace opossum {
+
+class ParameterizeSQLLiteralsTest : public BaseTest {};
+
+TEST_F(ParameterizeSQLLiteralsTest, ComparisonsInListsAndBetween) {
+  const auto parameterized_sql = parameterize_sql_literals(
+      "SELECT a, b + 1 FROM t WHERE a = 5 AND b IN ('x', 'y') AND c BETWEEN -3 AND 4.5 AND d > 3000000000 LIMIT 10;");
+
+  ASSERT_TRUE(parameterized_sql);
+  EXPECT_EQ(parameterized_sql->sql,
+            "SELECT a, b + 1 FROM t WHERE a = ? AND b IN (?, ?) AND c BETWEEN ? AND ? AND d > ? LIMIT 10;");
+
+  ASSERT_EQ(parameterized_sql->values.size(), 6u);
+  EXPECT_EQ(parameterized_sql->values[0], AllTypeVariant{int32_t{5}});
+  EXPECT_EQ(parameterized_sql->values[1], AllTypeVariant{std::string{"x"}});
+  EXPECT_EQ(parameterized_sql->values[2], AllTypeVariant{std::string{"y"}});
+  EXPECT_EQ(parameterized_sql->values[3], AllTypeVariant{int32_t{-3}});
+  EXPECT_EQ(parameterized_sql->values[4], AllTypeVariant{4.5});
+  EXPECT_EQ(parameterized_sql->values[5], AllTypeVariant{int64_t{3000000000}});
+}
+
+TEST_F(ParameterizeSQLLiteralsTest, SubqueriesAndHaving) {
+  const auto parameterized_sql = parameterize_sql_literals(
+      "SELECT (SELECT MAX(x) FROM u WHERE y = 1), SUM(b) FROM t WHERE a IN (SELECT z FROM v WHERE z <> 'q') "
+      "GROUP BY a HAVING SUM(b) >= 100 -- a = 7");
+
+  ASSERT_TRUE(parameterized_sql);
+  EXPECT_EQ(parameterized_sql->sql,
+            "SELECT (SELECT MAX(x) FROM u WHERE y = 1), SUM(b) FROM t WHERE a IN (SELECT z FROM v WHERE z <> ?) "
+            "GROUP BY a HAVING SUM(b) >= ? -- a = 7");
+  ASSERT_EQ(parameterized_sql->values.size(), 2u);
+  EXPECT_EQ(parameterized_sql->values[0], AllTypeVariant{std::string{"q"}});
+  EXPECT_EQ(parameterized_sql->values[1], AllTypeVariant{int32_t{100}});
+}
+
+TEST_F(ParameterizeSQLLiteralsTest, LiteralsInLargerExpressionsAreKept) {
+  const auto parameterized_sql = parameterize_sql_literals("SELECT * FROM t WHERE a = 5 + b AND c LIKE 'x%' AND d = 1");
+
+  ASSERT_TRUE(parameterized_sql);
+  EXPECT_EQ(parameterized_sql->sql, "SELECT * FROM t WHERE a = 5 + b AND c LIKE 'x%' AND d = ?");
+}
+
+TEST_F(ParameterizeSQLLiteralsTest, UnsupportedStatements) {
+  EXPECT_FALSE(parameterize_sql_literals("SELECT a FROM t"));
+  EXPECT_FALSE(parameterize_sql_literals("SELECT * FROM t WHERE a = ? AND b = 1"));
+  EXPECT_FALSE(parameterize_sql_literals("SELECT * FROM t WHERE a = 1; SELECT * FROM t WHERE a = 2"));
+  EXPECT_FALSE(parameterize_sql_literals("DELETE FROM t WHERE a = 1"));
+  EXPECT_FALSE(parameterize_sql_literals("SELECT * FROM t WHERE a = 'unterminated"));
+  EXPECT_FALSE(parameterize_sql_literals("SELECT * FROM t WHERE a = 99999999999999999999"));
+}
+
+}  // namespace opossum
@@ -762,4 +762,117 @@ TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   EXPECT_TABLE_EQ_UNORDERED(second_subselect_result, expected_second_result);
 }
 
+TEST_F(SQLPipelineStatementTest, AutoParameterizedStatementsShareCachedPlan) {
+  const auto first_query = "SELECT * FROM table_a WHERE a = 123 OR (a > 1000 AND b < 458.0)";
+  const auto second_query = "SELECT * FROM table_a WHERE a = 12345 OR (a > 1233 AND b < 460.0)";
+
+  auto first_sql_pipeline = SQLPipelineBuilder{first_query}.enable_auto_parameterization().create_pipeline_statement();
+  const auto first_result = first_sql_pipeline.get_result_table();
+  EXPECT_FALSE(first_sql_pipeline.metrics()->query_plan_cache_hit);
+
+  auto expected_first_result = std::make_shared<Table>(_int_float_column_definitions, TableType::Data);
+  expected_first_result->append({123, 456.7f});
+  expected_first_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(first_result, expected_first_result);
+
+  // Only the unbound plan of the normalized statement is cached
+  const auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_TRUE(cache.has("SELECT * FROM table_a WHERE a = ? OR (a > ? AND b < ?)"));
+
+  auto second_sql_pipeline =
+      SQLPipelineBuilder{second_query}.enable_auto_parameterization().create_pipeline_statement();
+  const auto second_result = second_sql_pipeline.get_result_table();
+  EXPECT_TRUE(second_sql_pipeline.metrics()->query_plan_cache_hit);
+
+  auto expected_second_result = std::make_shared<Table>(_int_float_column_definitions, TableType::Data);
+  expected_second_result->append({12345, 458.7f});
+  expected_second_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(second_result, expected_second_result);
+}
+
+TEST_F(SQLPipelineStatementTest, AutoParameterizationFallback) {
+  // If the normalized statement cannot be translated, the original statement is used. This is forced here by passing
+  // the parse result of a valid statement along with an SQL string that references an unknown table.
+  const auto unknown_table_query = "SELECT * FROM unknown_table WHERE a = 123";
+  auto parse_result = std::make_shared<hsql::SQLParserResult>();
+  hsql::SQLParser::parseSQLString("SELECT * FROM table_a WHERE a = 123", parse_result.get());
+
+  auto sql_pipeline = SQLPipelineBuilder{unknown_table_query}.enable_auto_parameterization().create_pipeline_statement(
+      parse_result);
+  EXPECT_EQ(sql_pipeline.get_result_table()->row_count(), 1u);
+
+  // The plan has the literal built in, so it must not be shared with other statements via the normalized SQL
+  const auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_FALSE(cache.has("SELECT * FROM unknown_table WHERE a = ?"));
+  EXPECT_TRUE(cache.has(unknown_table_query));
+
+  // Running the statement again uses the plan cached for the original statement
+  auto second_sql_pipeline =
+      SQLPipelineBuilder{unknown_table_query}.enable_auto_parameterization().create_pipeline_statement(parse_result);
+  EXPECT_EQ(second_sql_pipeline.get_result_table()->row_count(), 1u);
+  EXPECT_TRUE(second_sql_pipeline.metrics()->query_plan_cache_hit);
+  EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, AutoParameterizationWithoutLiterals) {
+  auto sql_pipeline =
+      SQLPipelineBuilder{"SELECT a + 1 FROM table_a"}.enable_auto_parameterization().create_pipeline_statement();
+  sql_pipeline.get_result_table();
+
+  EXPECT_TRUE(SQLQueryCache<SQLQueryPlan>::get().has("SELECT a + 1 FROM table_a"));
+}
+
+TEST_F(SQLPipelineStatementTest, ResultCache) {
+  auto result_cache = std::make_shared<SQLResultCache>();
+  const auto query = "SELECT * FROM table_a WHERE a > 1000";
+
+  auto first_sql_pipeline = SQLPipelineBuilder{query}.with_result_cache(result_cache).create_pipeline_statement();
+  const auto first_result = first_sql_pipeline.get_result_table();
+  EXPECT_FALSE(first_sql_pipeline.metrics()->result_cache_hit);
+  EXPECT_EQ(result_cache->size(), 1u);
+
+  auto second_sql_pipeline = SQLPipelineBuilder{query}.with_result_cache(result_cache).create_pipeline_statement();
+  EXPECT_EQ(second_sql_pipeline.get_result_table(), first_result);
+  EXPECT_TRUE(second_sql_pipeline.metrics()->result_cache_hit);
+
+  // The committed Insert invalidates the cached result
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (5000, 1.5)"}.create_pipeline_statement().get_result_table();
+
+  auto third_sql_pipeline = SQLPipelineBuilder{query}.with_result_cache(result_cache).create_pipeline_statement();
+  const auto third_result = third_sql_pipeline.get_result_table();
+  EXPECT_FALSE(third_sql_pipeline.metrics()->result_cache_hit);
+  EXPECT_EQ(third_result->row_count(), first_result->row_count() + 1);
+}
+
+TEST_F(SQLPipelineStatementTest, ResultCacheNotUsedInTransactionsOrForModifications) {
+  auto result_cache = std::make_shared<SQLResultCache>();
+  const auto query = "SELECT * FROM table_a";
+
+  SQLPipelineBuilder{query}.with_result_cache(result_cache).create_pipeline_statement().get_result_table();
+  EXPECT_EQ(result_cache->size(), 1u);
+
+  // Within a transaction, the statement has to see the transaction's own modifications
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (5000, 1.5)"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline_statement()
+      .get_result_table();
+
+  auto sql_pipeline = SQLPipelineBuilder{query}
+                          .with_result_cache(result_cache)
+                          .with_transaction_context(transaction_context)
+                          .create_pipeline_statement();
+  EXPECT_EQ(sql_pipeline.get_result_table()->row_count(), 4u);
+  EXPECT_FALSE(sql_pipeline.metrics()->result_cache_hit);
+  transaction_context->rollback();
+
+  SQLPipelineBuilder{"DELETE FROM table_a WHERE a = 123"}
+      .with_result_cache(result_cache)
+      .create_pipeline_statement()
+      .get_result_table();
+  EXPECT_EQ(result_cache->size(), 1u);
+}
+
 }  // namespace opossum
@@ -385,6 +385,23 @@ TEST_F(SQLPipelineTest, GetResultTableWithScheduler) {
   EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
 }
 
+TEST_F(SQLPipelineTest, GetResultTablesOfReadOnlyStatementsWithScheduler) {
+  // The first three statements are executed concurrently, the last one has to see the INSERT
+  const auto sql = _join_query + "; " + _select_query_a + "; " + _join_query + "; " + _multi_statement_query;
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto& tables = sql_pipeline.get_result_tables();
+
+  ASSERT_EQ(tables.size(), 5u);
+  EXPECT_TABLE_EQ_UNORDERED(tables[0], _join_result);
+  EXPECT_TABLE_EQ_UNORDERED(tables[1], _table_a);
+  EXPECT_TABLE_EQ_UNORDERED(tables[2], _join_result);
+  EXPECT_EQ(tables[3], nullptr);
+  EXPECT_TABLE_EQ_UNORDERED(tables[4], _table_a_multi);
+}
+
 TEST_F(SQLPipelineTest, CleanupWithScheduler) {
   auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
 
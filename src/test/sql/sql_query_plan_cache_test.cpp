@@ -1,6 +1,8 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -154,4 +156,84 @@ TEST_F(SQLQueryPlanCacheTest, AutomaticQueryOperatorCacheLRUK2) {
   EXPECT_EQ(5u, _query_plan_cache_hits);
 }
 
+TEST_F(SQLQueryPlanCacheTest, Metrics) {
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  cache.replace_cache_impl<LRUCache<std::string, SQLQueryPlan>>(2);
+
+  execute_query(Q1);  // Miss.
+  execute_query(Q1);  // Hit.
+  execute_query(Q2);  // Miss.
+  execute_query(Q3);  // Miss, evict Q1.
+
+  const auto metrics = cache.metrics();
+  EXPECT_EQ(metrics.hits, 1u);
+  EXPECT_EQ(metrics.misses, 3u);
+  EXPECT_EQ(metrics.evictions, 1u);
+
+  cache.clear();
+  EXPECT_EQ(cache.metrics().hits, 0u);
+}
+
+TEST_F(SQLQueryPlanCacheTest, ConcurrentAccessToShards) {
+  auto cache = SQLQueryCache<int, int>{256};
+  EXPECT_EQ(cache.shard_count(), 4u);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 8; ++thread_id) {
+    threads.emplace_back([&cache]() {
+      for (auto key = 0; key < 1000; ++key) {
+        if (!cache.try_get(key)) cache.set(key, key);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Every shard is full. Every key was inserted at least once, threads that missed the same key concurrently refreshed
+  // the entry instead of evicting another one.
+  const auto metrics = cache.metrics();
+  EXPECT_EQ(cache.size(), 256u);
+  EXPECT_EQ(metrics.hits + metrics.misses, 8000u);
+  EXPECT_GE(metrics.evictions, 1000u - 256u);
+  EXPECT_LE(metrics.evictions, metrics.misses - 256u);
+
+  // Shrinking the cache within the same number of shards keeps the entries that fit
+  cache.resize(300);
+  EXPECT_EQ(cache.shard_count(), 4u);
+  EXPECT_EQ(cache.size(), 256u);
+
+  cache.resize(256);
+  EXPECT_EQ(cache.size(), 256u);
+  EXPECT_EQ(cache.metrics().evictions, metrics.evictions);
+}
+
+TEST_F(SQLQueryPlanCacheTest, ResizeChangesShardCount) {
+  auto cache = SQLQueryCache<int, int>{2048};
+  EXPECT_EQ(cache.shard_count(), 16u);
+  for (auto key = 0; key < 2000; ++key) cache.set(key, key);
+
+  // Shrinking within the same number of shards evicts entries from each shard
+  cache.resize(1024);
+  EXPECT_EQ(cache.shard_count(), 16u);
+  EXPECT_EQ(cache.size(), 1024u);
+  EXPECT_EQ(cache.metrics().evictions, 976u);
+
+  // With a capacity below the number of shards, some shards would have no capacity at all. The cache falls back to a
+  // single shard, which drops the entries.
+  cache.resize(4);
+  EXPECT_EQ(cache.shard_count(), 1u);
+  EXPECT_EQ(cache.capacity(), 4u);
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.metrics().evictions, 2000u);
+
+  for (auto key = 0; key < 10; ++key) cache.set(key, key);
+  EXPECT_EQ(cache.size(), 4u);
+  EXPECT_EQ(cache.metrics().evictions, 2006u);
+
+  // Growing the cache splits it into shards again
+  cache.resize(512);
+  EXPECT_EQ(cache.shard_count(), 8u);
+  for (auto key = 0; key < 1000; ++key) cache.set(key, key);
+  EXPECT_EQ(cache.size(), 512u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,135 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoding_manager.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ChunkEncodingManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/compression_input.tbl", 5u);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void TearDown() override { ChunkEncodingManager::get().set_options({}); }
+
+  // Inserts the rows of compression_input.tbl into table_a, leaving the transaction uncommitted
+  std::shared_ptr<TransactionContext> insert() {
+    const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/compression_input.tbl"));
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    const auto context = TransactionManager::get().new_transaction_context();
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  }
+
+  static bool is_encoded(const std::shared_ptr<const Chunk>& chunk) {
+    return !chunk->is_mutable() && chunk->statistics() &&
+           !std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(ColumnID{0}));
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkEncodingManagerTest, EncodesCompletedChunks) {
+  // 12 rows in chunks of 5: The last chunk is not full
+  EXPECT_EQ(ChunkEncodingManager::get().encode_completed_chunks(), 2u);
+  EXPECT_EQ(_table->chunk_count(), 3u);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_TRUE(is_encoded(chunk));
+    EXPECT_NE(std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(ColumnID{1})), nullptr);
+  }
+  EXPECT_FALSE(is_encoded(_table->get_chunk(ChunkID{2})));
+
+  // Encoded chunks are not encoded again
+  EXPECT_EQ(ChunkEncodingManager::get().encode_completed_chunks(), 0u);
+}
+
+TEST_F(ChunkEncodingManagerTest, SkipsChunksWithUncommittedInserts) {
+  ChunkEncodingManager::get().encode_completed_chunks();
+
+  // The last chunk is filled by an Insert, but is only completed once the Insert is committed
+  const auto context = insert();
+  EXPECT_EQ(_table->chunk_count(), 5u);
+  EXPECT_EQ(ChunkEncodingManager::get().encode_completed_chunks(), 0u);
+
+  context->commit();
+  EXPECT_EQ(ChunkEncodingManager::get().encode_completed_chunks(), 2u);
+  EXPECT_TRUE(is_encoded(_table->get_chunk(ChunkID{2})));
+  EXPECT_TRUE(is_encoded(_table->get_chunk(ChunkID{3})));
+  EXPECT_FALSE(is_encoded(_table->get_chunk(ChunkID{4})));
+}
+
+TEST_F(ChunkEncodingManagerTest, ChunkEncodingSpecPerTable) {
+  ChunkEncodingManager::get().set_chunk_encoding_spec(
+      "table_a", {SegmentEncodingSpec{EncodingType::Unencoded}, SegmentEncodingSpec{EncodingType::RunLength}});
+
+  const auto table_b = load_table("src/test/tables/compression_input.tbl", 5u);
+  StorageManager::get().add_table("table_b", table_b);
+
+  EXPECT_EQ(ChunkEncodingManager::get().encode_completed_chunks(), 4u);
+
+  const auto chunk_a = _table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(chunk_a->statistics());
+  EXPECT_FALSE(chunk_a->is_mutable());
+  EXPECT_NE(std::dynamic_pointer_cast<const BaseValueSegment>(chunk_a->get_segment(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(chunk_a->get_segment(ColumnID{1})), nullptr);
+
+  const auto chunk_b = table_b->get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk_b->get_segment(ColumnID{0})), nullptr);
+
+  EXPECT_THROW(ChunkEncodingManager::get().set_chunk_encoding_spec("table_b", {SegmentEncodingSpec{}}),
+               std::logic_error);
+}
+
+TEST_F(ChunkEncodingManagerTest, EncodingAdvisor) {
+  auto options = ChunkEncodingManager::Options{};
+  options.encoding_advisor_options = EncodingAdvisor::Options{};
+  ChunkEncodingManager::get().set_options(options);
+
+  EXPECT_EQ(ChunkEncodingManager::get().encode_completed_chunks(), 2u);
+
+  // The encodings picked by the advisor depend on the chunk's data, but the completed chunks are encoded
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->statistics());
+  }
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->statistics());
+}
+
+TEST_F(ChunkEncodingManagerTest, EncodesInBackground) {
+  auto options = ChunkEncodingManager::Options{};
+  options.interval = std::chrono::milliseconds(1);
+  ChunkEncodingManager::get().set_options(options);
+  ChunkEncodingManager::get().resume();
+
+  // Wait for at most 10 seconds
+  for (auto retry = 0; retry < 1000 && !is_encoded(_table->get_chunk(ChunkID{1})); ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  ChunkEncodingManager::get().pause();
+
+  EXPECT_TRUE(is_encoded(_table->get_chunk(ChunkID{0})));
+  EXPECT_TRUE(is_encoded(_table->get_chunk(ChunkID{1})));
+  EXPECT_FALSE(is_encoded(_table->get_chunk(ChunkID{2})));
+}
+
+}  // namespace opossum
@@ -103,6 +103,24 @@ TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingDecoder) {
   }
 }
 
+TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingIteratorAt) {
+  const auto sequence = this->generate_sequence(4'200, 8u);
+  const auto encoded_sequence_base = this->encode(sequence);
+
+  resolve_compressed_vector_type(*encoded_sequence_base, [&](auto& encoded_sequence) {
+    // Covers the first value, values within and at the boundaries of SIMD-BP128's meta blocks, and the end
+    for (const auto index : {size_t{0u}, size_t{127u}, size_t{2'047u}, size_t{2'048u}, size_t{4'199u}}) {
+      auto encoded_seq_it = encoded_sequence.iterator_at(index);
+      for (auto seq_it = sequence.cbegin() + index; seq_it != sequence.cend(); ++seq_it, ++encoded_seq_it) {
+        EXPECT_EQ(*encoded_seq_it, *seq_it);
+      }
+      EXPECT_TRUE(encoded_seq_it == encoded_sequence.cend());
+    }
+
+    EXPECT_TRUE(encoded_sequence.iterator_at(sequence.size()) == encoded_sequence.cend());
+  });
+}
+
 TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingIterators) {
   const auto sequence = pmr_vector<uint32_t>(2'200, 0u);
   const auto encoded_sequence_base = this->encode(sequence);
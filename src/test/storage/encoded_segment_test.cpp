@@ -4,6 +4,8 @@
 #include <memory>
 #include <random>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -180,6 +182,43 @@ TEST_P(EncodedSegmentTest, SequentiallyReadNullableIntSegment) {
   });
 }
 
+TEST_P(EncodedSegmentTest, SequentiallyReadNullableIntSegmentRange) {
+  auto value_segment = this->create_int_w_null_value_segment();
+  auto base_encoded_segment = this->encode_value_segment(DataType::Int, value_segment);
+
+  resolve_encoded_segment_type<int32_t>(*base_encoded_segment, [&](const auto& encoded_segment) {
+    auto value_segment_iterable = create_iterable_from_segment(*value_segment);
+    auto encoded_segment_iterable = create_iterable_from_segment(encoded_segment);
+
+    const auto size = static_cast<ChunkOffset>(row_count());
+
+    // The ranges start within and at the boundaries of frames and meta blocks
+    const auto ranges = std::vector<std::pair<ChunkOffset, ChunkOffset>>{
+        {0u, 100u}, {2'047u, 2'049u}, {2'048u, 5'000u}, {3'333u, size}, {size, size}};
+
+    for (const auto& range : ranges) {
+      const auto begin_offset = range.first;
+      const auto end_offset = range.second;
+
+      value_segment_iterable.with_iterators(begin_offset, end_offset, [&](auto value_it, auto value_end) {
+        encoded_segment_iterable.with_iterators(begin_offset, end_offset, [&](auto encoded_it, auto encoded_end) {
+          EXPECT_EQ(std::distance(encoded_it, encoded_end), static_cast<std::ptrdiff_t>(end_offset - begin_offset));
+
+          for (; encoded_it != encoded_end; ++encoded_it, ++value_it) {
+            EXPECT_EQ(value_it->chunk_offset(), encoded_it->chunk_offset());
+            EXPECT_EQ(value_it->is_null(), encoded_it->is_null());
+
+            if (!value_it->is_null()) {
+              EXPECT_EQ(value_it->value(), encoded_it->value());
+            }
+          }
+          EXPECT_TRUE(value_it == value_end);
+        });
+      });
+    }
+  });
+}
+
 TEST_P(EncodedSegmentTest, SequentiallyReadNullableIntSegmentWithChunkOffsetsList) {
   auto value_segment = this->create_int_w_null_value_segment();
   auto base_encoded_segment = this->encode_value_segment(DataType::Int, value_segment);
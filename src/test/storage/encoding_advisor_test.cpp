@@ -0,0 +1,115 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "all_type_variant.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Columns whose ideal encodings differ: sorted ids, low-cardinality flags in long runs, and long strings
+    const auto column_definitions = TableColumnDefinitions{
+        {"id", DataType::Int, false}, {"flag", DataType::Int, false}, {"name", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, _row_count);
+
+    for (auto row_id = 0; row_id < _row_count; ++row_id) {
+      const auto name = std::string(100, static_cast<char>('a' + row_id % 10));
+      _table->append({row_id, (row_id / 1'000) % 2, name});
+    }
+  }
+
+ protected:
+  SegmentEncodingSpec advise(const EncodingOptimizationGoal goal, const ColumnID column_id) {
+    auto options = EncodingAdvisor::Options{};
+    options.goal = goal;
+
+    const auto segment = std::static_pointer_cast<const BaseValueSegment>(
+        _table->get_chunk(ChunkID{0})->get_segment(column_id));
+    return EncodingAdvisor{options}.advise(_table->column_data_type(column_id), segment);
+  }
+
+  const int32_t _row_count = 10'000;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorTest, EstimatesAllCandidates) {
+  const auto chunk = _table->get_chunk(ChunkID{0});
+
+  for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+    const auto segment = std::static_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_id));
+    const auto candidates = EncodingAdvisor{}.estimate_candidates(_table->column_data_type(column_id), segment);
+
+    // Unencoded, RunLength, and Dictionary plus FrameOfReference (int) or FixedStringDictionary and FSST (string) with
+    // both vector compressions
+    const auto is_string_column = _table->column_data_type(column_id) == DataType::String;
+    EXPECT_EQ(candidates.size(), is_string_column ? 8u : 6u);
+    EXPECT_EQ(candidates.front().segment_encoding_spec.encoding_type, EncodingType::Unencoded);
+    for (const auto& candidate : candidates) {
+      EXPECT_GT(candidate.estimated_memory_usage, 0u);
+      EXPECT_GT(candidate.estimated_scan_cost, 0.0f);
+    }
+  }
+}
+
+TEST_F(EncodingAdvisorTest, AdvisesForMemoryUsage) {
+  EXPECT_EQ(advise(EncodingOptimizationGoal::MemoryUsage, ColumnID{0}).encoding_type, EncodingType::FrameOfReference);
+  EXPECT_EQ(advise(EncodingOptimizationGoal::MemoryUsage, ColumnID{1}).encoding_type, EncodingType::RunLength);
+
+  const auto name_spec = advise(EncodingOptimizationGoal::MemoryUsage, ColumnID{2});
+  EXPECT_TRUE(name_spec.encoding_type == EncodingType::Dictionary ||
+              name_spec.encoding_type == EncodingType::FixedStringDictionary);
+  EXPECT_EQ(name_spec.vector_compression_type, VectorCompressionType::SimdBp128);
+}
+
+TEST_F(EncodingAdvisorTest, AdvisesForScanPerformance) {
+  EXPECT_EQ(advise(EncodingOptimizationGoal::ScanPerformance, ColumnID{0}).encoding_type, EncodingType::Unencoded);
+  EXPECT_EQ(advise(EncodingOptimizationGoal::ScanPerformance, ColumnID{1}).encoding_type, EncodingType::RunLength);
+
+  const auto name_spec = advise(EncodingOptimizationGoal::ScanPerformance, ColumnID{2});
+  EXPECT_TRUE(name_spec.encoding_type == EncodingType::Dictionary ||
+              name_spec.encoding_type == EncodingType::FixedStringDictionary);
+  EXPECT_EQ(name_spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+}
+
+TEST_F(EncodingAdvisorTest, EmptySegment) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>();
+  EXPECT_TRUE(EncodingAdvisor{}.estimate_candidates(DataType::Int, segment).empty());
+  EXPECT_EQ(EncodingAdvisor{}.advise(DataType::Int, segment).encoding_type, SegmentEncodingSpec{}.encoding_type);
+}
+
+TEST_F(EncodingAdvisorTest, EncodeTable) {
+  const auto table = load_table("src/test/tables/compression_input.tbl", 5u);
+  const auto chunk_encoding_specs = EncodingAdvisor{}.advise(table);
+  ASSERT_EQ(chunk_encoding_specs.size(), table->chunk_count());
+
+  ChunkEncoder::encode_all_chunks(table, chunk_encoding_specs);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto& spec = chunk_encoding_specs[chunk_id][column_id];
+      const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+      if (spec.encoding_type == EncodingType::Unencoded) {
+        EXPECT_EQ(encoded_segment, nullptr);
+      } else {
+        ASSERT_NE(encoded_segment, nullptr);
+        EXPECT_EQ(encoded_segment->encoding_type(), spec.encoding_type);
+      }
+    }
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(table, load_table("src/test/tables/compression_input.tbl"));
+}
+
+}  // namespace opossum
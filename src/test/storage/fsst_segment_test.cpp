@@ -0,0 +1,199 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTestWithParam<VectorCompressionType> {
+ protected:
+  std::shared_ptr<FSSTSegment<std::string>> compress(const std::shared_ptr<ValueSegment<std::string>>& value_segment) {
+    const auto segment = encode_segment(EncodingType::FSST, DataType::String, value_segment, GetParam());
+    return std::dynamic_pointer_cast<FSSTSegment<std::string>>(segment);
+  }
+
+  // URLs have many distinct values, but share many substrings
+  std::shared_ptr<ValueSegment<std::string>> create_url_segment(const size_t row_count) {
+    auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      if (row % 13 == 0) {
+        value_segment->append(NULL_VALUE);
+      } else {
+        value_segment->append("https://www.example.com/users/" + std::to_string(row * 7'919) + "/profile.html");
+      }
+    }
+    return value_segment;
+  }
+};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, StorageFSSTSegmentTest,
+                        ::testing::Values(VectorCompressionType::FixedSizeByteAligned,
+                                          VectorCompressionType::SimdBp128));
+
+TEST_P(StorageFSSTSegmentTest, CompressSegmentString) {
+  const auto value_segment = create_url_segment(1'000);
+  const auto segment = compress(value_segment);
+  ASSERT_NE(segment, nullptr);
+
+  EXPECT_EQ(segment->encoding_type(), EncodingType::FSST);
+  EXPECT_EQ(segment->size(), 1'000u);
+  EXPECT_GT(segment->symbol_table().symbol_count(), 0u);
+
+  // The compressed strings are smaller than the raw strings
+  auto raw_size = size_t{0};
+  for (const auto& value : value_segment->values()) {
+    raw_size += value.size();
+  }
+  EXPECT_LT(segment->compressed_values().size(), raw_size / 2);
+}
+
+TEST_P(StorageFSSTSegmentTest, RandomAccess) {
+  const auto value_segment = create_url_segment(5'000);
+  const auto segment = compress(value_segment);
+
+  // Accessed out of order, starting with the last value
+  for (auto chunk_offset = ChunkOffset{4'999}; chunk_offset < 5'000; chunk_offset -= 97) {
+    if (chunk_offset % 13 == 0) {
+      EXPECT_EQ(segment->get_typed_value(chunk_offset), std::nullopt);
+      EXPECT_TRUE(variant_is_null((*segment)[chunk_offset]));
+    } else {
+      EXPECT_EQ(segment->get_typed_value(chunk_offset), value_segment->values()[chunk_offset]);
+      EXPECT_EQ((*segment)[chunk_offset], (*value_segment)[chunk_offset]);
+    }
+  }
+}
+
+TEST_P(StorageFSSTSegmentTest, Iterable) {
+  const auto value_segment = create_url_segment(5'000);
+  const auto segment = compress(value_segment);
+  const auto iterable = create_iterable_from_segment(*segment);
+
+  auto chunk_offset = ChunkOffset{0};
+  iterable.for_each([&](const auto& value) {
+    EXPECT_EQ(value.chunk_offset(), chunk_offset);
+    EXPECT_EQ(value.is_null(), chunk_offset % 13 == 0);
+    if (!value.is_null()) {
+      EXPECT_EQ(value.value(), value_segment->values()[chunk_offset]);
+    }
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, 5'000u);
+
+  const auto mapped_chunk_offsets = ChunkOffsetsList{{0, 4'999}, {1, 13}, {2, 0}, {3, 2'048}};
+  auto row = size_t{0};
+  iterable.for_each(&mapped_chunk_offsets, [&](const auto& value) {
+    const auto into_referenced = mapped_chunk_offsets[row].into_referenced;
+    EXPECT_EQ(value.chunk_offset(), mapped_chunk_offsets[row].into_referencing);
+    EXPECT_EQ(value.is_null(), into_referenced % 13 == 0);
+    if (!value.is_null()) {
+      EXPECT_EQ(value.value(), value_segment->values()[into_referenced]);
+    }
+    ++row;
+  });
+  EXPECT_EQ(row, mapped_chunk_offsets.size());
+}
+
+TEST_P(StorageFSSTSegmentTest, IterableRange) {
+  const auto value_segment = create_url_segment(5'000);
+  const auto segment = compress(value_segment);
+  const auto iterable = create_iterable_from_segment(*segment);
+
+  // The ranges start at the first value, within the end offsets and at the last values
+  const auto ranges = std::vector<std::pair<ChunkOffset, ChunkOffset>>{{0, 3}, {2'047, 2'100}, {4'990, 5'000}};
+  for (const auto& range : ranges) {
+    const auto end_offset = range.second;
+    auto chunk_offset = range.first;
+    iterable.with_iterators(range.first, end_offset, [&](auto it, const auto end) {
+      for (; it != end; ++it, ++chunk_offset) {
+        EXPECT_EQ(it->chunk_offset(), chunk_offset);
+        EXPECT_EQ(it->is_null(), chunk_offset % 13 == 0);
+        if (!it->is_null()) {
+          EXPECT_EQ(it->value(), value_segment->values()[chunk_offset]);
+        }
+      }
+    });
+    EXPECT_EQ(chunk_offset, end_offset);
+  }
+}
+
+TEST_P(StorageFSSTSegmentTest, EscapedBytes) {
+  // Strings that contain bytes the symbol table was not built for, including NUL and the escape code
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  value_segment->append(std::string{"abc\0\xff", 5});
+  value_segment->append(std::string{});
+  value_segment->append(std::string{"\xff\xfe\x01", 3});
+
+  const auto segment = compress(value_segment);
+  EXPECT_EQ(segment->get_typed_value(0), std::string("abc\0\xff", 5));
+  EXPECT_EQ(segment->get_typed_value(1), std::string{});
+  EXPECT_EQ(segment->get_typed_value(2), std::string("\xff\xfe\x01", 3));
+}
+
+TEST_P(StorageFSSTSegmentTest, EmptySegment) {
+  const auto segment = compress(std::make_shared<ValueSegment<std::string>>());
+  EXPECT_EQ(segment->size(), 0u);
+  EXPECT_EQ(segment->symbol_table().symbol_count(), 0u);
+}
+
+TEST_P(StorageFSSTSegmentTest, CopyUsingAllocator) {
+  const auto value_segment = create_url_segment(100);
+  const auto segment = compress(value_segment);
+
+  const auto alloc = segment->compressed_values().get_allocator();
+  const auto copy = std::dynamic_pointer_cast<FSSTSegment<std::string>>(segment->copy_using_allocator(alloc));
+
+  EXPECT_EQ(copy->compressed_values().get_allocator(), alloc);
+  EXPECT_EQ(copy->compressed_vector_type(), segment->compressed_vector_type());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 100; ++chunk_offset) {
+    EXPECT_EQ(copy->get_typed_value(chunk_offset), segment->get_typed_value(chunk_offset));
+  }
+}
+
+TEST_P(StorageFSSTSegmentTest, MemoryUsageEstimation) {
+  const auto value_segment = create_url_segment(10'000);
+  const auto segment = compress(value_segment);
+
+  // The estimate covers at least the codes and the symbol table, and is far below the size of the raw strings
+  EXPECT_GT(segment->estimate_memory_usage(), segment->compressed_values().size() + sizeof(FSSTSymbolTable));
+  EXPECT_LT(segment->estimate_memory_usage(), value_segment->size() * 40);
+}
+
+TEST(FSSTSymbolTableTest, LongestSymbolFirst) {
+  const auto symbol_table = FSSTSymbolTable{{"a", "ab", "abc", "b"}};
+  EXPECT_EQ(symbol_table.symbol_count(), 4u);
+
+  // "abc" + "ab" + "b" + escaped "d"
+  auto codes = pmr_vector<uint8_t>{};
+  symbol_table.compress("abcabbd", codes);
+  ASSERT_EQ(codes.size(), 5u);
+  EXPECT_EQ(symbol_table.symbol(codes[0]), "abc");
+  EXPECT_EQ(symbol_table.symbol(codes[1]), "ab");
+  EXPECT_EQ(symbol_table.symbol(codes[2]), "b");
+  EXPECT_EQ(codes[3], FSSTSymbolTable::ESCAPE_CODE);
+  EXPECT_EQ(codes[4], 'd');
+
+  EXPECT_EQ(symbol_table.decompress(codes.data(), codes.data() + codes.size()), "abcabbd");
+}
+
+TEST(FSSTSymbolTableTest, BuildFromSample) {
+  const auto sample = std::vector<std::string>(100, "hello world, hello hyrise");
+  const auto symbol_table = FSSTSymbolTable::build(sample);
+  EXPECT_LE(symbol_table.symbol_count(), FSSTSymbolTable::MAX_SYMBOL_COUNT);
+
+  auto codes = pmr_vector<uint8_t>{};
+  symbol_table.compress(sample.front(), codes);
+  EXPECT_LE(codes.size(), 6u);
+  EXPECT_EQ(symbol_table.decompress(codes.data(), codes.data() + codes.size()), sample.front());
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <string>
@@ -133,6 +134,25 @@ TEST_F(IterablesTest, ValueSegmentNullableReferencedIteratorWithIterators) {
   EXPECT_EQ(sum, 13'579u);
 }
 
+TEST_F(IterablesTest, ValueSegmentNullableRangeIteratorWithIterators) {
+  auto chunk = table_with_null->get_chunk(ChunkID{0u});
+
+  auto segment = chunk->get_segment(ColumnID{0u});
+  auto int_segment = std::dynamic_pointer_cast<const ValueSegment<int>>(segment);
+
+  auto iterable = ValueSegmentIterable<int>{*int_segment};
+
+  auto sum = uint32_t{0};
+  iterable.with_iterators(ChunkOffset{1u}, ChunkOffset{4u}, SumUpWithIterator{sum});
+
+  EXPECT_EQ(sum, 1'357u);
+
+  iterable.with_iterators(ChunkOffset{1u}, ChunkOffset{3u}, [](auto it, auto end) {
+    EXPECT_EQ((*it).chunk_offset(), 1u);
+    EXPECT_EQ(std::distance(it, end), 2);
+  });
+}
+
 TEST_F(IterablesTest, DictionarySegmentIteratorWithIterators) {
   ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
 
@@ -167,6 +187,24 @@ TEST_F(IterablesTest, DictionarySegmentReferencedIteratorWithIterators) {
   EXPECT_EQ(sum, 12'480u);
 }
 
+TEST_F(IterablesTest, DictionarySegmentRangeIteratorWithIterators) {
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+
+  auto chunk = table->get_chunk(ChunkID{0u});
+
+  auto segment = chunk->get_segment(ColumnID{0u});
+  auto dict_segment = std::dynamic_pointer_cast<const DictionarySegment<int>>(segment);
+
+  auto iterable = DictionarySegmentIterable<int, pmr_vector<int>>{*dict_segment};
+
+  auto sum = uint32_t{0};
+  iterable.with_iterators(ChunkOffset{1u}, ChunkOffset{3u}, SumUpWithIterator{sum});
+  EXPECT_EQ(sum, 12'468u);
+
+  iterable.with_iterators(ChunkOffset{2u}, ChunkOffset{4u}, SumUpWithIterator{sum});
+  EXPECT_EQ(sum, 135u);
+}
+
 TEST_F(IterablesTest, FixedStringDictionarySegmentIteratorWithIterators) {
   ChunkEncoder::encode_all_chunks(table_strings, EncodingType::FixedStringDictionary);
 
@@ -1,6 +1,8 @@
 #include <limits>
 #include <memory>
+#include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -157,6 +159,78 @@ TEST_F(StorageTableTest, EmplaceChunkDoesNotReplaceIfNumberOfChunksGreaterOne) {
   EXPECT_EQ(t->chunk_count(), 3u);
 }
 
+TEST_F(StorageTableTest, ReserveRows) {
+  t->append({4, "Hello,"});
+
+  // The rest of the existing chunk is reserved first
+  const auto reservation_1 = t->reserve_rows(3);
+  EXPECT_EQ(reservation_1.chunk_id, ChunkID{0});
+  EXPECT_EQ(reservation_1.chunk, t->get_chunk(ChunkID{0}));
+  EXPECT_EQ(reservation_1.begin, 1u);
+  EXPECT_EQ(reservation_1.row_count, 1u);
+  EXPECT_FALSE(reservation_1.appended_chunk);
+
+  const auto reservation_2 = t->reserve_rows(2);
+  EXPECT_EQ(t->chunk_count(), 2u);
+  EXPECT_EQ(reservation_2.chunk_id, ChunkID{1});
+  EXPECT_EQ(reservation_2.chunk, t->get_chunk(ChunkID{1}));
+  EXPECT_EQ(reservation_2.begin, 0u);
+  EXPECT_EQ(reservation_2.row_count, 2u);
+  EXPECT_TRUE(reservation_2.appended_chunk);
+
+  // A prepared chunk is appended once the last one is full
+  t->prepare_mutable_chunk();
+  EXPECT_EQ(t->chunk_count(), 2u);
+
+  const auto reservation_3 = t->reserve_rows(1);
+  EXPECT_EQ(t->chunk_count(), 3u);
+  EXPECT_EQ(reservation_3.chunk_id, ChunkID{2});
+  EXPECT_EQ(reservation_3.begin, 0u);
+  EXPECT_TRUE(reservation_3.appended_chunk);
+
+  // The reserved rows do not exist until the segments are grown
+  EXPECT_EQ(t->get_chunk(ChunkID{1})->size(), 0u);
+
+  // Immutable chunks are skipped
+  t->get_chunk(ChunkID{2})->mark_immutable();
+  const auto reservation_4 = t->reserve_rows(1);
+  EXPECT_EQ(t->chunk_count(), 4u);
+  EXPECT_EQ(reservation_4.chunk_id, ChunkID{3});
+}
+
+TEST_F(StorageTableTest, ReserveRowsConcurrently) {
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 120, UseMvcc::Yes);
+
+  constexpr auto thread_count = 8u;
+  constexpr auto reservations_per_thread = 50u;
+
+  auto reservations_by_thread = std::vector<std::vector<Table::RowReservation>>(thread_count);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0u; thread_idx < thread_count; ++thread_idx) {
+    threads.emplace_back([&, thread_idx]() {
+      for (auto reservation_idx = 0u; reservation_idx < reservations_per_thread; ++reservation_idx) {
+        reservations_by_thread[thread_idx].emplace_back(table->reserve_rows(3));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Every row is reserved exactly once
+  auto reserved_rows = std::set<std::pair<ChunkID, ChunkOffset>>{};
+  for (const auto& reservations : reservations_by_thread) {
+    for (const auto& reservation : reservations) {
+      EXPECT_EQ(reservation.chunk, table->get_chunk(reservation.chunk_id));
+      for (auto offset = reservation.begin; offset < reservation.begin + reservation.row_count; ++offset) {
+        EXPECT_TRUE(reserved_rows.emplace(reservation.chunk_id, offset).second);
+        EXPECT_LT(offset, 120u);
+      }
+    }
+  }
+
+  EXPECT_EQ(reserved_rows.size(), thread_count * reservations_per_thread * 3);
+  EXPECT_EQ(table->chunk_count(), 10u);
+}
+
 TEST_F(StorageTableTest, ChunkSizeZeroThrows) {
   TableColumnDefinitions column_definitions{};
   EXPECT_THROW(Table(column_definitions, TableType::Data, 0), std::logic_error);